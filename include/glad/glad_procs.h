@@ -0,0 +1,1114 @@
+/*
+
+    Entry point list for the glad loader, generated from glad.h by
+    tools/glad_procs.py. Do not edit by hand, rerun the script instead.
+
+    Define GLAD_PROC(ret, name, pfn, params, args, feature) and
+    GLAD_PROC_VOID(name, pfn, params, args, feature) before including
+    this file, and optionally GLAD_FEATURE(feature). It has no include
+    guard on purpose, so it can be expanded several times with different
+    definitions.
+
+*/
+
+#ifndef GLAD_FEATURE
+#define GLAD_FEATURE(feature)
+#define GLAD_FEATURE_DEFAULTED
+#endif
+
+GLAD_FEATURE(GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(CullFace, PFNGLCULLFACEPROC, (GLenum mode), (mode), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(FrontFace, PFNGLFRONTFACEPROC, (GLenum mode), (mode), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Hint, PFNGLHINTPROC, (GLenum target, GLenum mode), (target, mode), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(LineWidth, PFNGLLINEWIDTHPROC, (GLfloat width), (width), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PointSize, PFNGLPOINTSIZEPROC, (GLfloat size), (size), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PolygonMode, PFNGLPOLYGONMODEPROC, (GLenum face, GLenum mode), (face, mode), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Scissor, PFNGLSCISSORPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexParameterf, PFNGLTEXPARAMETERFPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexParameterfv, PFNGLTEXPARAMETERFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexParameteri, PFNGLTEXPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexParameteriv, PFNGLTEXPARAMETERIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexImage1D, PFNGLTEXIMAGE1DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, border, format, type, pixels), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexImage2D, PFNGLTEXIMAGE2DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, border, format, type, pixels), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(DrawBuffer, PFNGLDRAWBUFFERPROC, (GLenum buf), (buf), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Clear, PFNGLCLEARPROC, (GLbitfield mask), (mask), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(ClearColor, PFNGLCLEARCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(ClearStencil, PFNGLCLEARSTENCILPROC, (GLint s), (s), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(ClearDepth, PFNGLCLEARDEPTHPROC, (GLdouble depth), (depth), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(StencilMask, PFNGLSTENCILMASKPROC, (GLuint mask), (mask), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(ColorMask, PFNGLCOLORMASKPROC, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(DepthMask, PFNGLDEPTHMASKPROC, (GLboolean flag), (flag), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Disable, PFNGLDISABLEPROC, (GLenum cap), (cap), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Enable, PFNGLENABLEPROC, (GLenum cap), (cap), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Finish, PFNGLFINISHPROC, (void), (), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Flush, PFNGLFLUSHPROC, (void), (), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(BlendFunc, PFNGLBLENDFUNCPROC, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(LogicOp, PFNGLLOGICOPPROC, (GLenum opcode), (opcode), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(StencilFunc, PFNGLSTENCILFUNCPROC, (GLenum func, GLint ref, GLuint mask), (func, ref, mask), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(StencilOp, PFNGLSTENCILOPPROC, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(DepthFunc, PFNGLDEPTHFUNCPROC, (GLenum func), (func), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PixelStoref, PFNGLPIXELSTOREFPROC, (GLenum pname, GLfloat param), (pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PixelStorei, PFNGLPIXELSTOREIPROC, (GLenum pname, GLint param), (pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(ReadBuffer, PFNGLREADBUFFERPROC, (GLenum src), (src), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(ReadPixels, PFNGLREADPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels), (x, y, width, height, format, type, pixels), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetBooleanv, PFNGLGETBOOLEANVPROC, (GLenum pname, GLboolean *data), (pname, data), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetDoublev, PFNGLGETDOUBLEVPROC, (GLenum pname, GLdouble *data), (pname, data), GLAD_GL_VERSION_1_0)
+GLAD_PROC(GLenum, GetError, PFNGLGETERRORPROC, (void), (), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetFloatv, PFNGLGETFLOATVPROC, (GLenum pname, GLfloat *data), (pname, data), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetIntegerv, PFNGLGETINTEGERVPROC, (GLenum pname, GLint *data), (pname, data), GLAD_GL_VERSION_1_0)
+GLAD_PROC(const GLubyte *, GetString, PFNGLGETSTRINGPROC, (GLenum name), (name), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetTexImage, PFNGLGETTEXIMAGEPROC, (GLenum target, GLint level, GLenum format, GLenum type, void *pixels), (target, level, format, type, pixels), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetTexParameterfv, PFNGLGETTEXPARAMETERFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetTexParameteriv, PFNGLGETTEXPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetTexLevelParameterfv, PFNGLGETTEXLEVELPARAMETERFVPROC, (GLenum target, GLint level, GLenum pname, GLfloat *params), (target, level, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetTexLevelParameteriv, PFNGLGETTEXLEVELPARAMETERIVPROC, (GLenum target, GLint level, GLenum pname, GLint *params), (target, level, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC(GLboolean, IsEnabled, PFNGLISENABLEDPROC, (GLenum cap), (cap), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(DepthRange, PFNGLDEPTHRANGEPROC, (GLdouble nearVal, GLdouble farVal), (nearVal, farVal), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Viewport, PFNGLVIEWPORTPROC, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(NewList, PFNGLNEWLISTPROC, (GLuint list, GLenum mode), (list, mode), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(EndList, PFNGLENDLISTPROC, (void), (), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(CallList, PFNGLCALLLISTPROC, (GLuint list), (list), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(CallLists, PFNGLCALLLISTSPROC, (GLsizei n, GLenum type, const void *lists), (n, type, lists), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(DeleteLists, PFNGLDELETELISTSPROC, (GLuint list, GLsizei range), (list, range), GLAD_GL_VERSION_1_0)
+GLAD_PROC(GLuint, GenLists, PFNGLGENLISTSPROC, (GLsizei range), (range), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(ListBase, PFNGLLISTBASEPROC, (GLuint base), (base), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Begin, PFNGLBEGINPROC, (GLenum mode), (mode), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Bitmap, PFNGLBITMAPPROC, (GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap), (width, height, xorig, yorig, xmove, ymove, bitmap), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3b, PFNGLCOLOR3BPROC, (GLbyte red, GLbyte green, GLbyte blue), (red, green, blue), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3bv, PFNGLCOLOR3BVPROC, (const GLbyte *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3d, PFNGLCOLOR3DPROC, (GLdouble red, GLdouble green, GLdouble blue), (red, green, blue), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3dv, PFNGLCOLOR3DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3f, PFNGLCOLOR3FPROC, (GLfloat red, GLfloat green, GLfloat blue), (red, green, blue), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3fv, PFNGLCOLOR3FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3i, PFNGLCOLOR3IPROC, (GLint red, GLint green, GLint blue), (red, green, blue), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3iv, PFNGLCOLOR3IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3s, PFNGLCOLOR3SPROC, (GLshort red, GLshort green, GLshort blue), (red, green, blue), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3sv, PFNGLCOLOR3SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3ub, PFNGLCOLOR3UBPROC, (GLubyte red, GLubyte green, GLubyte blue), (red, green, blue), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3ubv, PFNGLCOLOR3UBVPROC, (const GLubyte *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3ui, PFNGLCOLOR3UIPROC, (GLuint red, GLuint green, GLuint blue), (red, green, blue), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3uiv, PFNGLCOLOR3UIVPROC, (const GLuint *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3us, PFNGLCOLOR3USPROC, (GLushort red, GLushort green, GLushort blue), (red, green, blue), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color3usv, PFNGLCOLOR3USVPROC, (const GLushort *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4b, PFNGLCOLOR4BPROC, (GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha), (red, green, blue, alpha), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4bv, PFNGLCOLOR4BVPROC, (const GLbyte *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4d, PFNGLCOLOR4DPROC, (GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha), (red, green, blue, alpha), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4dv, PFNGLCOLOR4DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4f, PFNGLCOLOR4FPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4fv, PFNGLCOLOR4FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4i, PFNGLCOLOR4IPROC, (GLint red, GLint green, GLint blue, GLint alpha), (red, green, blue, alpha), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4iv, PFNGLCOLOR4IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4s, PFNGLCOLOR4SPROC, (GLshort red, GLshort green, GLshort blue, GLshort alpha), (red, green, blue, alpha), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4sv, PFNGLCOLOR4SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4ub, PFNGLCOLOR4UBPROC, (GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha), (red, green, blue, alpha), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4ubv, PFNGLCOLOR4UBVPROC, (const GLubyte *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4ui, PFNGLCOLOR4UIPROC, (GLuint red, GLuint green, GLuint blue, GLuint alpha), (red, green, blue, alpha), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4uiv, PFNGLCOLOR4UIVPROC, (const GLuint *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4us, PFNGLCOLOR4USPROC, (GLushort red, GLushort green, GLushort blue, GLushort alpha), (red, green, blue, alpha), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Color4usv, PFNGLCOLOR4USVPROC, (const GLushort *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(EdgeFlag, PFNGLEDGEFLAGPROC, (GLboolean flag), (flag), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(EdgeFlagv, PFNGLEDGEFLAGVPROC, (const GLboolean *flag), (flag), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(End, PFNGLENDPROC, (void), (), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Indexd, PFNGLINDEXDPROC, (GLdouble c), (c), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Indexdv, PFNGLINDEXDVPROC, (const GLdouble *c), (c), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Indexf, PFNGLINDEXFPROC, (GLfloat c), (c), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Indexfv, PFNGLINDEXFVPROC, (const GLfloat *c), (c), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Indexi, PFNGLINDEXIPROC, (GLint c), (c), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Indexiv, PFNGLINDEXIVPROC, (const GLint *c), (c), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Indexs, PFNGLINDEXSPROC, (GLshort c), (c), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Indexsv, PFNGLINDEXSVPROC, (const GLshort *c), (c), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Normal3b, PFNGLNORMAL3BPROC, (GLbyte nx, GLbyte ny, GLbyte nz), (nx, ny, nz), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Normal3bv, PFNGLNORMAL3BVPROC, (const GLbyte *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Normal3d, PFNGLNORMAL3DPROC, (GLdouble nx, GLdouble ny, GLdouble nz), (nx, ny, nz), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Normal3dv, PFNGLNORMAL3DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Normal3f, PFNGLNORMAL3FPROC, (GLfloat nx, GLfloat ny, GLfloat nz), (nx, ny, nz), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Normal3fv, PFNGLNORMAL3FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Normal3i, PFNGLNORMAL3IPROC, (GLint nx, GLint ny, GLint nz), (nx, ny, nz), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Normal3iv, PFNGLNORMAL3IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Normal3s, PFNGLNORMAL3SPROC, (GLshort nx, GLshort ny, GLshort nz), (nx, ny, nz), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Normal3sv, PFNGLNORMAL3SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos2d, PFNGLRASTERPOS2DPROC, (GLdouble x, GLdouble y), (x, y), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos2dv, PFNGLRASTERPOS2DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos2f, PFNGLRASTERPOS2FPROC, (GLfloat x, GLfloat y), (x, y), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos2fv, PFNGLRASTERPOS2FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos2i, PFNGLRASTERPOS2IPROC, (GLint x, GLint y), (x, y), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos2iv, PFNGLRASTERPOS2IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos2s, PFNGLRASTERPOS2SPROC, (GLshort x, GLshort y), (x, y), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos2sv, PFNGLRASTERPOS2SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos3d, PFNGLRASTERPOS3DPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos3dv, PFNGLRASTERPOS3DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos3f, PFNGLRASTERPOS3FPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos3fv, PFNGLRASTERPOS3FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos3i, PFNGLRASTERPOS3IPROC, (GLint x, GLint y, GLint z), (x, y, z), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos3iv, PFNGLRASTERPOS3IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos3s, PFNGLRASTERPOS3SPROC, (GLshort x, GLshort y, GLshort z), (x, y, z), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos3sv, PFNGLRASTERPOS3SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos4d, PFNGLRASTERPOS4DPROC, (GLdouble x, GLdouble y, GLdouble z, GLdouble w), (x, y, z, w), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos4dv, PFNGLRASTERPOS4DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos4f, PFNGLRASTERPOS4FPROC, (GLfloat x, GLfloat y, GLfloat z, GLfloat w), (x, y, z, w), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos4fv, PFNGLRASTERPOS4FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos4i, PFNGLRASTERPOS4IPROC, (GLint x, GLint y, GLint z, GLint w), (x, y, z, w), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos4iv, PFNGLRASTERPOS4IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos4s, PFNGLRASTERPOS4SPROC, (GLshort x, GLshort y, GLshort z, GLshort w), (x, y, z, w), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(RasterPos4sv, PFNGLRASTERPOS4SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Rectd, PFNGLRECTDPROC, (GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2), (x1, y1, x2, y2), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Rectdv, PFNGLRECTDVPROC, (const GLdouble *v1, const GLdouble *v2), (v1, v2), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Rectf, PFNGLRECTFPROC, (GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2), (x1, y1, x2, y2), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Rectfv, PFNGLRECTFVPROC, (const GLfloat *v1, const GLfloat *v2), (v1, v2), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Recti, PFNGLRECTIPROC, (GLint x1, GLint y1, GLint x2, GLint y2), (x1, y1, x2, y2), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Rectiv, PFNGLRECTIVPROC, (const GLint *v1, const GLint *v2), (v1, v2), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Rects, PFNGLRECTSPROC, (GLshort x1, GLshort y1, GLshort x2, GLshort y2), (x1, y1, x2, y2), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Rectsv, PFNGLRECTSVPROC, (const GLshort *v1, const GLshort *v2), (v1, v2), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord1d, PFNGLTEXCOORD1DPROC, (GLdouble s), (s), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord1dv, PFNGLTEXCOORD1DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord1f, PFNGLTEXCOORD1FPROC, (GLfloat s), (s), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord1fv, PFNGLTEXCOORD1FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord1i, PFNGLTEXCOORD1IPROC, (GLint s), (s), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord1iv, PFNGLTEXCOORD1IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord1s, PFNGLTEXCOORD1SPROC, (GLshort s), (s), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord1sv, PFNGLTEXCOORD1SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord2d, PFNGLTEXCOORD2DPROC, (GLdouble s, GLdouble t), (s, t), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord2dv, PFNGLTEXCOORD2DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord2f, PFNGLTEXCOORD2FPROC, (GLfloat s, GLfloat t), (s, t), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord2fv, PFNGLTEXCOORD2FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord2i, PFNGLTEXCOORD2IPROC, (GLint s, GLint t), (s, t), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord2iv, PFNGLTEXCOORD2IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord2s, PFNGLTEXCOORD2SPROC, (GLshort s, GLshort t), (s, t), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord2sv, PFNGLTEXCOORD2SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord3d, PFNGLTEXCOORD3DPROC, (GLdouble s, GLdouble t, GLdouble r), (s, t, r), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord3dv, PFNGLTEXCOORD3DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord3f, PFNGLTEXCOORD3FPROC, (GLfloat s, GLfloat t, GLfloat r), (s, t, r), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord3fv, PFNGLTEXCOORD3FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord3i, PFNGLTEXCOORD3IPROC, (GLint s, GLint t, GLint r), (s, t, r), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord3iv, PFNGLTEXCOORD3IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord3s, PFNGLTEXCOORD3SPROC, (GLshort s, GLshort t, GLshort r), (s, t, r), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord3sv, PFNGLTEXCOORD3SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord4d, PFNGLTEXCOORD4DPROC, (GLdouble s, GLdouble t, GLdouble r, GLdouble q), (s, t, r, q), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord4dv, PFNGLTEXCOORD4DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord4f, PFNGLTEXCOORD4FPROC, (GLfloat s, GLfloat t, GLfloat r, GLfloat q), (s, t, r, q), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord4fv, PFNGLTEXCOORD4FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord4i, PFNGLTEXCOORD4IPROC, (GLint s, GLint t, GLint r, GLint q), (s, t, r, q), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord4iv, PFNGLTEXCOORD4IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord4s, PFNGLTEXCOORD4SPROC, (GLshort s, GLshort t, GLshort r, GLshort q), (s, t, r, q), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexCoord4sv, PFNGLTEXCOORD4SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex2d, PFNGLVERTEX2DPROC, (GLdouble x, GLdouble y), (x, y), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex2dv, PFNGLVERTEX2DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex2f, PFNGLVERTEX2FPROC, (GLfloat x, GLfloat y), (x, y), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex2fv, PFNGLVERTEX2FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex2i, PFNGLVERTEX2IPROC, (GLint x, GLint y), (x, y), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex2iv, PFNGLVERTEX2IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex2s, PFNGLVERTEX2SPROC, (GLshort x, GLshort y), (x, y), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex2sv, PFNGLVERTEX2SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex3d, PFNGLVERTEX3DPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex3dv, PFNGLVERTEX3DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex3f, PFNGLVERTEX3FPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex3fv, PFNGLVERTEX3FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex3i, PFNGLVERTEX3IPROC, (GLint x, GLint y, GLint z), (x, y, z), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex3iv, PFNGLVERTEX3IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex3s, PFNGLVERTEX3SPROC, (GLshort x, GLshort y, GLshort z), (x, y, z), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex3sv, PFNGLVERTEX3SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex4d, PFNGLVERTEX4DPROC, (GLdouble x, GLdouble y, GLdouble z, GLdouble w), (x, y, z, w), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex4dv, PFNGLVERTEX4DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex4f, PFNGLVERTEX4FPROC, (GLfloat x, GLfloat y, GLfloat z, GLfloat w), (x, y, z, w), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex4fv, PFNGLVERTEX4FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex4i, PFNGLVERTEX4IPROC, (GLint x, GLint y, GLint z, GLint w), (x, y, z, w), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex4iv, PFNGLVERTEX4IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex4s, PFNGLVERTEX4SPROC, (GLshort x, GLshort y, GLshort z, GLshort w), (x, y, z, w), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Vertex4sv, PFNGLVERTEX4SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(ClipPlane, PFNGLCLIPPLANEPROC, (GLenum plane, const GLdouble *equation), (plane, equation), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(ColorMaterial, PFNGLCOLORMATERIALPROC, (GLenum face, GLenum mode), (face, mode), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Fogf, PFNGLFOGFPROC, (GLenum pname, GLfloat param), (pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Fogfv, PFNGLFOGFVPROC, (GLenum pname, const GLfloat *params), (pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Fogi, PFNGLFOGIPROC, (GLenum pname, GLint param), (pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Fogiv, PFNGLFOGIVPROC, (GLenum pname, const GLint *params), (pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Lightf, PFNGLLIGHTFPROC, (GLenum light, GLenum pname, GLfloat param), (light, pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Lightfv, PFNGLLIGHTFVPROC, (GLenum light, GLenum pname, const GLfloat *params), (light, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Lighti, PFNGLLIGHTIPROC, (GLenum light, GLenum pname, GLint param), (light, pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Lightiv, PFNGLLIGHTIVPROC, (GLenum light, GLenum pname, const GLint *params), (light, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(LightModelf, PFNGLLIGHTMODELFPROC, (GLenum pname, GLfloat param), (pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(LightModelfv, PFNGLLIGHTMODELFVPROC, (GLenum pname, const GLfloat *params), (pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(LightModeli, PFNGLLIGHTMODELIPROC, (GLenum pname, GLint param), (pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(LightModeliv, PFNGLLIGHTMODELIVPROC, (GLenum pname, const GLint *params), (pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(LineStipple, PFNGLLINESTIPPLEPROC, (GLint factor, GLushort pattern), (factor, pattern), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Materialf, PFNGLMATERIALFPROC, (GLenum face, GLenum pname, GLfloat param), (face, pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Materialfv, PFNGLMATERIALFVPROC, (GLenum face, GLenum pname, const GLfloat *params), (face, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Materiali, PFNGLMATERIALIPROC, (GLenum face, GLenum pname, GLint param), (face, pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Materialiv, PFNGLMATERIALIVPROC, (GLenum face, GLenum pname, const GLint *params), (face, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PolygonStipple, PFNGLPOLYGONSTIPPLEPROC, (const GLubyte *mask), (mask), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(ShadeModel, PFNGLSHADEMODELPROC, (GLenum mode), (mode), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexEnvf, PFNGLTEXENVFPROC, (GLenum target, GLenum pname, GLfloat param), (target, pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexEnvfv, PFNGLTEXENVFVPROC, (GLenum target, GLenum pname, const GLfloat *params), (target, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexEnvi, PFNGLTEXENVIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexEnviv, PFNGLTEXENVIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexGend, PFNGLTEXGENDPROC, (GLenum coord, GLenum pname, GLdouble param), (coord, pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexGendv, PFNGLTEXGENDVPROC, (GLenum coord, GLenum pname, const GLdouble *params), (coord, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexGenf, PFNGLTEXGENFPROC, (GLenum coord, GLenum pname, GLfloat param), (coord, pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexGenfv, PFNGLTEXGENFVPROC, (GLenum coord, GLenum pname, const GLfloat *params), (coord, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexGeni, PFNGLTEXGENIPROC, (GLenum coord, GLenum pname, GLint param), (coord, pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(TexGeniv, PFNGLTEXGENIVPROC, (GLenum coord, GLenum pname, const GLint *params), (coord, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(FeedbackBuffer, PFNGLFEEDBACKBUFFERPROC, (GLsizei size, GLenum type, GLfloat *buffer), (size, type, buffer), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(SelectBuffer, PFNGLSELECTBUFFERPROC, (GLsizei size, GLuint *buffer), (size, buffer), GLAD_GL_VERSION_1_0)
+GLAD_PROC(GLint, RenderMode, PFNGLRENDERMODEPROC, (GLenum mode), (mode), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(InitNames, PFNGLINITNAMESPROC, (void), (), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(LoadName, PFNGLLOADNAMEPROC, (GLuint name), (name), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PassThrough, PFNGLPASSTHROUGHPROC, (GLfloat token), (token), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PopName, PFNGLPOPNAMEPROC, (void), (), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PushName, PFNGLPUSHNAMEPROC, (GLuint name), (name), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(ClearAccum, PFNGLCLEARACCUMPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(ClearIndex, PFNGLCLEARINDEXPROC, (GLfloat c), (c), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(IndexMask, PFNGLINDEXMASKPROC, (GLuint mask), (mask), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Accum, PFNGLACCUMPROC, (GLenum op, GLfloat value), (op, value), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PopAttrib, PFNGLPOPATTRIBPROC, (void), (), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PushAttrib, PFNGLPUSHATTRIBPROC, (GLbitfield mask), (mask), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Map1d, PFNGLMAP1DPROC, (GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points), (target, u1, u2, stride, order, points), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Map1f, PFNGLMAP1FPROC, (GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points), (target, u1, u2, stride, order, points), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Map2d, PFNGLMAP2DPROC, (GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Map2f, PFNGLMAP2FPROC, (GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points), (target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(MapGrid1d, PFNGLMAPGRID1DPROC, (GLint un, GLdouble u1, GLdouble u2), (un, u1, u2), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(MapGrid1f, PFNGLMAPGRID1FPROC, (GLint un, GLfloat u1, GLfloat u2), (un, u1, u2), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(MapGrid2d, PFNGLMAPGRID2DPROC, (GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2), (un, u1, u2, vn, v1, v2), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(MapGrid2f, PFNGLMAPGRID2FPROC, (GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2), (un, u1, u2, vn, v1, v2), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(EvalCoord1d, PFNGLEVALCOORD1DPROC, (GLdouble u), (u), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(EvalCoord1dv, PFNGLEVALCOORD1DVPROC, (const GLdouble *u), (u), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(EvalCoord1f, PFNGLEVALCOORD1FPROC, (GLfloat u), (u), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(EvalCoord1fv, PFNGLEVALCOORD1FVPROC, (const GLfloat *u), (u), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(EvalCoord2d, PFNGLEVALCOORD2DPROC, (GLdouble u, GLdouble v), (u, v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(EvalCoord2dv, PFNGLEVALCOORD2DVPROC, (const GLdouble *u), (u), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(EvalCoord2f, PFNGLEVALCOORD2FPROC, (GLfloat u, GLfloat v), (u, v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(EvalCoord2fv, PFNGLEVALCOORD2FVPROC, (const GLfloat *u), (u), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(EvalMesh1, PFNGLEVALMESH1PROC, (GLenum mode, GLint i1, GLint i2), (mode, i1, i2), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(EvalPoint1, PFNGLEVALPOINT1PROC, (GLint i), (i), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(EvalMesh2, PFNGLEVALMESH2PROC, (GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2), (mode, i1, i2, j1, j2), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(EvalPoint2, PFNGLEVALPOINT2PROC, (GLint i, GLint j), (i, j), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(AlphaFunc, PFNGLALPHAFUNCPROC, (GLenum func, GLfloat ref), (func, ref), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PixelZoom, PFNGLPIXELZOOMPROC, (GLfloat xfactor, GLfloat yfactor), (xfactor, yfactor), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PixelTransferf, PFNGLPIXELTRANSFERFPROC, (GLenum pname, GLfloat param), (pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PixelTransferi, PFNGLPIXELTRANSFERIPROC, (GLenum pname, GLint param), (pname, param), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PixelMapfv, PFNGLPIXELMAPFVPROC, (GLenum map, GLsizei mapsize, const GLfloat *values), (map, mapsize, values), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PixelMapuiv, PFNGLPIXELMAPUIVPROC, (GLenum map, GLsizei mapsize, const GLuint *values), (map, mapsize, values), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PixelMapusv, PFNGLPIXELMAPUSVPROC, (GLenum map, GLsizei mapsize, const GLushort *values), (map, mapsize, values), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(CopyPixels, PFNGLCOPYPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum type), (x, y, width, height, type), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(DrawPixels, PFNGLDRAWPIXELSPROC, (GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (width, height, format, type, pixels), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetClipPlane, PFNGLGETCLIPPLANEPROC, (GLenum plane, GLdouble *equation), (plane, equation), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetLightfv, PFNGLGETLIGHTFVPROC, (GLenum light, GLenum pname, GLfloat *params), (light, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetLightiv, PFNGLGETLIGHTIVPROC, (GLenum light, GLenum pname, GLint *params), (light, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetMapdv, PFNGLGETMAPDVPROC, (GLenum target, GLenum query, GLdouble *v), (target, query, v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetMapfv, PFNGLGETMAPFVPROC, (GLenum target, GLenum query, GLfloat *v), (target, query, v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetMapiv, PFNGLGETMAPIVPROC, (GLenum target, GLenum query, GLint *v), (target, query, v), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetMaterialfv, PFNGLGETMATERIALFVPROC, (GLenum face, GLenum pname, GLfloat *params), (face, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetMaterialiv, PFNGLGETMATERIALIVPROC, (GLenum face, GLenum pname, GLint *params), (face, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetPixelMapfv, PFNGLGETPIXELMAPFVPROC, (GLenum map, GLfloat *values), (map, values), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetPixelMapuiv, PFNGLGETPIXELMAPUIVPROC, (GLenum map, GLuint *values), (map, values), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetPixelMapusv, PFNGLGETPIXELMAPUSVPROC, (GLenum map, GLushort *values), (map, values), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetPolygonStipple, PFNGLGETPOLYGONSTIPPLEPROC, (GLubyte *mask), (mask), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetTexEnvfv, PFNGLGETTEXENVFVPROC, (GLenum target, GLenum pname, GLfloat *params), (target, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetTexEnviv, PFNGLGETTEXENVIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetTexGendv, PFNGLGETTEXGENDVPROC, (GLenum coord, GLenum pname, GLdouble *params), (coord, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetTexGenfv, PFNGLGETTEXGENFVPROC, (GLenum coord, GLenum pname, GLfloat *params), (coord, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(GetTexGeniv, PFNGLGETTEXGENIVPROC, (GLenum coord, GLenum pname, GLint *params), (coord, pname, params), GLAD_GL_VERSION_1_0)
+GLAD_PROC(GLboolean, IsList, PFNGLISLISTPROC, (GLuint list), (list), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Frustum, PFNGLFRUSTUMPROC, (GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar), (left, right, bottom, top, zNear, zFar), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(LoadIdentity, PFNGLLOADIDENTITYPROC, (void), (), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(LoadMatrixf, PFNGLLOADMATRIXFPROC, (const GLfloat *m), (m), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(LoadMatrixd, PFNGLLOADMATRIXDPROC, (const GLdouble *m), (m), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(MatrixMode, PFNGLMATRIXMODEPROC, (GLenum mode), (mode), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(MultMatrixf, PFNGLMULTMATRIXFPROC, (const GLfloat *m), (m), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(MultMatrixd, PFNGLMULTMATRIXDPROC, (const GLdouble *m), (m), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Ortho, PFNGLORTHOPROC, (GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar), (left, right, bottom, top, zNear, zFar), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PopMatrix, PFNGLPOPMATRIXPROC, (void), (), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(PushMatrix, PFNGLPUSHMATRIXPROC, (void), (), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Rotated, PFNGLROTATEDPROC, (GLdouble angle, GLdouble x, GLdouble y, GLdouble z), (angle, x, y, z), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Rotatef, PFNGLROTATEFPROC, (GLfloat angle, GLfloat x, GLfloat y, GLfloat z), (angle, x, y, z), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Scaled, PFNGLSCALEDPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Scalef, PFNGLSCALEFPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Translated, PFNGLTRANSLATEDPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z), GLAD_GL_VERSION_1_0)
+GLAD_PROC_VOID(Translatef, PFNGLTRANSLATEFPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z), GLAD_GL_VERSION_1_0)
+
+GLAD_FEATURE(GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(DrawArrays, PFNGLDRAWARRAYSPROC, (GLenum mode, GLint first, GLsizei count), (mode, first, count), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(DrawElements, PFNGLDRAWELEMENTSPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices), (mode, count, type, indices), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(GetPointerv, PFNGLGETPOINTERVPROC, (GLenum pname, void **params), (pname, params), (GLAD_GL_VERSION_1_1 || GLAD_GL_KHR_debug))
+GLAD_PROC_VOID(PolygonOffset, PFNGLPOLYGONOFFSETPROC, (GLfloat factor, GLfloat units), (factor, units), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(CopyTexImage1D, PFNGLCOPYTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(CopyTexImage2D, PFNGLCOPYTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(CopyTexSubImage1D, PFNGLCOPYTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(CopyTexSubImage2D, PFNGLCOPYTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(TexSubImage1D, PFNGLTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, width, format, type, pixels), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(TexSubImage2D, PFNGLTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(BindTexture, PFNGLBINDTEXTUREPROC, (GLenum target, GLuint texture), (target, texture), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(DeleteTextures, PFNGLDELETETEXTURESPROC, (GLsizei n, const GLuint *textures), (n, textures), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(GenTextures, PFNGLGENTEXTURESPROC, (GLsizei n, GLuint *textures), (n, textures), GLAD_GL_VERSION_1_1)
+GLAD_PROC(GLboolean, IsTexture, PFNGLISTEXTUREPROC, (GLuint texture), (texture), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(ArrayElement, PFNGLARRAYELEMENTPROC, (GLint i), (i), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(ColorPointer, PFNGLCOLORPOINTERPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(DisableClientState, PFNGLDISABLECLIENTSTATEPROC, (GLenum array), (array), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(EdgeFlagPointer, PFNGLEDGEFLAGPOINTERPROC, (GLsizei stride, const void *pointer), (stride, pointer), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(EnableClientState, PFNGLENABLECLIENTSTATEPROC, (GLenum array), (array), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(IndexPointer, PFNGLINDEXPOINTERPROC, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(InterleavedArrays, PFNGLINTERLEAVEDARRAYSPROC, (GLenum format, GLsizei stride, const void *pointer), (format, stride, pointer), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(NormalPointer, PFNGLNORMALPOINTERPROC, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(TexCoordPointer, PFNGLTEXCOORDPOINTERPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(VertexPointer, PFNGLVERTEXPOINTERPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer), GLAD_GL_VERSION_1_1)
+GLAD_PROC(GLboolean, AreTexturesResident, PFNGLARETEXTURESRESIDENTPROC, (GLsizei n, const GLuint *textures, GLboolean *residences), (n, textures, residences), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(PrioritizeTextures, PFNGLPRIORITIZETEXTURESPROC, (GLsizei n, const GLuint *textures, const GLfloat *priorities), (n, textures, priorities), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(Indexub, PFNGLINDEXUBPROC, (GLubyte c), (c), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(Indexubv, PFNGLINDEXUBVPROC, (const GLubyte *c), (c), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(PopClientAttrib, PFNGLPOPCLIENTATTRIBPROC, (void), (), GLAD_GL_VERSION_1_1)
+GLAD_PROC_VOID(PushClientAttrib, PFNGLPUSHCLIENTATTRIBPROC, (GLbitfield mask), (mask), GLAD_GL_VERSION_1_1)
+
+GLAD_FEATURE(GLAD_GL_VERSION_1_2)
+GLAD_PROC_VOID(DrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices), (mode, start, end, count, type, indices), GLAD_GL_VERSION_1_2)
+GLAD_PROC_VOID(TexImage3D, PFNGLTEXIMAGE3DPROC, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels), GLAD_GL_VERSION_1_2)
+GLAD_PROC_VOID(TexSubImage3D, PFNGLTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels), GLAD_GL_VERSION_1_2)
+GLAD_PROC_VOID(CopyTexSubImage3D, PFNGLCOPYTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height), GLAD_GL_VERSION_1_2)
+
+GLAD_FEATURE(GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(ActiveTexture, PFNGLACTIVETEXTUREPROC, (GLenum texture), (texture), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(SampleCoverage, PFNGLSAMPLECOVERAGEPROC, (GLfloat value, GLboolean invert), (value, invert), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(CompressedTexImage3D, PFNGLCOMPRESSEDTEXIMAGE3DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, depth, border, imageSize, data), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(CompressedTexImage2D, PFNGLCOMPRESSEDTEXIMAGE2DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, height, border, imageSize, data), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(CompressedTexImage1D, PFNGLCOMPRESSEDTEXIMAGE1DPROC, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data), (target, level, internalformat, width, border, imageSize, data), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(CompressedTexSubImage3D, PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(CompressedTexSubImage2D, PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, yoffset, width, height, format, imageSize, data), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(CompressedTexSubImage1D, PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (target, level, xoffset, width, format, imageSize, data), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(GetCompressedTexImage, PFNGLGETCOMPRESSEDTEXIMAGEPROC, (GLenum target, GLint level, void *img), (target, level, img), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(ClientActiveTexture, PFNGLCLIENTACTIVETEXTUREPROC, (GLenum texture), (texture), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord1d, PFNGLMULTITEXCOORD1DPROC, (GLenum target, GLdouble s), (target, s), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord1dv, PFNGLMULTITEXCOORD1DVPROC, (GLenum target, const GLdouble *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord1f, PFNGLMULTITEXCOORD1FPROC, (GLenum target, GLfloat s), (target, s), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord1fv, PFNGLMULTITEXCOORD1FVPROC, (GLenum target, const GLfloat *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord1i, PFNGLMULTITEXCOORD1IPROC, (GLenum target, GLint s), (target, s), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord1iv, PFNGLMULTITEXCOORD1IVPROC, (GLenum target, const GLint *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord1s, PFNGLMULTITEXCOORD1SPROC, (GLenum target, GLshort s), (target, s), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord1sv, PFNGLMULTITEXCOORD1SVPROC, (GLenum target, const GLshort *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord2d, PFNGLMULTITEXCOORD2DPROC, (GLenum target, GLdouble s, GLdouble t), (target, s, t), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord2dv, PFNGLMULTITEXCOORD2DVPROC, (GLenum target, const GLdouble *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord2f, PFNGLMULTITEXCOORD2FPROC, (GLenum target, GLfloat s, GLfloat t), (target, s, t), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord2fv, PFNGLMULTITEXCOORD2FVPROC, (GLenum target, const GLfloat *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord2i, PFNGLMULTITEXCOORD2IPROC, (GLenum target, GLint s, GLint t), (target, s, t), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord2iv, PFNGLMULTITEXCOORD2IVPROC, (GLenum target, const GLint *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord2s, PFNGLMULTITEXCOORD2SPROC, (GLenum target, GLshort s, GLshort t), (target, s, t), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord2sv, PFNGLMULTITEXCOORD2SVPROC, (GLenum target, const GLshort *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord3d, PFNGLMULTITEXCOORD3DPROC, (GLenum target, GLdouble s, GLdouble t, GLdouble r), (target, s, t, r), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord3dv, PFNGLMULTITEXCOORD3DVPROC, (GLenum target, const GLdouble *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord3f, PFNGLMULTITEXCOORD3FPROC, (GLenum target, GLfloat s, GLfloat t, GLfloat r), (target, s, t, r), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord3fv, PFNGLMULTITEXCOORD3FVPROC, (GLenum target, const GLfloat *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord3i, PFNGLMULTITEXCOORD3IPROC, (GLenum target, GLint s, GLint t, GLint r), (target, s, t, r), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord3iv, PFNGLMULTITEXCOORD3IVPROC, (GLenum target, const GLint *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord3s, PFNGLMULTITEXCOORD3SPROC, (GLenum target, GLshort s, GLshort t, GLshort r), (target, s, t, r), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord3sv, PFNGLMULTITEXCOORD3SVPROC, (GLenum target, const GLshort *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord4d, PFNGLMULTITEXCOORD4DPROC, (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q), (target, s, t, r, q), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord4dv, PFNGLMULTITEXCOORD4DVPROC, (GLenum target, const GLdouble *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord4f, PFNGLMULTITEXCOORD4FPROC, (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q), (target, s, t, r, q), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord4fv, PFNGLMULTITEXCOORD4FVPROC, (GLenum target, const GLfloat *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord4i, PFNGLMULTITEXCOORD4IPROC, (GLenum target, GLint s, GLint t, GLint r, GLint q), (target, s, t, r, q), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord4iv, PFNGLMULTITEXCOORD4IVPROC, (GLenum target, const GLint *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord4s, PFNGLMULTITEXCOORD4SPROC, (GLenum target, GLshort s, GLshort t, GLshort r, GLshort q), (target, s, t, r, q), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultiTexCoord4sv, PFNGLMULTITEXCOORD4SVPROC, (GLenum target, const GLshort *v), (target, v), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(LoadTransposeMatrixf, PFNGLLOADTRANSPOSEMATRIXFPROC, (const GLfloat *m), (m), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(LoadTransposeMatrixd, PFNGLLOADTRANSPOSEMATRIXDPROC, (const GLdouble *m), (m), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultTransposeMatrixf, PFNGLMULTTRANSPOSEMATRIXFPROC, (const GLfloat *m), (m), GLAD_GL_VERSION_1_3)
+GLAD_PROC_VOID(MultTransposeMatrixd, PFNGLMULTTRANSPOSEMATRIXDPROC, (const GLdouble *m), (m), GLAD_GL_VERSION_1_3)
+
+GLAD_FEATURE(GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(BlendFuncSeparate, PFNGLBLENDFUNCSEPARATEPROC, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(MultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC, (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount), (mode, first, count, drawcount), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(MultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount), (mode, count, type, indices, drawcount), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(PointParameterf, PFNGLPOINTPARAMETERFPROC, (GLenum pname, GLfloat param), (pname, param), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(PointParameterfv, PFNGLPOINTPARAMETERFVPROC, (GLenum pname, const GLfloat *params), (pname, params), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(PointParameteri, PFNGLPOINTPARAMETERIPROC, (GLenum pname, GLint param), (pname, param), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(PointParameteriv, PFNGLPOINTPARAMETERIVPROC, (GLenum pname, const GLint *params), (pname, params), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(FogCoordf, PFNGLFOGCOORDFPROC, (GLfloat coord), (coord), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(FogCoordfv, PFNGLFOGCOORDFVPROC, (const GLfloat *coord), (coord), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(FogCoordd, PFNGLFOGCOORDDPROC, (GLdouble coord), (coord), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(FogCoorddv, PFNGLFOGCOORDDVPROC, (const GLdouble *coord), (coord), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(FogCoordPointer, PFNGLFOGCOORDPOINTERPROC, (GLenum type, GLsizei stride, const void *pointer), (type, stride, pointer), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3b, PFNGLSECONDARYCOLOR3BPROC, (GLbyte red, GLbyte green, GLbyte blue), (red, green, blue), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3bv, PFNGLSECONDARYCOLOR3BVPROC, (const GLbyte *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3d, PFNGLSECONDARYCOLOR3DPROC, (GLdouble red, GLdouble green, GLdouble blue), (red, green, blue), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3dv, PFNGLSECONDARYCOLOR3DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3f, PFNGLSECONDARYCOLOR3FPROC, (GLfloat red, GLfloat green, GLfloat blue), (red, green, blue), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3fv, PFNGLSECONDARYCOLOR3FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3i, PFNGLSECONDARYCOLOR3IPROC, (GLint red, GLint green, GLint blue), (red, green, blue), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3iv, PFNGLSECONDARYCOLOR3IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3s, PFNGLSECONDARYCOLOR3SPROC, (GLshort red, GLshort green, GLshort blue), (red, green, blue), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3sv, PFNGLSECONDARYCOLOR3SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3ub, PFNGLSECONDARYCOLOR3UBPROC, (GLubyte red, GLubyte green, GLubyte blue), (red, green, blue), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3ubv, PFNGLSECONDARYCOLOR3UBVPROC, (const GLubyte *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3ui, PFNGLSECONDARYCOLOR3UIPROC, (GLuint red, GLuint green, GLuint blue), (red, green, blue), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3uiv, PFNGLSECONDARYCOLOR3UIVPROC, (const GLuint *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3us, PFNGLSECONDARYCOLOR3USPROC, (GLushort red, GLushort green, GLushort blue), (red, green, blue), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColor3usv, PFNGLSECONDARYCOLOR3USVPROC, (const GLushort *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(SecondaryColorPointer, PFNGLSECONDARYCOLORPOINTERPROC, (GLint size, GLenum type, GLsizei stride, const void *pointer), (size, type, stride, pointer), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos2d, PFNGLWINDOWPOS2DPROC, (GLdouble x, GLdouble y), (x, y), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos2dv, PFNGLWINDOWPOS2DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos2f, PFNGLWINDOWPOS2FPROC, (GLfloat x, GLfloat y), (x, y), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos2fv, PFNGLWINDOWPOS2FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos2i, PFNGLWINDOWPOS2IPROC, (GLint x, GLint y), (x, y), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos2iv, PFNGLWINDOWPOS2IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos2s, PFNGLWINDOWPOS2SPROC, (GLshort x, GLshort y), (x, y), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos2sv, PFNGLWINDOWPOS2SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos3d, PFNGLWINDOWPOS3DPROC, (GLdouble x, GLdouble y, GLdouble z), (x, y, z), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos3dv, PFNGLWINDOWPOS3DVPROC, (const GLdouble *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos3f, PFNGLWINDOWPOS3FPROC, (GLfloat x, GLfloat y, GLfloat z), (x, y, z), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos3fv, PFNGLWINDOWPOS3FVPROC, (const GLfloat *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos3i, PFNGLWINDOWPOS3IPROC, (GLint x, GLint y, GLint z), (x, y, z), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos3iv, PFNGLWINDOWPOS3IVPROC, (const GLint *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos3s, PFNGLWINDOWPOS3SPROC, (GLshort x, GLshort y, GLshort z), (x, y, z), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(WindowPos3sv, PFNGLWINDOWPOS3SVPROC, (const GLshort *v), (v), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(BlendColor, PFNGLBLENDCOLORPROC, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha), GLAD_GL_VERSION_1_4)
+GLAD_PROC_VOID(BlendEquation, PFNGLBLENDEQUATIONPROC, (GLenum mode), (mode), GLAD_GL_VERSION_1_4)
+
+GLAD_FEATURE(GLAD_GL_VERSION_1_5)
+GLAD_PROC_VOID(GenQueries, PFNGLGENQUERIESPROC, (GLsizei n, GLuint *ids), (n, ids), GLAD_GL_VERSION_1_5)
+GLAD_PROC_VOID(DeleteQueries, PFNGLDELETEQUERIESPROC, (GLsizei n, const GLuint *ids), (n, ids), GLAD_GL_VERSION_1_5)
+GLAD_PROC(GLboolean, IsQuery, PFNGLISQUERYPROC, (GLuint id), (id), GLAD_GL_VERSION_1_5)
+GLAD_PROC_VOID(BeginQuery, PFNGLBEGINQUERYPROC, (GLenum target, GLuint id), (target, id), GLAD_GL_VERSION_1_5)
+GLAD_PROC_VOID(EndQuery, PFNGLENDQUERYPROC, (GLenum target), (target), GLAD_GL_VERSION_1_5)
+GLAD_PROC_VOID(GetQueryiv, PFNGLGETQUERYIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLAD_GL_VERSION_1_5)
+GLAD_PROC_VOID(GetQueryObjectiv, PFNGLGETQUERYOBJECTIVPROC, (GLuint id, GLenum pname, GLint *params), (id, pname, params), GLAD_GL_VERSION_1_5)
+GLAD_PROC_VOID(GetQueryObjectuiv, PFNGLGETQUERYOBJECTUIVPROC, (GLuint id, GLenum pname, GLuint *params), (id, pname, params), GLAD_GL_VERSION_1_5)
+GLAD_PROC_VOID(BindBuffer, PFNGLBINDBUFFERPROC, (GLenum target, GLuint buffer), (target, buffer), GLAD_GL_VERSION_1_5)
+GLAD_PROC_VOID(DeleteBuffers, PFNGLDELETEBUFFERSPROC, (GLsizei n, const GLuint *buffers), (n, buffers), GLAD_GL_VERSION_1_5)
+GLAD_PROC_VOID(GenBuffers, PFNGLGENBUFFERSPROC, (GLsizei n, GLuint *buffers), (n, buffers), GLAD_GL_VERSION_1_5)
+GLAD_PROC(GLboolean, IsBuffer, PFNGLISBUFFERPROC, (GLuint buffer), (buffer), GLAD_GL_VERSION_1_5)
+GLAD_PROC_VOID(BufferData, PFNGLBUFFERDATAPROC, (GLenum target, GLsizeiptr size, const void *data, GLenum usage), (target, size, data, usage), GLAD_GL_VERSION_1_5)
+GLAD_PROC_VOID(BufferSubData, PFNGLBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, const void *data), (target, offset, size, data), GLAD_GL_VERSION_1_5)
+GLAD_PROC_VOID(GetBufferSubData, PFNGLGETBUFFERSUBDATAPROC, (GLenum target, GLintptr offset, GLsizeiptr size, void *data), (target, offset, size, data), GLAD_GL_VERSION_1_5)
+GLAD_PROC(void *, MapBuffer, PFNGLMAPBUFFERPROC, (GLenum target, GLenum access), (target, access), GLAD_GL_VERSION_1_5)
+GLAD_PROC(GLboolean, UnmapBuffer, PFNGLUNMAPBUFFERPROC, (GLenum target), (target), GLAD_GL_VERSION_1_5)
+GLAD_PROC_VOID(GetBufferParameteriv, PFNGLGETBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLAD_GL_VERSION_1_5)
+GLAD_PROC_VOID(GetBufferPointerv, PFNGLGETBUFFERPOINTERVPROC, (GLenum target, GLenum pname, void **params), (target, pname, params), GLAD_GL_VERSION_1_5)
+
+GLAD_FEATURE(GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(BlendEquationSeparate, PFNGLBLENDEQUATIONSEPARATEPROC, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(DrawBuffers, PFNGLDRAWBUFFERSPROC, (GLsizei n, const GLenum *bufs), (n, bufs), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(StencilOpSeparate, PFNGLSTENCILOPSEPARATEPROC, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(StencilFuncSeparate, PFNGLSTENCILFUNCSEPARATEPROC, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(StencilMaskSeparate, PFNGLSTENCILMASKSEPARATEPROC, (GLenum face, GLuint mask), (face, mask), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(AttachShader, PFNGLATTACHSHADERPROC, (GLuint program, GLuint shader), (program, shader), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(BindAttribLocation, PFNGLBINDATTRIBLOCATIONPROC, (GLuint program, GLuint index, const GLchar *name), (program, index, name), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(CompileShader, PFNGLCOMPILESHADERPROC, (GLuint shader), (shader), GLAD_GL_VERSION_2_0)
+GLAD_PROC(GLuint, CreateProgram, PFNGLCREATEPROGRAMPROC, (void), (), GLAD_GL_VERSION_2_0)
+GLAD_PROC(GLuint, CreateShader, PFNGLCREATESHADERPROC, (GLenum type), (type), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(DeleteProgram, PFNGLDELETEPROGRAMPROC, (GLuint program), (program), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(DeleteShader, PFNGLDELETESHADERPROC, (GLuint shader), (shader), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(DetachShader, PFNGLDETACHSHADERPROC, (GLuint program, GLuint shader), (program, shader), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(DisableVertexAttribArray, PFNGLDISABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(EnableVertexAttribArray, PFNGLENABLEVERTEXATTRIBARRAYPROC, (GLuint index), (index), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(GetActiveAttrib, PFNGLGETACTIVEATTRIBPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(GetActiveUniform, PFNGLGETACTIVEUNIFORMPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(GetAttachedShaders, PFNGLGETATTACHEDSHADERSPROC, (GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders), (program, maxCount, count, shaders), GLAD_GL_VERSION_2_0)
+GLAD_PROC(GLint, GetAttribLocation, PFNGLGETATTRIBLOCATIONPROC, (GLuint program, const GLchar *name), (program, name), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(GetProgramiv, PFNGLGETPROGRAMIVPROC, (GLuint program, GLenum pname, GLint *params), (program, pname, params), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(GetProgramInfoLog, PFNGLGETPROGRAMINFOLOGPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (program, bufSize, length, infoLog), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(GetShaderiv, PFNGLGETSHADERIVPROC, (GLuint shader, GLenum pname, GLint *params), (shader, pname, params), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(GetShaderInfoLog, PFNGLGETSHADERINFOLOGPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (shader, bufSize, length, infoLog), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(GetShaderSource, PFNGLGETSHADERSOURCEPROC, (GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source), (shader, bufSize, length, source), GLAD_GL_VERSION_2_0)
+GLAD_PROC(GLint, GetUniformLocation, PFNGLGETUNIFORMLOCATIONPROC, (GLuint program, const GLchar *name), (program, name), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(GetUniformfv, PFNGLGETUNIFORMFVPROC, (GLuint program, GLint location, GLfloat *params), (program, location, params), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(GetUniformiv, PFNGLGETUNIFORMIVPROC, (GLuint program, GLint location, GLint *params), (program, location, params), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(GetVertexAttribdv, PFNGLGETVERTEXATTRIBDVPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(GetVertexAttribfv, PFNGLGETVERTEXATTRIBFVPROC, (GLuint index, GLenum pname, GLfloat *params), (index, pname, params), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(GetVertexAttribiv, PFNGLGETVERTEXATTRIBIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(GetVertexAttribPointerv, PFNGLGETVERTEXATTRIBPOINTERVPROC, (GLuint index, GLenum pname, void **pointer), (index, pname, pointer), GLAD_GL_VERSION_2_0)
+GLAD_PROC(GLboolean, IsProgram, PFNGLISPROGRAMPROC, (GLuint program), (program), GLAD_GL_VERSION_2_0)
+GLAD_PROC(GLboolean, IsShader, PFNGLISSHADERPROC, (GLuint shader), (shader), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(LinkProgram, PFNGLLINKPROGRAMPROC, (GLuint program), (program), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(ShaderSource, PFNGLSHADERSOURCEPROC, (GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length), (shader, count, string, length), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(UseProgram, PFNGLUSEPROGRAMPROC, (GLuint program), (program), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform1f, PFNGLUNIFORM1FPROC, (GLint location, GLfloat v0), (location, v0), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform2f, PFNGLUNIFORM2FPROC, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform3f, PFNGLUNIFORM3FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform4f, PFNGLUNIFORM4FPROC, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform1i, PFNGLUNIFORM1IPROC, (GLint location, GLint v0), (location, v0), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform2i, PFNGLUNIFORM2IPROC, (GLint location, GLint v0, GLint v1), (location, v0, v1), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform3i, PFNGLUNIFORM3IPROC, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform4i, PFNGLUNIFORM4IPROC, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform1fv, PFNGLUNIFORM1FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform2fv, PFNGLUNIFORM2FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform3fv, PFNGLUNIFORM3FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform4fv, PFNGLUNIFORM4FVPROC, (GLint location, GLsizei count, const GLfloat *value), (location, count, value), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform1iv, PFNGLUNIFORM1IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform2iv, PFNGLUNIFORM2IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform3iv, PFNGLUNIFORM3IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(Uniform4iv, PFNGLUNIFORM4IVPROC, (GLint location, GLsizei count, const GLint *value), (location, count, value), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(UniformMatrix2fv, PFNGLUNIFORMMATRIX2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(UniformMatrix3fv, PFNGLUNIFORMMATRIX3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(UniformMatrix4fv, PFNGLUNIFORMMATRIX4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(ValidateProgram, PFNGLVALIDATEPROGRAMPROC, (GLuint program), (program), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib1d, PFNGLVERTEXATTRIB1DPROC, (GLuint index, GLdouble x), (index, x), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib1dv, PFNGLVERTEXATTRIB1DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib1f, PFNGLVERTEXATTRIB1FPROC, (GLuint index, GLfloat x), (index, x), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib1fv, PFNGLVERTEXATTRIB1FVPROC, (GLuint index, const GLfloat *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib1s, PFNGLVERTEXATTRIB1SPROC, (GLuint index, GLshort x), (index, x), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib1sv, PFNGLVERTEXATTRIB1SVPROC, (GLuint index, const GLshort *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib2d, PFNGLVERTEXATTRIB2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib2dv, PFNGLVERTEXATTRIB2DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib2f, PFNGLVERTEXATTRIB2FPROC, (GLuint index, GLfloat x, GLfloat y), (index, x, y), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib2fv, PFNGLVERTEXATTRIB2FVPROC, (GLuint index, const GLfloat *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib2s, PFNGLVERTEXATTRIB2SPROC, (GLuint index, GLshort x, GLshort y), (index, x, y), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib2sv, PFNGLVERTEXATTRIB2SVPROC, (GLuint index, const GLshort *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib3d, PFNGLVERTEXATTRIB3DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib3dv, PFNGLVERTEXATTRIB3DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib3f, PFNGLVERTEXATTRIB3FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib3fv, PFNGLVERTEXATTRIB3FVPROC, (GLuint index, const GLfloat *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib3s, PFNGLVERTEXATTRIB3SPROC, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib3sv, PFNGLVERTEXATTRIB3SVPROC, (GLuint index, const GLshort *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4Nbv, PFNGLVERTEXATTRIB4NBVPROC, (GLuint index, const GLbyte *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4Niv, PFNGLVERTEXATTRIB4NIVPROC, (GLuint index, const GLint *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4Nsv, PFNGLVERTEXATTRIB4NSVPROC, (GLuint index, const GLshort *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4Nub, PFNGLVERTEXATTRIB4NUBPROC, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4Nubv, PFNGLVERTEXATTRIB4NUBVPROC, (GLuint index, const GLubyte *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4Nuiv, PFNGLVERTEXATTRIB4NUIVPROC, (GLuint index, const GLuint *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4Nusv, PFNGLVERTEXATTRIB4NUSVPROC, (GLuint index, const GLushort *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4bv, PFNGLVERTEXATTRIB4BVPROC, (GLuint index, const GLbyte *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4d, PFNGLVERTEXATTRIB4DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4dv, PFNGLVERTEXATTRIB4DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4f, PFNGLVERTEXATTRIB4FPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4fv, PFNGLVERTEXATTRIB4FVPROC, (GLuint index, const GLfloat *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4iv, PFNGLVERTEXATTRIB4IVPROC, (GLuint index, const GLint *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4s, PFNGLVERTEXATTRIB4SPROC, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4sv, PFNGLVERTEXATTRIB4SVPROC, (GLuint index, const GLshort *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4ubv, PFNGLVERTEXATTRIB4UBVPROC, (GLuint index, const GLubyte *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4uiv, PFNGLVERTEXATTRIB4UIVPROC, (GLuint index, const GLuint *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttrib4usv, PFNGLVERTEXATTRIB4USVPROC, (GLuint index, const GLushort *v), (index, v), GLAD_GL_VERSION_2_0)
+GLAD_PROC_VOID(VertexAttribPointer, PFNGLVERTEXATTRIBPOINTERPROC, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer), (index, size, type, normalized, stride, pointer), GLAD_GL_VERSION_2_0)
+
+GLAD_FEATURE(GLAD_GL_VERSION_2_1)
+GLAD_PROC_VOID(UniformMatrix2x3fv, PFNGLUNIFORMMATRIX2X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_GL_VERSION_2_1)
+GLAD_PROC_VOID(UniformMatrix3x2fv, PFNGLUNIFORMMATRIX3X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_GL_VERSION_2_1)
+GLAD_PROC_VOID(UniformMatrix2x4fv, PFNGLUNIFORMMATRIX2X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_GL_VERSION_2_1)
+GLAD_PROC_VOID(UniformMatrix4x2fv, PFNGLUNIFORMMATRIX4X2FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_GL_VERSION_2_1)
+GLAD_PROC_VOID(UniformMatrix3x4fv, PFNGLUNIFORMMATRIX3X4FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_GL_VERSION_2_1)
+GLAD_PROC_VOID(UniformMatrix4x3fv, PFNGLUNIFORMMATRIX4X3FVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (location, count, transpose, value), GLAD_GL_VERSION_2_1)
+
+GLAD_FEATURE(GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(ColorMaski, PFNGLCOLORMASKIPROC, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(GetBooleani_v, PFNGLGETBOOLEANI_VPROC, (GLenum target, GLuint index, GLboolean *data), (target, index, data), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(GetIntegeri_v, PFNGLGETINTEGERI_VPROC, (GLenum target, GLuint index, GLint *data), (target, index, data), (GLAD_GL_VERSION_3_0 || GLAD_GL_VERSION_3_1))
+GLAD_PROC_VOID(Enablei, PFNGLENABLEIPROC, (GLenum target, GLuint index), (target, index), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(Disablei, PFNGLDISABLEIPROC, (GLenum target, GLuint index), (target, index), GLAD_GL_VERSION_3_0)
+GLAD_PROC(GLboolean, IsEnabledi, PFNGLISENABLEDIPROC, (GLenum target, GLuint index), (target, index), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(BeginTransformFeedback, PFNGLBEGINTRANSFORMFEEDBACKPROC, (GLenum primitiveMode), (primitiveMode), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(EndTransformFeedback, PFNGLENDTRANSFORMFEEDBACKPROC, (void), (), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(BindBufferRange, PFNGLBINDBUFFERRANGEPROC, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size), (GLAD_GL_VERSION_3_0 || GLAD_GL_VERSION_3_1))
+GLAD_PROC_VOID(BindBufferBase, PFNGLBINDBUFFERBASEPROC, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer), (GLAD_GL_VERSION_3_0 || GLAD_GL_VERSION_3_1))
+GLAD_PROC_VOID(TransformFeedbackVaryings, PFNGLTRANSFORMFEEDBACKVARYINGSPROC, (GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode), (program, count, varyings, bufferMode), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(GetTransformFeedbackVarying, PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name), (program, index, bufSize, length, size, type, name), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(ClampColor, PFNGLCLAMPCOLORPROC, (GLenum target, GLenum clamp), (target, clamp), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(BeginConditionalRender, PFNGLBEGINCONDITIONALRENDERPROC, (GLuint id, GLenum mode), (id, mode), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(EndConditionalRender, PFNGLENDCONDITIONALRENDERPROC, (void), (), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribIPointer, PFNGLVERTEXATTRIBIPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(GetVertexAttribIiv, PFNGLGETVERTEXATTRIBIIVPROC, (GLuint index, GLenum pname, GLint *params), (index, pname, params), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(GetVertexAttribIuiv, PFNGLGETVERTEXATTRIBIUIVPROC, (GLuint index, GLenum pname, GLuint *params), (index, pname, params), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI1i, PFNGLVERTEXATTRIBI1IPROC, (GLuint index, GLint x), (index, x), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI2i, PFNGLVERTEXATTRIBI2IPROC, (GLuint index, GLint x, GLint y), (index, x, y), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI3i, PFNGLVERTEXATTRIBI3IPROC, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI4i, PFNGLVERTEXATTRIBI4IPROC, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI1ui, PFNGLVERTEXATTRIBI1UIPROC, (GLuint index, GLuint x), (index, x), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI2ui, PFNGLVERTEXATTRIBI2UIPROC, (GLuint index, GLuint x, GLuint y), (index, x, y), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI3ui, PFNGLVERTEXATTRIBI3UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI4ui, PFNGLVERTEXATTRIBI4UIPROC, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI1iv, PFNGLVERTEXATTRIBI1IVPROC, (GLuint index, const GLint *v), (index, v), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI2iv, PFNGLVERTEXATTRIBI2IVPROC, (GLuint index, const GLint *v), (index, v), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI3iv, PFNGLVERTEXATTRIBI3IVPROC, (GLuint index, const GLint *v), (index, v), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI4iv, PFNGLVERTEXATTRIBI4IVPROC, (GLuint index, const GLint *v), (index, v), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI1uiv, PFNGLVERTEXATTRIBI1UIVPROC, (GLuint index, const GLuint *v), (index, v), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI2uiv, PFNGLVERTEXATTRIBI2UIVPROC, (GLuint index, const GLuint *v), (index, v), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI3uiv, PFNGLVERTEXATTRIBI3UIVPROC, (GLuint index, const GLuint *v), (index, v), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI4uiv, PFNGLVERTEXATTRIBI4UIVPROC, (GLuint index, const GLuint *v), (index, v), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI4bv, PFNGLVERTEXATTRIBI4BVPROC, (GLuint index, const GLbyte *v), (index, v), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI4sv, PFNGLVERTEXATTRIBI4SVPROC, (GLuint index, const GLshort *v), (index, v), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI4ubv, PFNGLVERTEXATTRIBI4UBVPROC, (GLuint index, const GLubyte *v), (index, v), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(VertexAttribI4usv, PFNGLVERTEXATTRIBI4USVPROC, (GLuint index, const GLushort *v), (index, v), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(GetUniformuiv, PFNGLGETUNIFORMUIVPROC, (GLuint program, GLint location, GLuint *params), (program, location, params), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(BindFragDataLocation, PFNGLBINDFRAGDATALOCATIONPROC, (GLuint program, GLuint color, const GLchar *name), (program, color, name), GLAD_GL_VERSION_3_0)
+GLAD_PROC(GLint, GetFragDataLocation, PFNGLGETFRAGDATALOCATIONPROC, (GLuint program, const GLchar *name), (program, name), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(Uniform1ui, PFNGLUNIFORM1UIPROC, (GLint location, GLuint v0), (location, v0), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(Uniform2ui, PFNGLUNIFORM2UIPROC, (GLint location, GLuint v0, GLuint v1), (location, v0, v1), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(Uniform3ui, PFNGLUNIFORM3UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(Uniform4ui, PFNGLUNIFORM4UIPROC, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(Uniform1uiv, PFNGLUNIFORM1UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(Uniform2uiv, PFNGLUNIFORM2UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(Uniform3uiv, PFNGLUNIFORM3UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(Uniform4uiv, PFNGLUNIFORM4UIVPROC, (GLint location, GLsizei count, const GLuint *value), (location, count, value), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(TexParameterIiv, PFNGLTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, const GLint *params), (target, pname, params), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(TexParameterIuiv, PFNGLTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, const GLuint *params), (target, pname, params), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(GetTexParameterIiv, PFNGLGETTEXPARAMETERIIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(GetTexParameterIuiv, PFNGLGETTEXPARAMETERIUIVPROC, (GLenum target, GLenum pname, GLuint *params), (target, pname, params), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(ClearBufferiv, PFNGLCLEARBUFFERIVPROC, (GLenum buffer, GLint drawbuffer, const GLint *value), (buffer, drawbuffer, value), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(ClearBufferuiv, PFNGLCLEARBUFFERUIVPROC, (GLenum buffer, GLint drawbuffer, const GLuint *value), (buffer, drawbuffer, value), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(ClearBufferfv, PFNGLCLEARBUFFERFVPROC, (GLenum buffer, GLint drawbuffer, const GLfloat *value), (buffer, drawbuffer, value), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(ClearBufferfi, PFNGLCLEARBUFFERFIPROC, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil), GLAD_GL_VERSION_3_0)
+GLAD_PROC(const GLubyte *, GetStringi, PFNGLGETSTRINGIPROC, (GLenum name, GLuint index), (name, index), GLAD_GL_VERSION_3_0)
+GLAD_PROC(GLboolean, IsRenderbuffer, PFNGLISRENDERBUFFERPROC, (GLuint renderbuffer), (renderbuffer), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(BindRenderbuffer, PFNGLBINDRENDERBUFFERPROC, (GLenum target, GLuint renderbuffer), (target, renderbuffer), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(DeleteRenderbuffers, PFNGLDELETERENDERBUFFERSPROC, (GLsizei n, const GLuint *renderbuffers), (n, renderbuffers), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(GenRenderbuffers, PFNGLGENRENDERBUFFERSPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(RenderbufferStorage, PFNGLRENDERBUFFERSTORAGEPROC, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(GetRenderbufferParameteriv, PFNGLGETRENDERBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLAD_GL_VERSION_3_0)
+GLAD_PROC(GLboolean, IsFramebuffer, PFNGLISFRAMEBUFFERPROC, (GLuint framebuffer), (framebuffer), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(BindFramebuffer, PFNGLBINDFRAMEBUFFERPROC, (GLenum target, GLuint framebuffer), (target, framebuffer), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(DeleteFramebuffers, PFNGLDELETEFRAMEBUFFERSPROC, (GLsizei n, const GLuint *framebuffers), (n, framebuffers), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(GenFramebuffers, PFNGLGENFRAMEBUFFERSPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers), GLAD_GL_VERSION_3_0)
+GLAD_PROC(GLenum, CheckFramebufferStatus, PFNGLCHECKFRAMEBUFFERSTATUSPROC, (GLenum target), (target), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(FramebufferTexture1D, PFNGLFRAMEBUFFERTEXTURE1DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(FramebufferTexture2D, PFNGLFRAMEBUFFERTEXTURE2DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(FramebufferTexture3D, PFNGLFRAMEBUFFERTEXTURE3DPROC, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(FramebufferRenderbuffer, PFNGLFRAMEBUFFERRENDERBUFFERPROC, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(GetFramebufferAttachmentParameteriv, PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLenum target, GLenum attachment, GLenum pname, GLint *params), (target, attachment, pname, params), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(GenerateMipmap, PFNGLGENERATEMIPMAPPROC, (GLenum target), (target), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(BlitFramebuffer, PFNGLBLITFRAMEBUFFERPROC, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(RenderbufferStorageMultisample, PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(FramebufferTextureLayer, PFNGLFRAMEBUFFERTEXTURELAYERPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer), GLAD_GL_VERSION_3_0)
+GLAD_PROC(void *, MapBufferRange, PFNGLMAPBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(FlushMappedBufferRange, PFNGLFLUSHMAPPEDBUFFERRANGEPROC, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(BindVertexArray, PFNGLBINDVERTEXARRAYPROC, (GLuint array), (array), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(DeleteVertexArrays, PFNGLDELETEVERTEXARRAYSPROC, (GLsizei n, const GLuint *arrays), (n, arrays), GLAD_GL_VERSION_3_0)
+GLAD_PROC_VOID(GenVertexArrays, PFNGLGENVERTEXARRAYSPROC, (GLsizei n, GLuint *arrays), (n, arrays), GLAD_GL_VERSION_3_0)
+GLAD_PROC(GLboolean, IsVertexArray, PFNGLISVERTEXARRAYPROC, (GLuint array), (array), GLAD_GL_VERSION_3_0)
+
+GLAD_FEATURE(GLAD_GL_VERSION_3_1)
+GLAD_PROC_VOID(DrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount), GLAD_GL_VERSION_3_1)
+GLAD_PROC_VOID(DrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount), (mode, count, type, indices, instancecount), GLAD_GL_VERSION_3_1)
+GLAD_PROC_VOID(TexBuffer, PFNGLTEXBUFFERPROC, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer), GLAD_GL_VERSION_3_1)
+GLAD_PROC_VOID(PrimitiveRestartIndex, PFNGLPRIMITIVERESTARTINDEXPROC, (GLuint index), (index), GLAD_GL_VERSION_3_1)
+GLAD_PROC_VOID(CopyBufferSubData, PFNGLCOPYBUFFERSUBDATAPROC, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size), GLAD_GL_VERSION_3_1)
+GLAD_PROC_VOID(GetUniformIndices, PFNGLGETUNIFORMINDICESPROC, (GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices), (program, uniformCount, uniformNames, uniformIndices), GLAD_GL_VERSION_3_1)
+GLAD_PROC_VOID(GetActiveUniformsiv, PFNGLGETACTIVEUNIFORMSIVPROC, (GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params), (program, uniformCount, uniformIndices, pname, params), GLAD_GL_VERSION_3_1)
+GLAD_PROC_VOID(GetActiveUniformName, PFNGLGETACTIVEUNIFORMNAMEPROC, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName), (program, uniformIndex, bufSize, length, uniformName), GLAD_GL_VERSION_3_1)
+GLAD_PROC(GLuint, GetUniformBlockIndex, PFNGLGETUNIFORMBLOCKINDEXPROC, (GLuint program, const GLchar *uniformBlockName), (program, uniformBlockName), GLAD_GL_VERSION_3_1)
+GLAD_PROC_VOID(GetActiveUniformBlockiv, PFNGLGETACTIVEUNIFORMBLOCKIVPROC, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params), (program, uniformBlockIndex, pname, params), GLAD_GL_VERSION_3_1)
+GLAD_PROC_VOID(GetActiveUniformBlockName, PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName), GLAD_GL_VERSION_3_1)
+GLAD_PROC_VOID(UniformBlockBinding, PFNGLUNIFORMBLOCKBINDINGPROC, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding), GLAD_GL_VERSION_3_1)
+
+GLAD_FEATURE(GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(DrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, count, type, indices, basevertex), GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(DrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex), GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(DrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex), GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(MultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex), (mode, count, type, indices, drawcount, basevertex), GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(ProvokingVertex, PFNGLPROVOKINGVERTEXPROC, (GLenum mode), (mode), GLAD_GL_VERSION_3_2)
+GLAD_PROC(GLsync, FenceSync, PFNGLFENCESYNCPROC, (GLenum condition, GLbitfield flags), (condition, flags), GLAD_GL_VERSION_3_2)
+GLAD_PROC(GLboolean, IsSync, PFNGLISSYNCPROC, (GLsync sync), (sync), GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(DeleteSync, PFNGLDELETESYNCPROC, (GLsync sync), (sync), GLAD_GL_VERSION_3_2)
+GLAD_PROC(GLenum, ClientWaitSync, PFNGLCLIENTWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout), GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(WaitSync, PFNGLWAITSYNCPROC, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout), GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(GetInteger64v, PFNGLGETINTEGER64VPROC, (GLenum pname, GLint64 *data), (pname, data), GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(GetSynciv, PFNGLGETSYNCIVPROC, (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values), (sync, pname, bufSize, length, values), GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(GetInteger64i_v, PFNGLGETINTEGER64I_VPROC, (GLenum target, GLuint index, GLint64 *data), (target, index, data), GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(GetBufferParameteri64v, PFNGLGETBUFFERPARAMETERI64VPROC, (GLenum target, GLenum pname, GLint64 *params), (target, pname, params), GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(FramebufferTexture, PFNGLFRAMEBUFFERTEXTUREPROC, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level), GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(TexImage2DMultisample, PFNGLTEXIMAGE2DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations), GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(TexImage3DMultisample, PFNGLTEXIMAGE3DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations), GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(GetMultisamplefv, PFNGLGETMULTISAMPLEFVPROC, (GLenum pname, GLuint index, GLfloat *val), (pname, index, val), GLAD_GL_VERSION_3_2)
+GLAD_PROC_VOID(SampleMaski, PFNGLSAMPLEMASKIPROC, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask), GLAD_GL_VERSION_3_2)
+
+GLAD_FEATURE(GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(BindFragDataLocationIndexed, PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name), (program, colorNumber, index, name), GLAD_GL_VERSION_3_3)
+GLAD_PROC(GLint, GetFragDataIndex, PFNGLGETFRAGDATAINDEXPROC, (GLuint program, const GLchar *name), (program, name), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(GenSamplers, PFNGLGENSAMPLERSPROC, (GLsizei count, GLuint *samplers), (count, samplers), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(DeleteSamplers, PFNGLDELETESAMPLERSPROC, (GLsizei count, const GLuint *samplers), (count, samplers), GLAD_GL_VERSION_3_3)
+GLAD_PROC(GLboolean, IsSampler, PFNGLISSAMPLERPROC, (GLuint sampler), (sampler), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(BindSampler, PFNGLBINDSAMPLERPROC, (GLuint unit, GLuint sampler), (unit, sampler), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(SamplerParameteri, PFNGLSAMPLERPARAMETERIPROC, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(SamplerParameteriv, PFNGLSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(SamplerParameterf, PFNGLSAMPLERPARAMETERFPROC, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(SamplerParameterfv, PFNGLSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, const GLfloat *param), (sampler, pname, param), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(SamplerParameterIiv, PFNGLSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, const GLint *param), (sampler, pname, param), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(SamplerParameterIuiv, PFNGLSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, const GLuint *param), (sampler, pname, param), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(GetSamplerParameteriv, PFNGLGETSAMPLERPARAMETERIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(GetSamplerParameterIiv, PFNGLGETSAMPLERPARAMETERIIVPROC, (GLuint sampler, GLenum pname, GLint *params), (sampler, pname, params), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(GetSamplerParameterfv, PFNGLGETSAMPLERPARAMETERFVPROC, (GLuint sampler, GLenum pname, GLfloat *params), (sampler, pname, params), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(GetSamplerParameterIuiv, PFNGLGETSAMPLERPARAMETERIUIVPROC, (GLuint sampler, GLenum pname, GLuint *params), (sampler, pname, params), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(QueryCounter, PFNGLQUERYCOUNTERPROC, (GLuint id, GLenum target), (id, target), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(GetQueryObjecti64v, PFNGLGETQUERYOBJECTI64VPROC, (GLuint id, GLenum pname, GLint64 *params), (id, pname, params), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(GetQueryObjectui64v, PFNGLGETQUERYOBJECTUI64VPROC, (GLuint id, GLenum pname, GLuint64 *params), (id, pname, params), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(VertexAttribDivisor, PFNGLVERTEXATTRIBDIVISORPROC, (GLuint index, GLuint divisor), (index, divisor), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(VertexAttribP1ui, PFNGLVERTEXATTRIBP1UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(VertexAttribP1uiv, PFNGLVERTEXATTRIBP1UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(VertexAttribP2ui, PFNGLVERTEXATTRIBP2UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(VertexAttribP2uiv, PFNGLVERTEXATTRIBP2UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(VertexAttribP3ui, PFNGLVERTEXATTRIBP3UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(VertexAttribP3uiv, PFNGLVERTEXATTRIBP3UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(VertexAttribP4ui, PFNGLVERTEXATTRIBP4UIPROC, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(VertexAttribP4uiv, PFNGLVERTEXATTRIBP4UIVPROC, (GLuint index, GLenum type, GLboolean normalized, const GLuint *value), (index, type, normalized, value), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(VertexP2ui, PFNGLVERTEXP2UIPROC, (GLenum type, GLuint value), (type, value), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(VertexP2uiv, PFNGLVERTEXP2UIVPROC, (GLenum type, const GLuint *value), (type, value), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(VertexP3ui, PFNGLVERTEXP3UIPROC, (GLenum type, GLuint value), (type, value), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(VertexP3uiv, PFNGLVERTEXP3UIVPROC, (GLenum type, const GLuint *value), (type, value), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(VertexP4ui, PFNGLVERTEXP4UIPROC, (GLenum type, GLuint value), (type, value), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(VertexP4uiv, PFNGLVERTEXP4UIVPROC, (GLenum type, const GLuint *value), (type, value), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(TexCoordP1ui, PFNGLTEXCOORDP1UIPROC, (GLenum type, GLuint coords), (type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(TexCoordP1uiv, PFNGLTEXCOORDP1UIVPROC, (GLenum type, const GLuint *coords), (type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(TexCoordP2ui, PFNGLTEXCOORDP2UIPROC, (GLenum type, GLuint coords), (type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(TexCoordP2uiv, PFNGLTEXCOORDP2UIVPROC, (GLenum type, const GLuint *coords), (type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(TexCoordP3ui, PFNGLTEXCOORDP3UIPROC, (GLenum type, GLuint coords), (type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(TexCoordP3uiv, PFNGLTEXCOORDP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(TexCoordP4ui, PFNGLTEXCOORDP4UIPROC, (GLenum type, GLuint coords), (type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(TexCoordP4uiv, PFNGLTEXCOORDP4UIVPROC, (GLenum type, const GLuint *coords), (type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(MultiTexCoordP1ui, PFNGLMULTITEXCOORDP1UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(MultiTexCoordP1uiv, PFNGLMULTITEXCOORDP1UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(MultiTexCoordP2ui, PFNGLMULTITEXCOORDP2UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(MultiTexCoordP2uiv, PFNGLMULTITEXCOORDP2UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(MultiTexCoordP3ui, PFNGLMULTITEXCOORDP3UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(MultiTexCoordP3uiv, PFNGLMULTITEXCOORDP3UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(MultiTexCoordP4ui, PFNGLMULTITEXCOORDP4UIPROC, (GLenum texture, GLenum type, GLuint coords), (texture, type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(MultiTexCoordP4uiv, PFNGLMULTITEXCOORDP4UIVPROC, (GLenum texture, GLenum type, const GLuint *coords), (texture, type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(NormalP3ui, PFNGLNORMALP3UIPROC, (GLenum type, GLuint coords), (type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(NormalP3uiv, PFNGLNORMALP3UIVPROC, (GLenum type, const GLuint *coords), (type, coords), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(ColorP3ui, PFNGLCOLORP3UIPROC, (GLenum type, GLuint color), (type, color), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(ColorP3uiv, PFNGLCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(ColorP4ui, PFNGLCOLORP4UIPROC, (GLenum type, GLuint color), (type, color), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(ColorP4uiv, PFNGLCOLORP4UIVPROC, (GLenum type, const GLuint *color), (type, color), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(SecondaryColorP3ui, PFNGLSECONDARYCOLORP3UIPROC, (GLenum type, GLuint color), (type, color), GLAD_GL_VERSION_3_3)
+GLAD_PROC_VOID(SecondaryColorP3uiv, PFNGLSECONDARYCOLORP3UIVPROC, (GLenum type, const GLuint *color), (type, color), GLAD_GL_VERSION_3_3)
+
+GLAD_FEATURE(GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(MinSampleShading, PFNGLMINSAMPLESHADINGPROC, (GLfloat value), (value), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(BlendEquationi, PFNGLBLENDEQUATIONIPROC, (GLuint buf, GLenum mode), (buf, mode), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(BlendEquationSeparatei, PFNGLBLENDEQUATIONSEPARATEIPROC, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(BlendFunci, PFNGLBLENDFUNCIPROC, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(BlendFuncSeparatei, PFNGLBLENDFUNCSEPARATEIPROC, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(DrawArraysIndirect, PFNGLDRAWARRAYSINDIRECTPROC, (GLenum mode, const void *indirect), (mode, indirect), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(DrawElementsIndirect, PFNGLDRAWELEMENTSINDIRECTPROC, (GLenum mode, GLenum type, const void *indirect), (mode, type, indirect), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(Uniform1d, PFNGLUNIFORM1DPROC, (GLint location, GLdouble x), (location, x), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(Uniform2d, PFNGLUNIFORM2DPROC, (GLint location, GLdouble x, GLdouble y), (location, x, y), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(Uniform3d, PFNGLUNIFORM3DPROC, (GLint location, GLdouble x, GLdouble y, GLdouble z), (location, x, y, z), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(Uniform4d, PFNGLUNIFORM4DPROC, (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (location, x, y, z, w), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(Uniform1dv, PFNGLUNIFORM1DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(Uniform2dv, PFNGLUNIFORM2DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(Uniform3dv, PFNGLUNIFORM3DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(Uniform4dv, PFNGLUNIFORM4DVPROC, (GLint location, GLsizei count, const GLdouble *value), (location, count, value), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(UniformMatrix2dv, PFNGLUNIFORMMATRIX2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(UniformMatrix3dv, PFNGLUNIFORMMATRIX3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(UniformMatrix4dv, PFNGLUNIFORMMATRIX4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(UniformMatrix2x3dv, PFNGLUNIFORMMATRIX2X3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(UniformMatrix2x4dv, PFNGLUNIFORMMATRIX2X4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(UniformMatrix3x2dv, PFNGLUNIFORMMATRIX3X2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(UniformMatrix3x4dv, PFNGLUNIFORMMATRIX3X4DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(UniformMatrix4x2dv, PFNGLUNIFORMMATRIX4X2DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(UniformMatrix4x3dv, PFNGLUNIFORMMATRIX4X3DVPROC, (GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (location, count, transpose, value), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(GetUniformdv, PFNGLGETUNIFORMDVPROC, (GLuint program, GLint location, GLdouble *params), (program, location, params), GLAD_GL_VERSION_4_0)
+GLAD_PROC(GLint, GetSubroutineUniformLocation, PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name), GLAD_GL_VERSION_4_0)
+GLAD_PROC(GLuint, GetSubroutineIndex, PFNGLGETSUBROUTINEINDEXPROC, (GLuint program, GLenum shadertype, const GLchar *name), (program, shadertype, name), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(GetActiveSubroutineUniformiv, PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC, (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values), (program, shadertype, index, pname, values), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(GetActiveSubroutineUniformName, PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, shadertype, index, bufSize, length, name), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(GetActiveSubroutineName, PFNGLGETACTIVESUBROUTINENAMEPROC, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, shadertype, index, bufSize, length, name), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(UniformSubroutinesuiv, PFNGLUNIFORMSUBROUTINESUIVPROC, (GLenum shadertype, GLsizei count, const GLuint *indices), (shadertype, count, indices), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(GetUniformSubroutineuiv, PFNGLGETUNIFORMSUBROUTINEUIVPROC, (GLenum shadertype, GLint location, GLuint *params), (shadertype, location, params), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(GetProgramStageiv, PFNGLGETPROGRAMSTAGEIVPROC, (GLuint program, GLenum shadertype, GLenum pname, GLint *values), (program, shadertype, pname, values), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(PatchParameteri, PFNGLPATCHPARAMETERIPROC, (GLenum pname, GLint value), (pname, value), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(PatchParameterfv, PFNGLPATCHPARAMETERFVPROC, (GLenum pname, const GLfloat *values), (pname, values), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(BindTransformFeedback, PFNGLBINDTRANSFORMFEEDBACKPROC, (GLenum target, GLuint id), (target, id), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(DeleteTransformFeedbacks, PFNGLDELETETRANSFORMFEEDBACKSPROC, (GLsizei n, const GLuint *ids), (n, ids), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(GenTransformFeedbacks, PFNGLGENTRANSFORMFEEDBACKSPROC, (GLsizei n, GLuint *ids), (n, ids), GLAD_GL_VERSION_4_0)
+GLAD_PROC(GLboolean, IsTransformFeedback, PFNGLISTRANSFORMFEEDBACKPROC, (GLuint id), (id), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(PauseTransformFeedback, PFNGLPAUSETRANSFORMFEEDBACKPROC, (void), (), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(ResumeTransformFeedback, PFNGLRESUMETRANSFORMFEEDBACKPROC, (void), (), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(DrawTransformFeedback, PFNGLDRAWTRANSFORMFEEDBACKPROC, (GLenum mode, GLuint id), (mode, id), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(DrawTransformFeedbackStream, PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC, (GLenum mode, GLuint id, GLuint stream), (mode, id, stream), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(BeginQueryIndexed, PFNGLBEGINQUERYINDEXEDPROC, (GLenum target, GLuint index, GLuint id), (target, index, id), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(EndQueryIndexed, PFNGLENDQUERYINDEXEDPROC, (GLenum target, GLuint index), (target, index), GLAD_GL_VERSION_4_0)
+GLAD_PROC_VOID(GetQueryIndexediv, PFNGLGETQUERYINDEXEDIVPROC, (GLenum target, GLuint index, GLenum pname, GLint *params), (target, index, pname, params), GLAD_GL_VERSION_4_0)
+
+GLAD_FEATURE(GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(ReleaseShaderCompiler, PFNGLRELEASESHADERCOMPILERPROC, (void), (), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(ShaderBinary, PFNGLSHADERBINARYPROC, (GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length), (count, shaders, binaryFormat, binary, length), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(GetShaderPrecisionFormat, PFNGLGETSHADERPRECISIONFORMATPROC, (GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision), (shadertype, precisiontype, range, precision), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(DepthRangef, PFNGLDEPTHRANGEFPROC, (GLfloat n, GLfloat f), (n, f), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(ClearDepthf, PFNGLCLEARDEPTHFPROC, (GLfloat d), (d), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(GetProgramBinary, PFNGLGETPROGRAMBINARYPROC, (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary), (program, bufSize, length, binaryFormat, binary), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_get_program_binary))
+GLAD_PROC_VOID(ProgramBinary, PFNGLPROGRAMBINARYPROC, (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length), (program, binaryFormat, binary, length), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_get_program_binary))
+GLAD_PROC_VOID(ProgramParameteri, PFNGLPROGRAMPARAMETERIPROC, (GLuint program, GLenum pname, GLint value), (program, pname, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_get_program_binary || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(UseProgramStages, PFNGLUSEPROGRAMSTAGESPROC, (GLuint pipeline, GLbitfield stages, GLuint program), (pipeline, stages, program), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ActiveShaderProgram, PFNGLACTIVESHADERPROGRAMPROC, (GLuint pipeline, GLuint program), (pipeline, program), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC(GLuint, CreateShaderProgramv, PFNGLCREATESHADERPROGRAMVPROC, (GLenum type, GLsizei count, const GLchar *const*strings), (type, count, strings), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(BindProgramPipeline, PFNGLBINDPROGRAMPIPELINEPROC, (GLuint pipeline), (pipeline), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(DeleteProgramPipelines, PFNGLDELETEPROGRAMPIPELINESPROC, (GLsizei n, const GLuint *pipelines), (n, pipelines), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(GenProgramPipelines, PFNGLGENPROGRAMPIPELINESPROC, (GLsizei n, GLuint *pipelines), (n, pipelines), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC(GLboolean, IsProgramPipeline, PFNGLISPROGRAMPIPELINEPROC, (GLuint pipeline), (pipeline), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(GetProgramPipelineiv, PFNGLGETPROGRAMPIPELINEIVPROC, (GLuint pipeline, GLenum pname, GLint *params), (pipeline, pname, params), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform1i, PFNGLPROGRAMUNIFORM1IPROC, (GLuint program, GLint location, GLint v0), (program, location, v0), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform1iv, PFNGLPROGRAMUNIFORM1IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform1f, PFNGLPROGRAMUNIFORM1FPROC, (GLuint program, GLint location, GLfloat v0), (program, location, v0), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform1fv, PFNGLPROGRAMUNIFORM1FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform1d, PFNGLPROGRAMUNIFORM1DPROC, (GLuint program, GLint location, GLdouble v0), (program, location, v0), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform1dv, PFNGLPROGRAMUNIFORM1DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform1ui, PFNGLPROGRAMUNIFORM1UIPROC, (GLuint program, GLint location, GLuint v0), (program, location, v0), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform1uiv, PFNGLPROGRAMUNIFORM1UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform2i, PFNGLPROGRAMUNIFORM2IPROC, (GLuint program, GLint location, GLint v0, GLint v1), (program, location, v0, v1), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform2iv, PFNGLPROGRAMUNIFORM2IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform2f, PFNGLPROGRAMUNIFORM2FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1), (program, location, v0, v1), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform2fv, PFNGLPROGRAMUNIFORM2FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform2d, PFNGLPROGRAMUNIFORM2DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1), (program, location, v0, v1), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform2dv, PFNGLPROGRAMUNIFORM2DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform2ui, PFNGLPROGRAMUNIFORM2UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1), (program, location, v0, v1), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform2uiv, PFNGLPROGRAMUNIFORM2UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform3i, PFNGLPROGRAMUNIFORM3IPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2), (program, location, v0, v1, v2), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform3iv, PFNGLPROGRAMUNIFORM3IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform3f, PFNGLPROGRAMUNIFORM3FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (program, location, v0, v1, v2), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform3fv, PFNGLPROGRAMUNIFORM3FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform3d, PFNGLPROGRAMUNIFORM3DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2), (program, location, v0, v1, v2), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform3dv, PFNGLPROGRAMUNIFORM3DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform3ui, PFNGLPROGRAMUNIFORM3UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2), (program, location, v0, v1, v2), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform3uiv, PFNGLPROGRAMUNIFORM3UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform4i, PFNGLPROGRAMUNIFORM4IPROC, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (program, location, v0, v1, v2, v3), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform4iv, PFNGLPROGRAMUNIFORM4IVPROC, (GLuint program, GLint location, GLsizei count, const GLint *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform4f, PFNGLPROGRAMUNIFORM4FPROC, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (program, location, v0, v1, v2, v3), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform4fv, PFNGLPROGRAMUNIFORM4FVPROC, (GLuint program, GLint location, GLsizei count, const GLfloat *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform4d, PFNGLPROGRAMUNIFORM4DPROC, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3), (program, location, v0, v1, v2, v3), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform4dv, PFNGLPROGRAMUNIFORM4DVPROC, (GLuint program, GLint location, GLsizei count, const GLdouble *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform4ui, PFNGLPROGRAMUNIFORM4UIPROC, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (program, location, v0, v1, v2, v3), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniform4uiv, PFNGLPROGRAMUNIFORM4UIVPROC, (GLuint program, GLint location, GLsizei count, const GLuint *value), (program, location, count, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix2fv, PFNGLPROGRAMUNIFORMMATRIX2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix3fv, PFNGLPROGRAMUNIFORMMATRIX3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix4fv, PFNGLPROGRAMUNIFORMMATRIX4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix2dv, PFNGLPROGRAMUNIFORMMATRIX2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix3dv, PFNGLPROGRAMUNIFORMMATRIX3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix4dv, PFNGLPROGRAMUNIFORMMATRIX4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix2x3fv, PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix3x2fv, PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix2x4fv, PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix4x2fv, PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix3x4fv, PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix4x3fv, PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix2x3dv, PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix3x2dv, PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix2x4dv, PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix4x2dv, PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix3x4dv, PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ProgramUniformMatrix4x3dv, PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value), (program, location, count, transpose, value), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(ValidateProgramPipeline, PFNGLVALIDATEPROGRAMPIPELINEPROC, (GLuint pipeline), (pipeline), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(GetProgramPipelineInfoLog, PFNGLGETPROGRAMPIPELINEINFOLOGPROC, (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog), (pipeline, bufSize, length, infoLog), (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects))
+GLAD_PROC_VOID(VertexAttribL1d, PFNGLVERTEXATTRIBL1DPROC, (GLuint index, GLdouble x), (index, x), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(VertexAttribL2d, PFNGLVERTEXATTRIBL2DPROC, (GLuint index, GLdouble x, GLdouble y), (index, x, y), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(VertexAttribL3d, PFNGLVERTEXATTRIBL3DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(VertexAttribL4d, PFNGLVERTEXATTRIBL4DPROC, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(VertexAttribL1dv, PFNGLVERTEXATTRIBL1DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(VertexAttribL2dv, PFNGLVERTEXATTRIBL2DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(VertexAttribL3dv, PFNGLVERTEXATTRIBL3DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(VertexAttribL4dv, PFNGLVERTEXATTRIBL4DVPROC, (GLuint index, const GLdouble *v), (index, v), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(VertexAttribLPointer, PFNGLVERTEXATTRIBLPOINTERPROC, (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer), (index, size, type, stride, pointer), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(GetVertexAttribLdv, PFNGLGETVERTEXATTRIBLDVPROC, (GLuint index, GLenum pname, GLdouble *params), (index, pname, params), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(ViewportArrayv, PFNGLVIEWPORTARRAYVPROC, (GLuint first, GLsizei count, const GLfloat *v), (first, count, v), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(ViewportIndexedf, PFNGLVIEWPORTINDEXEDFPROC, (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h), (index, x, y, w, h), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(ViewportIndexedfv, PFNGLVIEWPORTINDEXEDFVPROC, (GLuint index, const GLfloat *v), (index, v), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(ScissorArrayv, PFNGLSCISSORARRAYVPROC, (GLuint first, GLsizei count, const GLint *v), (first, count, v), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(ScissorIndexed, PFNGLSCISSORINDEXEDPROC, (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height), (index, left, bottom, width, height), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(ScissorIndexedv, PFNGLSCISSORINDEXEDVPROC, (GLuint index, const GLint *v), (index, v), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(DepthRangeArrayv, PFNGLDEPTHRANGEARRAYVPROC, (GLuint first, GLsizei count, const GLdouble *v), (first, count, v), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(DepthRangeIndexed, PFNGLDEPTHRANGEINDEXEDPROC, (GLuint index, GLdouble n, GLdouble f), (index, n, f), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(GetFloati_v, PFNGLGETFLOATI_VPROC, (GLenum target, GLuint index, GLfloat *data), (target, index, data), GLAD_GL_VERSION_4_1)
+GLAD_PROC_VOID(GetDoublei_v, PFNGLGETDOUBLEI_VPROC, (GLenum target, GLuint index, GLdouble *data), (target, index, data), GLAD_GL_VERSION_4_1)
+
+GLAD_FEATURE(GLAD_GL_VERSION_4_2)
+GLAD_PROC_VOID(DrawArraysInstancedBaseInstance, PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance), (mode, first, count, instancecount, baseinstance), GLAD_GL_VERSION_4_2)
+GLAD_PROC_VOID(DrawElementsInstancedBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance), (mode, count, type, indices, instancecount, baseinstance), GLAD_GL_VERSION_4_2)
+GLAD_PROC_VOID(DrawElementsInstancedBaseVertexBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC, (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance), (mode, count, type, indices, instancecount, basevertex, baseinstance), GLAD_GL_VERSION_4_2)
+GLAD_PROC_VOID(GetInternalformativ, PFNGLGETINTERNALFORMATIVPROC, (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params), (target, internalformat, pname, count, params), GLAD_GL_VERSION_4_2)
+GLAD_PROC_VOID(GetActiveAtomicCounterBufferiv, PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC, (GLuint program, GLuint bufferIndex, GLenum pname, GLint *params), (program, bufferIndex, pname, params), GLAD_GL_VERSION_4_2)
+GLAD_PROC_VOID(BindImageTexture, PFNGLBINDIMAGETEXTUREPROC, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format), (unit, texture, level, layered, layer, access, format), GLAD_GL_VERSION_4_2)
+GLAD_PROC_VOID(MemoryBarrier, PFNGLMEMORYBARRIERPROC, (GLbitfield barriers), (barriers), GLAD_GL_VERSION_4_2)
+GLAD_PROC_VOID(TexStorage1D, PFNGLTEXSTORAGE1DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width), (target, levels, internalformat, width), GLAD_GL_VERSION_4_2)
+GLAD_PROC_VOID(TexStorage2D, PFNGLTEXSTORAGE2DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (target, levels, internalformat, width, height), GLAD_GL_VERSION_4_2)
+GLAD_PROC_VOID(TexStorage3D, PFNGLTEXSTORAGE3DPROC, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (target, levels, internalformat, width, height, depth), GLAD_GL_VERSION_4_2)
+GLAD_PROC_VOID(DrawTransformFeedbackInstanced, PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC, (GLenum mode, GLuint id, GLsizei instancecount), (mode, id, instancecount), GLAD_GL_VERSION_4_2)
+GLAD_PROC_VOID(DrawTransformFeedbackStreamInstanced, PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC, (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount), (mode, id, stream, instancecount), GLAD_GL_VERSION_4_2)
+
+GLAD_FEATURE(GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(ClearBufferData, PFNGLCLEARBUFFERDATAPROC, (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data), (target, internalformat, format, type, data), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(ClearBufferSubData, PFNGLCLEARBUFFERSUBDATAPROC, (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (target, internalformat, offset, size, format, type, data), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(DispatchCompute, PFNGLDISPATCHCOMPUTEPROC, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z), (num_groups_x, num_groups_y, num_groups_z), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(DispatchComputeIndirect, PFNGLDISPATCHCOMPUTEINDIRECTPROC, (GLintptr indirect), (indirect), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(CopyImageSubData, PFNGLCOPYIMAGESUBDATAPROC, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth), (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(FramebufferParameteri, PFNGLFRAMEBUFFERPARAMETERIPROC, (GLenum target, GLenum pname, GLint param), (target, pname, param), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(GetFramebufferParameteriv, PFNGLGETFRAMEBUFFERPARAMETERIVPROC, (GLenum target, GLenum pname, GLint *params), (target, pname, params), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(GetInternalformati64v, PFNGLGETINTERNALFORMATI64VPROC, (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params), (target, internalformat, pname, count, params), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(InvalidateTexSubImage, PFNGLINVALIDATETEXSUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth), (texture, level, xoffset, yoffset, zoffset, width, height, depth), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(InvalidateTexImage, PFNGLINVALIDATETEXIMAGEPROC, (GLuint texture, GLint level), (texture, level), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(InvalidateBufferSubData, PFNGLINVALIDATEBUFFERSUBDATAPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(InvalidateBufferData, PFNGLINVALIDATEBUFFERDATAPROC, (GLuint buffer), (buffer), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(InvalidateFramebuffer, PFNGLINVALIDATEFRAMEBUFFERPROC, (GLenum target, GLsizei numAttachments, const GLenum *attachments), (target, numAttachments, attachments), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(InvalidateSubFramebuffer, PFNGLINVALIDATESUBFRAMEBUFFERPROC, (GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (target, numAttachments, attachments, x, y, width, height), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(MultiDrawArraysIndirect, PFNGLMULTIDRAWARRAYSINDIRECTPROC, (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, indirect, drawcount, stride), (GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_multi_draw_indirect))
+GLAD_PROC_VOID(MultiDrawElementsIndirect, PFNGLMULTIDRAWELEMENTSINDIRECTPROC, (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride), (mode, type, indirect, drawcount, stride), (GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_multi_draw_indirect))
+GLAD_PROC_VOID(GetProgramInterfaceiv, PFNGLGETPROGRAMINTERFACEIVPROC, (GLuint program, GLenum programInterface, GLenum pname, GLint *params), (program, programInterface, pname, params), GLAD_GL_VERSION_4_3)
+GLAD_PROC(GLuint, GetProgramResourceIndex, PFNGLGETPROGRAMRESOURCEINDEXPROC, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(GetProgramResourceName, PFNGLGETPROGRAMRESOURCENAMEPROC, (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name), (program, programInterface, index, bufSize, length, name), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(GetProgramResourceiv, PFNGLGETPROGRAMRESOURCEIVPROC, (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params), (program, programInterface, index, propCount, props, count, length, params), GLAD_GL_VERSION_4_3)
+GLAD_PROC(GLint, GetProgramResourceLocation, PFNGLGETPROGRAMRESOURCELOCATIONPROC, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name), GLAD_GL_VERSION_4_3)
+GLAD_PROC(GLint, GetProgramResourceLocationIndex, PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC, (GLuint program, GLenum programInterface, const GLchar *name), (program, programInterface, name), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(ShaderStorageBlockBinding, PFNGLSHADERSTORAGEBLOCKBINDINGPROC, (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding), (program, storageBlockIndex, storageBlockBinding), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(TexBufferRange, PFNGLTEXBUFFERRANGEPROC, (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, internalformat, buffer, offset, size), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(TexStorage2DMultisample, PFNGLTEXSTORAGE2DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(TexStorage3DMultisample, PFNGLTEXSTORAGE3DMULTISAMPLEPROC, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(TextureView, PFNGLTEXTUREVIEWPROC, (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers), (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(BindVertexBuffer, PFNGLBINDVERTEXBUFFERPROC, (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (bindingindex, buffer, offset, stride), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(VertexAttribFormat, PFNGLVERTEXATTRIBFORMATPROC, (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (attribindex, size, type, normalized, relativeoffset), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(VertexAttribIFormat, PFNGLVERTEXATTRIBIFORMATPROC, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(VertexAttribLFormat, PFNGLVERTEXATTRIBLFORMATPROC, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(VertexAttribBinding, PFNGLVERTEXATTRIBBINDINGPROC, (GLuint attribindex, GLuint bindingindex), (attribindex, bindingindex), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(VertexBindingDivisor, PFNGLVERTEXBINDINGDIVISORPROC, (GLuint bindingindex, GLuint divisor), (bindingindex, divisor), GLAD_GL_VERSION_4_3)
+GLAD_PROC_VOID(DebugMessageControl, PFNGLDEBUGMESSAGECONTROLPROC, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled), (source, type, severity, count, ids, enabled), (GLAD_GL_VERSION_4_3 || GLAD_GL_KHR_debug))
+GLAD_PROC_VOID(DebugMessageInsert, PFNGLDEBUGMESSAGEINSERTPROC, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf), (source, type, id, severity, length, buf), (GLAD_GL_VERSION_4_3 || GLAD_GL_KHR_debug))
+GLAD_PROC_VOID(DebugMessageCallback, PFNGLDEBUGMESSAGECALLBACKPROC, (GLDEBUGPROC callback, const void *userParam), (callback, userParam), (GLAD_GL_VERSION_4_3 || GLAD_GL_KHR_debug))
+GLAD_PROC(GLuint, GetDebugMessageLog, PFNGLGETDEBUGMESSAGELOGPROC, (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog), (GLAD_GL_VERSION_4_3 || GLAD_GL_KHR_debug))
+GLAD_PROC_VOID(PushDebugGroup, PFNGLPUSHDEBUGGROUPPROC, (GLenum source, GLuint id, GLsizei length, const GLchar *message), (source, id, length, message), (GLAD_GL_VERSION_4_3 || GLAD_GL_KHR_debug))
+GLAD_PROC_VOID(PopDebugGroup, PFNGLPOPDEBUGGROUPPROC, (void), (), (GLAD_GL_VERSION_4_3 || GLAD_GL_KHR_debug))
+GLAD_PROC_VOID(ObjectLabel, PFNGLOBJECTLABELPROC, (GLenum identifier, GLuint name, GLsizei length, const GLchar *label), (identifier, name, length, label), (GLAD_GL_VERSION_4_3 || GLAD_GL_KHR_debug))
+GLAD_PROC_VOID(GetObjectLabel, PFNGLGETOBJECTLABELPROC, (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label), (identifier, name, bufSize, length, label), (GLAD_GL_VERSION_4_3 || GLAD_GL_KHR_debug))
+GLAD_PROC_VOID(ObjectPtrLabel, PFNGLOBJECTPTRLABELPROC, (const void *ptr, GLsizei length, const GLchar *label), (ptr, length, label), (GLAD_GL_VERSION_4_3 || GLAD_GL_KHR_debug))
+GLAD_PROC_VOID(GetObjectPtrLabel, PFNGLGETOBJECTPTRLABELPROC, (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label), (ptr, bufSize, length, label), (GLAD_GL_VERSION_4_3 || GLAD_GL_KHR_debug))
+
+GLAD_FEATURE(GLAD_GL_VERSION_4_4)
+GLAD_PROC_VOID(BufferStorage, PFNGLBUFFERSTORAGEPROC, (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags), (target, size, data, flags), (GLAD_GL_VERSION_4_4 || GLAD_GL_ARB_buffer_storage))
+GLAD_PROC_VOID(ClearTexImage, PFNGLCLEARTEXIMAGEPROC, (GLuint texture, GLint level, GLenum format, GLenum type, const void *data), (texture, level, format, type, data), GLAD_GL_VERSION_4_4)
+GLAD_PROC_VOID(ClearTexSubImage, PFNGLCLEARTEXSUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data), GLAD_GL_VERSION_4_4)
+GLAD_PROC_VOID(BindBuffersBase, PFNGLBINDBUFFERSBASEPROC, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers), (target, first, count, buffers), GLAD_GL_VERSION_4_4)
+GLAD_PROC_VOID(BindBuffersRange, PFNGLBINDBUFFERSRANGEPROC, (GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes), (target, first, count, buffers, offsets, sizes), GLAD_GL_VERSION_4_4)
+GLAD_PROC_VOID(BindTextures, PFNGLBINDTEXTURESPROC, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures), GLAD_GL_VERSION_4_4)
+GLAD_PROC_VOID(BindSamplers, PFNGLBINDSAMPLERSPROC, (GLuint first, GLsizei count, const GLuint *samplers), (first, count, samplers), GLAD_GL_VERSION_4_4)
+GLAD_PROC_VOID(BindImageTextures, PFNGLBINDIMAGETEXTURESPROC, (GLuint first, GLsizei count, const GLuint *textures), (first, count, textures), GLAD_GL_VERSION_4_4)
+GLAD_PROC_VOID(BindVertexBuffers, PFNGLBINDVERTEXBUFFERSPROC, (GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (first, count, buffers, offsets, strides), GLAD_GL_VERSION_4_4)
+
+GLAD_FEATURE(GLAD_GL_VERSION_4_5)
+GLAD_PROC_VOID(ClipControl, PFNGLCLIPCONTROLPROC, (GLenum origin, GLenum depth), (origin, depth), GLAD_GL_VERSION_4_5)
+GLAD_PROC_VOID(CreateTransformFeedbacks, PFNGLCREATETRANSFORMFEEDBACKSPROC, (GLsizei n, GLuint *ids), (n, ids), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TransformFeedbackBufferBase, PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC, (GLuint xfb, GLuint index, GLuint buffer), (xfb, index, buffer), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TransformFeedbackBufferRange, PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC, (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (xfb, index, buffer, offset, size), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetTransformFeedbackiv, PFNGLGETTRANSFORMFEEDBACKIVPROC, (GLuint xfb, GLenum pname, GLint *param), (xfb, pname, param), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetTransformFeedbacki_v, PFNGLGETTRANSFORMFEEDBACKI_VPROC, (GLuint xfb, GLenum pname, GLuint index, GLint *param), (xfb, pname, index, param), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetTransformFeedbacki64_v, PFNGLGETTRANSFORMFEEDBACKI64_VPROC, (GLuint xfb, GLenum pname, GLuint index, GLint64 *param), (xfb, pname, index, param), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(CreateBuffers, PFNGLCREATEBUFFERSPROC, (GLsizei n, GLuint *buffers), (n, buffers), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(NamedBufferStorage, PFNGLNAMEDBUFFERSTORAGEPROC, (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags), (buffer, size, data, flags), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(NamedBufferData, PFNGLNAMEDBUFFERDATAPROC, (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage), (buffer, size, data, usage), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(NamedBufferSubData, PFNGLNAMEDBUFFERSUBDATAPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data), (buffer, offset, size, data), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(CopyNamedBufferSubData, PFNGLCOPYNAMEDBUFFERSUBDATAPROC, (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readBuffer, writeBuffer, readOffset, writeOffset, size), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(ClearNamedBufferData, PFNGLCLEARNAMEDBUFFERDATAPROC, (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data), (buffer, internalformat, format, type, data), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(ClearNamedBufferSubData, PFNGLCLEARNAMEDBUFFERSUBDATAPROC, (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data), (buffer, internalformat, offset, size, format, type, data), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC(void *, MapNamedBuffer, PFNGLMAPNAMEDBUFFERPROC, (GLuint buffer, GLenum access), (buffer, access), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC(void *, MapNamedBufferRange, PFNGLMAPNAMEDBUFFERRANGEPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access), (buffer, offset, length, access), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC(GLboolean, UnmapNamedBuffer, PFNGLUNMAPNAMEDBUFFERPROC, (GLuint buffer), (buffer), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(FlushMappedNamedBufferRange, PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetNamedBufferParameteriv, PFNGLGETNAMEDBUFFERPARAMETERIVPROC, (GLuint buffer, GLenum pname, GLint *params), (buffer, pname, params), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetNamedBufferParameteri64v, PFNGLGETNAMEDBUFFERPARAMETERI64VPROC, (GLuint buffer, GLenum pname, GLint64 *params), (buffer, pname, params), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetNamedBufferPointerv, PFNGLGETNAMEDBUFFERPOINTERVPROC, (GLuint buffer, GLenum pname, void **params), (buffer, pname, params), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetNamedBufferSubData, PFNGLGETNAMEDBUFFERSUBDATAPROC, (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data), (buffer, offset, size, data), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(CreateFramebuffers, PFNGLCREATEFRAMEBUFFERSPROC, (GLsizei n, GLuint *framebuffers), (n, framebuffers), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(NamedFramebufferRenderbuffer, PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC, (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (framebuffer, attachment, renderbuffertarget, renderbuffer), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(NamedFramebufferParameteri, PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC, (GLuint framebuffer, GLenum pname, GLint param), (framebuffer, pname, param), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(NamedFramebufferTexture, PFNGLNAMEDFRAMEBUFFERTEXTUREPROC, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level), (framebuffer, attachment, texture, level), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(NamedFramebufferTextureLayer, PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer), (framebuffer, attachment, texture, level, layer), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(NamedFramebufferDrawBuffer, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC, (GLuint framebuffer, GLenum buf), (framebuffer, buf), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(NamedFramebufferDrawBuffers, PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC, (GLuint framebuffer, GLsizei n, const GLenum *bufs), (framebuffer, n, bufs), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(NamedFramebufferReadBuffer, PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC, (GLuint framebuffer, GLenum src), (framebuffer, src), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(InvalidateNamedFramebufferData, PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments), (framebuffer, numAttachments, attachments), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(InvalidateNamedFramebufferSubData, PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC, (GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height), (framebuffer, numAttachments, attachments, x, y, width, height), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(ClearNamedFramebufferiv, PFNGLCLEARNAMEDFRAMEBUFFERIVPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value), (framebuffer, buffer, drawbuffer, value), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(ClearNamedFramebufferuiv, PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value), (framebuffer, buffer, drawbuffer, value), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(ClearNamedFramebufferfv, PFNGLCLEARNAMEDFRAMEBUFFERFVPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value), (framebuffer, buffer, drawbuffer, value), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(ClearNamedFramebufferfi, PFNGLCLEARNAMEDFRAMEBUFFERFIPROC, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (framebuffer, buffer, drawbuffer, depth, stencil), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(BlitNamedFramebuffer, PFNGLBLITNAMEDFRAMEBUFFERPROC, (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC(GLenum, CheckNamedFramebufferStatus, PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC, (GLuint framebuffer, GLenum target), (framebuffer, target), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetNamedFramebufferParameteriv, PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC, (GLuint framebuffer, GLenum pname, GLint *param), (framebuffer, pname, param), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetNamedFramebufferAttachmentParameteriv, PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC, (GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params), (framebuffer, attachment, pname, params), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(CreateRenderbuffers, PFNGLCREATERENDERBUFFERSPROC, (GLsizei n, GLuint *renderbuffers), (n, renderbuffers), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(NamedRenderbufferStorage, PFNGLNAMEDRENDERBUFFERSTORAGEPROC, (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, internalformat, width, height), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(NamedRenderbufferStorageMultisample, PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC, (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, samples, internalformat, width, height), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetNamedRenderbufferParameteriv, PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC, (GLuint renderbuffer, GLenum pname, GLint *params), (renderbuffer, pname, params), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(CreateTextures, PFNGLCREATETEXTURESPROC, (GLenum target, GLsizei n, GLuint *textures), (target, n, textures), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureBuffer, PFNGLTEXTUREBUFFERPROC, (GLuint texture, GLenum internalformat, GLuint buffer), (texture, internalformat, buffer), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureBufferRange, PFNGLTEXTUREBUFFERRANGEPROC, (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (texture, internalformat, buffer, offset, size), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureStorage1D, PFNGLTEXTURESTORAGE1DPROC, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width), (texture, levels, internalformat, width), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureStorage2D, PFNGLTEXTURESTORAGE2DPROC, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (texture, levels, internalformat, width, height), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureStorage3D, PFNGLTEXTURESTORAGE3DPROC, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (texture, levels, internalformat, width, height, depth), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureStorage2DMultisample, PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, fixedsamplelocations), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureStorage3DMultisample, PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, depth, fixedsamplelocations), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureSubImage1D, PFNGLTEXTURESUBIMAGE1DPROC, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, width, format, type, pixels), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureSubImage2D, PFNGLTEXTURESUBIMAGE2DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, width, height, format, type, pixels), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureSubImage3D, PFNGLTEXTURESUBIMAGE3DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(CompressedTextureSubImage1D, PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, width, format, imageSize, data), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(CompressedTextureSubImage2D, PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, width, height, format, imageSize, data), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(CompressedTextureSubImage3D, PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(CopyTextureSubImage1D, PFNGLCOPYTEXTURESUBIMAGE1DPROC, (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (texture, level, xoffset, x, y, width), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(CopyTextureSubImage2D, PFNGLCOPYTEXTURESUBIMAGE2DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, x, y, width, height), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(CopyTextureSubImage3D, PFNGLCOPYTEXTURESUBIMAGE3DPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, zoffset, x, y, width, height), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureParameterf, PFNGLTEXTUREPARAMETERFPROC, (GLuint texture, GLenum pname, GLfloat param), (texture, pname, param), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureParameterfv, PFNGLTEXTUREPARAMETERFVPROC, (GLuint texture, GLenum pname, const GLfloat *param), (texture, pname, param), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureParameteri, PFNGLTEXTUREPARAMETERIPROC, (GLuint texture, GLenum pname, GLint param), (texture, pname, param), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureParameterIiv, PFNGLTEXTUREPARAMETERIIVPROC, (GLuint texture, GLenum pname, const GLint *params), (texture, pname, params), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureParameterIuiv, PFNGLTEXTUREPARAMETERIUIVPROC, (GLuint texture, GLenum pname, const GLuint *params), (texture, pname, params), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(TextureParameteriv, PFNGLTEXTUREPARAMETERIVPROC, (GLuint texture, GLenum pname, const GLint *param), (texture, pname, param), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GenerateTextureMipmap, PFNGLGENERATETEXTUREMIPMAPPROC, (GLuint texture), (texture), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(BindTextureUnit, PFNGLBINDTEXTUREUNITPROC, (GLuint unit, GLuint texture), (unit, texture), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetTextureImage, PFNGLGETTEXTUREIMAGEPROC, (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, format, type, bufSize, pixels), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetCompressedTextureImage, PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC, (GLuint texture, GLint level, GLsizei bufSize, void *pixels), (texture, level, bufSize, pixels), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetTextureLevelParameterfv, PFNGLGETTEXTURELEVELPARAMETERFVPROC, (GLuint texture, GLint level, GLenum pname, GLfloat *params), (texture, level, pname, params), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetTextureLevelParameteriv, PFNGLGETTEXTURELEVELPARAMETERIVPROC, (GLuint texture, GLint level, GLenum pname, GLint *params), (texture, level, pname, params), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetTextureParameterfv, PFNGLGETTEXTUREPARAMETERFVPROC, (GLuint texture, GLenum pname, GLfloat *params), (texture, pname, params), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetTextureParameterIiv, PFNGLGETTEXTUREPARAMETERIIVPROC, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetTextureParameterIuiv, PFNGLGETTEXTUREPARAMETERIUIVPROC, (GLuint texture, GLenum pname, GLuint *params), (texture, pname, params), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetTextureParameteriv, PFNGLGETTEXTUREPARAMETERIVPROC, (GLuint texture, GLenum pname, GLint *params), (texture, pname, params), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(CreateVertexArrays, PFNGLCREATEVERTEXARRAYSPROC, (GLsizei n, GLuint *arrays), (n, arrays), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(DisableVertexArrayAttrib, PFNGLDISABLEVERTEXARRAYATTRIBPROC, (GLuint vaobj, GLuint index), (vaobj, index), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(EnableVertexArrayAttrib, PFNGLENABLEVERTEXARRAYATTRIBPROC, (GLuint vaobj, GLuint index), (vaobj, index), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(VertexArrayElementBuffer, PFNGLVERTEXARRAYELEMENTBUFFERPROC, (GLuint vaobj, GLuint buffer), (vaobj, buffer), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(VertexArrayVertexBuffer, PFNGLVERTEXARRAYVERTEXBUFFERPROC, (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (vaobj, bindingindex, buffer, offset, stride), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(VertexArrayVertexBuffers, PFNGLVERTEXARRAYVERTEXBUFFERSPROC, (GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides), (vaobj, first, count, buffers, offsets, strides), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(VertexArrayAttribBinding, PFNGLVERTEXARRAYATTRIBBINDINGPROC, (GLuint vaobj, GLuint attribindex, GLuint bindingindex), (vaobj, attribindex, bindingindex), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(VertexArrayAttribFormat, PFNGLVERTEXARRAYATTRIBFORMATPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (vaobj, attribindex, size, type, normalized, relativeoffset), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(VertexArrayAttribIFormat, PFNGLVERTEXARRAYATTRIBIFORMATPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(VertexArrayAttribLFormat, PFNGLVERTEXARRAYATTRIBLFORMATPROC, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(VertexArrayBindingDivisor, PFNGLVERTEXARRAYBINDINGDIVISORPROC, (GLuint vaobj, GLuint bindingindex, GLuint divisor), (vaobj, bindingindex, divisor), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetVertexArrayiv, PFNGLGETVERTEXARRAYIVPROC, (GLuint vaobj, GLenum pname, GLint *param), (vaobj, pname, param), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetVertexArrayIndexediv, PFNGLGETVERTEXARRAYINDEXEDIVPROC, (GLuint vaobj, GLuint index, GLenum pname, GLint *param), (vaobj, index, pname, param), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetVertexArrayIndexed64iv, PFNGLGETVERTEXARRAYINDEXED64IVPROC, (GLuint vaobj, GLuint index, GLenum pname, GLint64 *param), (vaobj, index, pname, param), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(CreateSamplers, PFNGLCREATESAMPLERSPROC, (GLsizei n, GLuint *samplers), (n, samplers), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(CreateProgramPipelines, PFNGLCREATEPROGRAMPIPELINESPROC, (GLsizei n, GLuint *pipelines), (n, pipelines), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(CreateQueries, PFNGLCREATEQUERIESPROC, (GLenum target, GLsizei n, GLuint *ids), (target, n, ids), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetQueryBufferObjecti64v, PFNGLGETQUERYBUFFEROBJECTI64VPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetQueryBufferObjectiv, PFNGLGETQUERYBUFFEROBJECTIVPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetQueryBufferObjectui64v, PFNGLGETQUERYBUFFEROBJECTUI64VPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(GetQueryBufferObjectuiv, PFNGLGETQUERYBUFFEROBJECTUIVPROC, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset), (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access))
+GLAD_PROC_VOID(MemoryBarrierByRegion, PFNGLMEMORYBARRIERBYREGIONPROC, (GLbitfield barriers), (barriers), GLAD_GL_VERSION_4_5)
+GLAD_PROC_VOID(GetTextureSubImage, PFNGLGETTEXTURESUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels), GLAD_GL_VERSION_4_5)
+GLAD_PROC_VOID(GetCompressedTextureSubImage, PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels), GLAD_GL_VERSION_4_5)
+GLAD_PROC(GLenum, GetGraphicsResetStatus, PFNGLGETGRAPHICSRESETSTATUSPROC, (void), (), GLAD_GL_VERSION_4_5)
+GLAD_PROC_VOID(GetnCompressedTexImage, PFNGLGETNCOMPRESSEDTEXIMAGEPROC, (GLenum target, GLint lod, GLsizei bufSize, void *pixels), (target, lod, bufSize, pixels), GLAD_GL_VERSION_4_5)
+GLAD_PROC_VOID(GetnTexImage, PFNGLGETNTEXIMAGEPROC, (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels), (target, level, format, type, bufSize, pixels), GLAD_GL_VERSION_4_5)
+GLAD_PROC_VOID(GetnUniformdv, PFNGLGETNUNIFORMDVPROC, (GLuint program, GLint location, GLsizei bufSize, GLdouble *params), (program, location, bufSize, params), GLAD_GL_VERSION_4_5)
+GLAD_PROC_VOID(GetnUniformfv, PFNGLGETNUNIFORMFVPROC, (GLuint program, GLint location, GLsizei bufSize, GLfloat *params), (program, location, bufSize, params), GLAD_GL_VERSION_4_5)
+GLAD_PROC_VOID(GetnUniformiv, PFNGLGETNUNIFORMIVPROC, (GLuint program, GLint location, GLsizei bufSize, GLint *params), (program, location, bufSize, params), GLAD_GL_VERSION_4_5)
+GLAD_PROC_VOID(GetnUniformuiv, PFNGLGETNUNIFORMUIVPROC, (GLuint program, GLint location, GLsizei bufSize, GLuint *params), (program, location, bufSize, params), GLAD_GL_VERSION_4_5)
+GLAD_PROC_VOID(ReadnPixels, PFNGLREADNPIXELSPROC, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data), (x, y, width, height, format, type, bufSize, data), GLAD_GL_VERSION_4_5)
+GLAD_PROC_VOID(TextureBarrier, PFNGLTEXTUREBARRIERPROC, (void), (), GLAD_GL_VERSION_4_5)
+
+GLAD_FEATURE(GLAD_GL_VERSION_4_6)
+GLAD_PROC_VOID(SpecializeShader, PFNGLSPECIALIZESHADERPROC, (GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue), (shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue), GLAD_GL_VERSION_4_6)
+GLAD_PROC_VOID(MultiDrawArraysIndirectCount, PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC, (GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, indirect, drawcount, maxdrawcount, stride), GLAD_GL_VERSION_4_6)
+GLAD_PROC_VOID(MultiDrawElementsIndirectCount, PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC, (GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, type, indirect, drawcount, maxdrawcount, stride), GLAD_GL_VERSION_4_6)
+GLAD_PROC_VOID(PolygonOffsetClamp, PFNGLPOLYGONOFFSETCLAMPPROC, (GLfloat factor, GLfloat units, GLfloat clamp), (factor, units, clamp), GLAD_GL_VERSION_4_6)
+
+GLAD_FEATURE(GLAD_GL_ARB_gl_spirv)
+GLAD_PROC_VOID(SpecializeShaderARB, PFNGLSPECIALIZESHADERARBPROC, (GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue), (shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue), GLAD_GL_ARB_gl_spirv)
+
+GLAD_FEATURE(GLAD_GL_KHR_parallel_shader_compile)
+GLAD_PROC_VOID(MaxShaderCompilerThreadsKHR, PFNGLMAXSHADERCOMPILERTHREADSKHRPROC, (GLuint count), (count), GLAD_GL_KHR_parallel_shader_compile)
+
+GLAD_FEATURE(GLAD_GL_ARB_buffer_storage)
+
+GLAD_FEATURE(GLAD_GL_ARB_direct_state_access)
+
+GLAD_FEATURE(GLAD_GL_ARB_get_program_binary)
+
+GLAD_FEATURE(GLAD_GL_ARB_multi_draw_indirect)
+
+GLAD_FEATURE(GLAD_GL_ARB_separate_shader_objects)
+
+GLAD_FEATURE(GLAD_GL_KHR_debug)
+
+#ifdef GLAD_FEATURE_DEFAULTED
+#undef GLAD_FEATURE
+#undef GLAD_FEATURE_DEFAULTED
+#endif
@@ -0,0 +1,11 @@
+#version 450 core
+// The SPIR-V version of the basic shader's plain color, see tools/compile_spirv.py
+
+// Written by tools/compile_spirv.py from the same field list as the C++
+// struct. Without a binding the block uses 0, where the demos bind it
+#include "BasicColors.block"
+
+layout (location = 0) out vec4 FragColor;
+void main() {
+	FragColor = color;
+}
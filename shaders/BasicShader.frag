@@ -0,0 +1,19 @@
+#version 330 core
+// Fragment stage of the basic shader, see src/BasicShader.h for the features
+
+// Written by tools/shader_pack.py from the same field list as the C++ struct
+#include "BasicColors.block"
+
+out vec4 FragColor;
+#ifdef HAS_COLOR
+in vec3 vertexColor;
+#endif
+void main() {
+#if defined(WIREFRAME)
+	FragColor = wireframeColor;
+#elif defined(HAS_COLOR)
+	FragColor = vec4(vertexColor, 1.0f);
+#else
+	FragColor = color;
+#endif
+}
@@ -0,0 +1,13 @@
+#version 330 core
+// Vertex stage of the basic shader, see src/BasicShader.h for the features
+layout (location = 0) in vec3 aPos;
+#ifdef HAS_COLOR
+layout (location = 1) in vec3 aColor;
+out vec3 vertexColor;
+#endif
+void main() {
+	gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);
+#ifdef HAS_COLOR
+	vertexColor = aColor;
+#endif
+}
@@ -0,0 +1,6 @@
+#version 330 core
+// Flat grey, so a shader that isn't ready yet is easy to tell apart
+out vec4 FragColor;
+void main() {
+	FragColor = vec4(0.5, 0.5, 0.5, 1.0);
+}
@@ -0,0 +1,7 @@
+#version 330 core
+// Drawn with while the real program builds (see src/ShaderQueue.h). Only
+// needs the position in attribute 0, like every VAO in the demos
+layout (location = 0) in vec3 aPos;
+void main() {
+	gl_Position = vec4(aPos, 1.0);
+}
@@ -0,0 +1,783 @@
+#include "AppContext.h"
+#include "GLTrace.h"
+#include "GLStats.h"
+#include "GLDebugLog.h"
+#include "StartupTimeline.h"
+#include "ProgramCache.h"
+#include "ShaderQueue.h"
+#include "ShaderReload.h"
+#include "ShaderRegistry.h"
+#include "MaterialSystem.h"
+#include "ShaderPermutations.h"
+#include "ProgramReflection.h"
+#include "ShaderTelemetry.h"
+#include "ShaderPrewarm.h"
+#include "ShaderPack.h"
+
+// Including core libraries
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cstring>
+
+#if !defined(_WIN32) && !defined(__APPLE__)
+#include <dlfcn.h>
+#define APP_HEADLESS_SUPPORTED 1
+#endif
+
+// Headless runs have nobody to close the window, so they stop on their own
+const int DEFAULT_HEADLESS_FRAMES = 100;
+
+// Null driver frames cost next to nothing, so run a lot more of them
+const int DEFAULT_NULL_FRAMES = 1000000;
+
+static bool createWindowContext(AppContext*, const char*);
+// The normal path, a GLFW window
+
+static bool createEGLContext(AppContext*);
+// Surfaceless EGL context plus a framebuffer object to render into
+
+static bool createOSMesaContext(AppContext*);
+// OSMesa context rendering straight into memory
+
+static bool createHeadlessSharedContext(AppContext*, AppSharedContext*);
+static bool makeHeadlessContextCurrent(AppContext*, AppSharedContext*);
+static void destroyHeadlessSharedContext(AppContext*, AppSharedContext*);
+// The EGL and OSMesa halves of the AppSharedContext functions
+
+static void writeScreenshot(AppContext*, const char*);
+// Saves the current frame as a binary PPM
+
+static void reportMissingProc(const char*);
+// Prints an entry point gladVerifyGL couldn't find
+
+#ifdef APP_HEADLESS_SUPPORTED
+
+// The libEGL and libOSMesa functions headless contexts need, resolved
+// once when the first context gets created and dropped with the context
+struct EGLFunctions {
+	void *library;
+	void *(*getProcAddress)(const char*);
+	void *(*getDisplay)(void*);
+	unsigned int (*initialize)(void*, int*, int*);
+	unsigned int (*bindAPI)(unsigned int);
+	void *(*createContext)(void*, void*, void*, const int*);
+	unsigned int (*makeCurrent)(void*, void*, void*, void*);
+	unsigned int (*destroyContext)(void*, void*);
+	unsigned int (*terminate)(void*);
+};
+
+struct OSMesaFunctions {
+	void *library;
+	void *(*createContext)(const int*, void*);
+	unsigned char (*makeCurrent)(void*, void*, unsigned int, int, int);
+	void (*destroyContext)(void*);
+};
+
+static EGLFunctions egl;
+static OSMesaFunctions osmesa;
+
+static bool loadEGL();
+// Opens libEGL.so.1 and resolves egl, unless that was done already.
+// Prints why and leaves nothing open if it fails
+
+static bool loadOSMesa();
+// Same for libOSMesa and osmesa
+
+static void closeHeadlessLibraries();
+// Closes whichever of the two is open
+
+#endif
+
+bool createAppContext(AppContext *app, int width, int height, const char *name) {
+
+	*app = AppContext();
+
+	// Before anything loads the driver, cold runs change its environment
+	startStartupTimeline();
+	beginStartupPhase("createAppContext");
+
+	app->width = width;
+	app->height = height;
+	app->platform = gladGetPlatform();
+
+	const char *debug = getenv("APP_GL_DEBUG");
+	app->debug = debug != NULL && *debug != '\0' && strcmp(debug, "0") != 0;
+
+	const char *frames = getenv("APP_FRAMES");
+
+	if (frames != NULL)
+		app->frameLimit = atoi(frames);
+	else if (app->platform == GLAD_PLATFORM_NULL)
+		app->frameLimit = DEFAULT_NULL_FRAMES;
+	else if (app->platform != GLAD_PLATFORM_NATIVE)
+		app->frameLimit = DEFAULT_HEADLESS_FRAMES;
+
+	bool created;
+
+	switch (app->platform) {
+	case GLAD_PLATFORM_EGL:
+		beginStartupPhase("createEGLContext");
+		created = createEGLContext(app);
+		endStartupPhase();
+		break;
+	case GLAD_PLATFORM_OSMESA:
+		beginStartupPhase("createOSMesaContext");
+		created = createOSMesaContext(app);
+		endStartupPhase();
+		break;
+	case GLAD_PLATFORM_NULL:
+		// Nothing to create, gladLoadGL hands out the null driver
+		created = true;
+		break;
+	default:
+		created = createWindowContext(app, name);
+		break;
+	}
+
+	if (!created)
+		return false;
+
+	// Headless contexts load through glad's own EGL/OSMesa/null support
+	beginStartupPhase("gladLoadGL");
+
+	int loaded = app->window != NULL
+		? gladLoadGLLoader((GLADloadproc) glfwGetProcAddress)
+		: gladLoadGL();
+
+	endStartupPhase();
+
+	if (!loaded) {
+		std::cout << "Unable to intialize GLAD!\n";
+		destroyAppContext(app);
+		return false;
+	}
+
+	// Draw into the offscreen target instead of the (missing) default framebuffer
+	if (app->platform == GLAD_PLATFORM_EGL) {
+
+		beginStartupPhase("offscreen framebuffer");
+
+		glGenFramebuffers(1, &app->FBO);
+		glGenRenderbuffers(1, &app->colorBuffer);
+
+		glBindRenderbuffer(GL_RENDERBUFFER, app->colorBuffer);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+
+		glBindFramebuffer(GL_FRAMEBUFFER, app->FBO);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, app->colorBuffer);
+
+		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+			std::cout << "Unable to create the offscreen framebuffer!\n";
+			destroyAppContext(app);
+			return false;
+		}
+
+		endStartupPhase();
+
+	}
+
+	// Optional check that everything this build loads is really there,
+	// the same for full and trimmed builds of glad
+	if (getenv("APP_VERIFY_GL") != NULL && gladVerifyGL(reportMissingProc) > 0) {
+		std::cout << "Some GL entry points didn't resolve!\n";
+		destroyAppContext(app);
+		return false;
+	}
+
+	beginStartupPhase("detectGLCaps");
+	app->caps = detectGLCaps();
+	endStartupPhase();
+
+	// Record everything the app does from here on. Before the shader
+	// queue, which stays on this context while a trace is recording
+	const char *tracePath = getenv("APP_TRACE");
+
+	if (tracePath != NULL && *tracePath != '\0')
+		startTrace(tracePath);
+
+	// Before anything gets built, cache loads included
+	startShaderTelemetry();
+
+	startProgramCache(app->caps);
+	startShaderQueue(app);
+
+	if (app->debug && !startGLDebugLog(strcmp(debug, "sync") == 0))
+		std::cout << "This context has no debug output, APP_GL_DEBUG is ignored\n";
+
+	// Does nothing unless built with GLAD_GL_INSTRUMENT
+	startGLStats();
+
+	app->start = std::chrono::steady_clock::now();
+
+	endStartupPhase();
+
+	return true;
+
+}
+
+bool appShouldClose(AppContext *app) {
+
+	if (app->frameLimit > 0 && app->frame >= app->frameLimit)
+		return true;
+
+	if (app->window != NULL)
+		return glfwWindowShouldClose(app->window) != 0;
+
+	return app->shouldClose;
+
+}
+
+void appSetShouldClose(AppContext *app) {
+
+	app->shouldClose = true;
+
+	if (app->window != NULL)
+		glfwSetWindowShouldClose(app->window, GLFW_TRUE);
+
+}
+
+bool appKeyPressed(AppContext *app, int key) {
+
+	return app->window != NULL && glfwGetKey(app->window, key) == GLFW_PRESS;
+
+}
+
+void appSetResizeCallback(AppContext *app, GLFWframebuffersizefun callback) {
+
+	if (app->window != NULL)
+		glfwSetFramebufferSizeCallback(app->window, callback);
+
+}
+
+void appSwapBuffers(AppContext *app) {
+
+	// Startup ends once the first frame is out
+	if (app->frame == 0)
+		beginStartupPhase("first swap");
+
+	if (app->window != NULL) {
+
+		// Perform the double buffer goodness and handle window events
+		glfwSwapBuffers(app->window);
+		glfwPollEvents();
+
+	}
+	else if (app->platform != GLAD_PLATFORM_NULL) {
+
+		// Nothing to present, but keep the driver from queueing forever
+		glFlush();
+
+	}
+
+	if (app->frame == 0) {
+		endStartupPhase();
+		finishStartupTimeline();
+	}
+
+	if (isTracing())
+		traceFrame();
+
+	flushGLStats();
+	flushGLDebugLog(app->frame + 1);
+
+	app->frame++;
+
+}
+
+void destroyAppContext(AppContext *app) {
+
+	stopShaderPrewarm();
+	stopMaterials();
+	stopPermutations();
+	stopShaderReload();
+	stopShaderQueue();
+	stopShaderRegistry();
+	stopProgramReflection();
+	stopTrace();
+	stopGLStats();
+	stopShaderTelemetry();
+	stopGLDebugLog();
+	stopProgramCache();
+	closeShaderPack();
+
+	if (app->window != NULL) {
+		glfwTerminate();
+		app->window = NULL;
+		return;
+	}
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - app->start).count();
+
+	if (app->frame > 0 && seconds > 0.0) {
+		std::cout << app->frame << " frames in " << seconds * 1000.0 << " ms ("
+			<< app->frame / seconds << " frames per second)\n";
+	}
+
+	const char *screenshot = getenv("APP_SCREENSHOT");
+
+	if (screenshot != NULL && app->context != NULL)
+		writeScreenshot(app, screenshot);
+
+#ifdef APP_HEADLESS_SUPPORTED
+	if (app->platform == GLAD_PLATFORM_EGL && app->display != NULL) {
+
+		if (app->FBO != 0) {
+			glDeleteFramebuffers(1, &app->FBO);
+			glDeleteRenderbuffers(1, &app->colorBuffer);
+		}
+
+		egl.makeCurrent(app->display, NULL, NULL, NULL);
+		egl.destroyContext(app->display, app->context);
+		egl.terminate(app->display);
+
+	}
+
+	if (app->platform == GLAD_PLATFORM_OSMESA && app->context != NULL)
+		osmesa.destroyContext(app->context);
+
+	closeHeadlessLibraries();
+
+	// Only once the contexts are gone, the entry points glad loaded are
+	// in that library
+	gladUnloadGL();
+#endif
+
+	delete[] app->pixels;
+	app->pixels = NULL;
+	app->context = NULL;
+	app->display = NULL;
+
+}
+
+bool createAppSharedContext(AppContext *app, AppSharedContext *shared) {
+
+	*shared = AppSharedContext();
+
+	if (app->window != NULL) {
+
+		// Never shown, it only exists to own the context
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		shared->window = glfwCreateWindow(1, 1, "", NULL, app->window);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+
+		return shared->window != NULL;
+
+	}
+
+	// The null driver has no objects to share
+	if (app->platform == GLAD_PLATFORM_NULL)
+		return false;
+
+	return createHeadlessSharedContext(app, shared);
+
+}
+
+bool appMakeSharedContextCurrent(AppContext *app, AppSharedContext *shared) {
+
+	bool current;
+
+	if (app->window != NULL) {
+		glfwMakeContextCurrent(shared != NULL ? shared->window : NULL);
+		current = true;
+	}
+	else {
+		current = makeHeadlessContextCurrent(app, shared);
+	}
+
+#ifdef GLAD_GL_MX
+	// Function pointers are per thread, so this one needs its own
+	if (current && shared != NULL) {
+		current = (app->window != NULL
+			? gladLoadGLLoader((GLADloadproc) glfwGetProcAddress)
+			: gladLoadGL()) != 0;
+	}
+#endif
+
+	return current;
+
+}
+
+void destroyAppSharedContext(AppContext *app, AppSharedContext *shared) {
+
+	if (shared->window != NULL)
+		glfwDestroyWindow(shared->window);
+	else if (shared->context != NULL)
+		destroyHeadlessSharedContext(app, shared);
+
+	delete[] shared->pixels;
+	*shared = AppSharedContext();
+
+}
+
+static bool createWindowContext(AppContext *app, const char *name) {
+
+	// Basic startup of glfw
+	beginStartupPhase("glfwInit");
+	int initialized = glfwInit();
+	endStartupPhase();
+
+	if (initialized == GLFW_FALSE) {
+		std::cout << "There was an error starting GLFW!\n";
+		return false;
+	}
+
+	// Setting the OpenGL version to 3.3 (CORE)
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	// Needed to work on a Maciontosh
+	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+
+	// Lets the driver tell us about errors and slow paths, see GLDebugLog.h
+	if (app->debug)
+		glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
+
+	// Attempt to create the window object
+	beginStartupPhase("glfwCreateWindow");
+	app->window = glfwCreateWindow(app->width, app->height, name, NULL, NULL);
+	endStartupPhase();
+
+	if (app->window == NULL) {
+		std::cout << "Unable to create GLFW context!\n";
+		glfwTerminate();
+		return false;
+	}
+
+	// If it gets to this point, then we can set the created context as our context
+	glfwMakeContextCurrent(app->window);
+
+	return true;
+
+}
+
+#ifdef APP_HEADLESS_SUPPORTED
+
+// The few EGL definitions we need, so building doesn't require EGL headers
+#define EGL_DEFAULT_DISPLAY_PTR			((void*)0)
+#define EGL_PLATFORM_SURFACELESS_MESA		0x31DD
+#define EGL_OPENGL_API				0x30A2
+#define EGL_CONTEXT_MAJOR_VERSION		0x3098
+#define EGL_CONTEXT_MINOR_VERSION		0x30FB
+#define EGL_CONTEXT_OPENGL_PROFILE_MASK		0x30FD
+#define EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT	0x00000001
+#define EGL_CONTEXT_OPENGL_DEBUG		0x31B0
+#define EGL_NONE				0x3038
+
+// Same for OSMesa
+#define OSMESA_FORMAT				0x22
+#define OSMESA_DEPTH_BITS			0x30
+#define OSMESA_PROFILE				0x33
+#define OSMESA_CORE_PROFILE			0x34
+#define OSMESA_CONTEXT_MAJOR_VERSION		0x36
+#define OSMESA_CONTEXT_MINOR_VERSION		0x37
+
+static bool createEGLContext(AppContext *app) {
+
+	if (!loadEGL())
+		return false;
+
+	typedef void *(*GetPlatformDisplayProc)(unsigned int, void*, const int*);
+
+	// Prefer Mesa's surfaceless platform, it needs no display server at all
+	GetPlatformDisplayProc getPlatformDisplay = (GetPlatformDisplayProc) egl.getProcAddress("eglGetPlatformDisplayEXT");
+
+	if (getPlatformDisplay != NULL)
+		app->display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY_PTR, NULL);
+
+	if (app->display == NULL && egl.getDisplay != NULL)
+		app->display = egl.getDisplay(EGL_DEFAULT_DISPLAY_PTR);
+
+	int major, minor;
+
+	if (app->display == NULL || !egl.initialize(app->display, &major, &minor)) {
+		std::cout << "Unable to initialize EGL!\n";
+		app->display = NULL;
+		closeHeadlessLibraries();
+		return false;
+	}
+
+	egl.bindAPI(EGL_OPENGL_API);
+
+	const int attributes[] = {
+		EGL_CONTEXT_MAJOR_VERSION, 3,
+		EGL_CONTEXT_MINOR_VERSION, 3,
+		EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+		EGL_CONTEXT_OPENGL_DEBUG, app->debug ? 1 : 0,
+		EGL_NONE
+	};
+
+	// No config and no surface, everything gets drawn into our own FBO
+	app->context = egl.createContext(app->display, NULL, NULL, attributes);
+
+	if (app->context == NULL || !egl.makeCurrent(app->display, NULL, NULL, app->context)) {
+
+		std::cout << "Unable to create a surfaceless EGL context!\n";
+
+		// Nothing else uses the display, it goes with the context
+		if (app->context != NULL)
+			egl.destroyContext(app->display, app->context);
+
+		egl.terminate(app->display);
+		closeHeadlessLibraries();
+
+		app->context = NULL;
+		app->display = NULL;
+
+		return false;
+
+	}
+
+	return true;
+
+}
+
+static bool createOSMesaContext(AppContext *app) {
+
+	if (!loadOSMesa())
+		return false;
+
+	const int attributes[] = {
+		OSMESA_FORMAT, GL_RGBA,
+		OSMESA_DEPTH_BITS, 24,
+		OSMESA_PROFILE, OSMESA_CORE_PROFILE,
+		OSMESA_CONTEXT_MAJOR_VERSION, 3,
+		OSMESA_CONTEXT_MINOR_VERSION, 3,
+		0
+	};
+
+	app->context = osmesa.createContext(attributes, NULL);
+
+	if (app->context == NULL) {
+		std::cout << "Unable to create an OSMesa context!\n";
+		closeHeadlessLibraries();
+		return false;
+	}
+
+	// OSMesa renders the default framebuffer straight into this buffer
+	app->pixels = new unsigned char[app->width * app->height * 4];
+
+	if (!osmesa.makeCurrent(app->context, app->pixels, GL_UNSIGNED_BYTE, app->width, app->height)) {
+
+		std::cout << "Unable to make the OSMesa context current!\n";
+
+		osmesa.destroyContext(app->context);
+		closeHeadlessLibraries();
+
+		delete[] app->pixels;
+		app->pixels = NULL;
+		app->context = NULL;
+
+		return false;
+
+	}
+
+	return true;
+
+}
+
+static bool createHeadlessSharedContext(AppContext *app, AppSharedContext *shared) {
+
+	// The app's context loaded the library, and keeps it open
+	if (app->platform == GLAD_PLATFORM_EGL && egl.library != NULL) {
+
+		const int attributes[] = {
+			EGL_CONTEXT_MAJOR_VERSION, 3,
+			EGL_CONTEXT_MINOR_VERSION, 3,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_NONE
+		};
+
+		shared->context = egl.createContext(app->display, NULL, app->context, attributes);
+
+		return shared->context != NULL;
+
+	}
+
+	if (app->platform == GLAD_PLATFORM_OSMESA && osmesa.library != NULL) {
+
+		const int attributes[] = {
+			OSMESA_FORMAT, GL_RGBA,
+			OSMESA_PROFILE, OSMESA_CORE_PROFILE,
+			OSMESA_CONTEXT_MAJOR_VERSION, 3,
+			OSMESA_CONTEXT_MINOR_VERSION, 3,
+			0
+		};
+
+		shared->context = osmesa.createContext(attributes, app->context);
+
+		// A single pixel is plenty, nothing gets drawn with it
+		if (shared->context != NULL)
+			shared->pixels = new unsigned char[4];
+
+		return shared->context != NULL;
+
+	}
+
+	return false;
+
+}
+
+static bool makeHeadlessContextCurrent(AppContext *app, AppSharedContext *shared) {
+
+	void *context = shared != NULL ? shared->context : NULL;
+
+	if (app->platform == GLAD_PLATFORM_EGL && egl.library != NULL)
+		return egl.makeCurrent(app->display, NULL, NULL, context) != 0;
+
+	if (app->platform == GLAD_PLATFORM_OSMESA && osmesa.library != NULL) {
+		return (context != NULL
+			? osmesa.makeCurrent(context, shared->pixels, GL_UNSIGNED_BYTE, 1, 1)
+			: osmesa.makeCurrent(NULL, NULL, 0, 0, 0)) != 0;
+	}
+
+	return false;
+
+}
+
+static void destroyHeadlessSharedContext(AppContext *app, AppSharedContext *shared) {
+
+	if (app->platform == GLAD_PLATFORM_EGL && egl.library != NULL)
+		egl.destroyContext(app->display, shared->context);
+
+	if (app->platform == GLAD_PLATFORM_OSMESA && osmesa.library != NULL)
+		osmesa.destroyContext(shared->context);
+
+}
+
+static bool loadEGL() {
+
+	if (egl.library != NULL)
+		return true;
+
+	egl.library = dlopen("libEGL.so.1", RTLD_NOW | RTLD_GLOBAL);
+
+	if (egl.library == NULL) {
+		std::cout << "Unable to load libEGL.so.1!\n";
+		return false;
+	}
+
+	egl.getProcAddress = (void *(*)(const char*)) dlsym(egl.library, "eglGetProcAddress");
+	egl.getDisplay = (void *(*)(void*)) dlsym(egl.library, "eglGetDisplay");
+	egl.initialize = (unsigned int (*)(void*, int*, int*)) dlsym(egl.library, "eglInitialize");
+	egl.bindAPI = (unsigned int (*)(unsigned int)) dlsym(egl.library, "eglBindAPI");
+	egl.createContext = (void *(*)(void*, void*, void*, const int*)) dlsym(egl.library, "eglCreateContext");
+	egl.makeCurrent = (unsigned int (*)(void*, void*, void*, void*)) dlsym(egl.library, "eglMakeCurrent");
+	egl.destroyContext = (unsigned int (*)(void*, void*)) dlsym(egl.library, "eglDestroyContext");
+	egl.terminate = (unsigned int (*)(void*)) dlsym(egl.library, "eglTerminate");
+
+	// eglGetDisplay is only the fallback
+	if (egl.getProcAddress == NULL || egl.initialize == NULL || egl.bindAPI == NULL || egl.createContext == NULL
+		|| egl.makeCurrent == NULL || egl.destroyContext == NULL || egl.terminate == NULL) {
+		std::cout << "libEGL.so.1 is missing required functions!\n";
+		closeHeadlessLibraries();
+		return false;
+	}
+
+	return true;
+
+}
+
+static bool loadOSMesa() {
+
+	if (osmesa.library != NULL)
+		return true;
+
+	osmesa.library = dlopen("libOSMesa.so.8", RTLD_NOW | RTLD_GLOBAL);
+
+	if (osmesa.library == NULL)
+		osmesa.library = dlopen("libOSMesa.so", RTLD_NOW | RTLD_GLOBAL);
+
+	if (osmesa.library == NULL) {
+		std::cout << "Unable to load libOSMesa!\n";
+		return false;
+	}
+
+	osmesa.createContext = (void *(*)(const int*, void*)) dlsym(osmesa.library, "OSMesaCreateContextAttribs");
+	osmesa.makeCurrent = (unsigned char (*)(void*, void*, unsigned int, int, int)) dlsym(osmesa.library, "OSMesaMakeCurrent");
+	osmesa.destroyContext = (void (*)(void*)) dlsym(osmesa.library, "OSMesaDestroyContext");
+
+	if (osmesa.createContext == NULL || osmesa.makeCurrent == NULL || osmesa.destroyContext == NULL) {
+		std::cout << "libOSMesa is missing required functions!\n";
+		closeHeadlessLibraries();
+		return false;
+	}
+
+	return true;
+
+}
+
+static void closeHeadlessLibraries() {
+
+	if (egl.library != NULL)
+		dlclose(egl.library);
+
+	if (osmesa.library != NULL)
+		dlclose(osmesa.library);
+
+	egl = EGLFunctions();
+	osmesa = OSMesaFunctions();
+
+}
+
+#else
+
+static bool createEGLContext(AppContext *app) {
+
+	std::cout << "Headless EGL contexts are only supported on Linux!\n";
+	return false;
+
+}
+
+static bool createOSMesaContext(AppContext *app) {
+
+	std::cout << "Headless OSMesa contexts are only supported on Linux!\n";
+	return false;
+
+}
+
+static bool createHeadlessSharedContext(AppContext *app, AppSharedContext *shared) {
+
+	return false;
+
+}
+
+static bool makeHeadlessContextCurrent(AppContext *app, AppSharedContext *shared) {
+
+	return false;
+
+}
+
+static void destroyHeadlessSharedContext(AppContext *app, AppSharedContext *shared) {
+
+}
+
+#endif
+
+static void writeScreenshot(AppContext *app, const char *path) {
+
+	unsigned char *rgba = new unsigned char[app->width * app->height * 4];
+
+	glFinish();
+	glReadPixels(0, 0, app->width, app->height, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
+
+	std::ofstream file(path, std::ios::binary);
+
+	file << "P6\n" << app->width << " " << app->height << "\n255\n";
+
+	// PPM goes top to bottom, OpenGL bottom to top
+	for (int y = app->height - 1; y >= 0; y--) {
+		for (int x = 0; x < app->width; x++)
+			file.write((const char*) &rgba[(y * app->width + x) * 4], 3);
+	}
+
+	delete[] rgba;
+
+}
+
+static void reportMissingProc(const char *name) {
+
+	std::cout << "Missing GL entry point: " << name << "\n";
+
+}
@@ -0,0 +1,121 @@
+/*
+* Description: Shared window and context setup for the demos.
+*		Creates either a normal GLFW window or, when there is
+*		no display (or GLAD_PLATFORM says so), a headless EGL
+*		or OSMesa context that renders into an offscreen buffer.
+*		With the null platform there is no context at all and
+*		every GL call is a stub, which measures the CPU cost of
+*		the render loop by itself.
+*		The demos only talk to this, so the same render loop
+*		works in all cases.
+*
+*	Environment variables:
+*		GLAD_PLATFORM	native, egl, osmesa or null (see glad.h)
+*		APP_FRAMES	stop after this many frames (headless
+*				runs default to 100, null runs to
+*				1000000)
+*		APP_SCREENSHOT	write the last frame to this .ppm file
+*				when running headless
+*		APP_GL_DEBUG	create a debug context and print what
+*				the driver reported on exit (see
+*				GLDebugLog.h)
+*		APP_VERIFY_GL	fail startup if any entry point glad
+*				should have loaded is missing
+*		APP_TRACE	record every GL call into this file
+*				(see GLTrace.h, replay it with
+*				TraceReplay)
+*		APP_PROGRAM_CACHE	where compiled shader programs
+*				are kept between runs, off to disable
+*				(see ProgramCache.h)
+*		APP_SHADER_QUEUE	how programs get built in the
+*				background (see ShaderQueue.h)
+*		APP_SHADER_DIR	where shader files are loaded from
+*				(see ShaderReload.h)
+*		APP_STARTUP_TRACE, APP_STARTUP_MODE
+*				time startup up to the first frame,
+*				see StartupTimeline.h
+*		APP_SHADER_TELEMETRY, APP_SHADER_COUNTERS
+*				time every shader compile, link and
+*				first draw, see ShaderTelemetry.h
+*		APP_SHADER_PREWARM	off to skip drawing every shader
+*				once before the first frame (see
+*				ShaderPrewarm.h)
+*		APP_SHADER_PACK	the preprocessed shaders to load (see
+*				ShaderPack.h)
+*/
+
+#ifndef APP_CONTEXT_H
+#define APP_CONTEXT_H
+
+#include <chrono>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "GLCaps.h"
+
+struct AppContext {
+	GLFWwindow *window;		// NULL when running headless
+	int platform;			// One of the GLAD_PLATFORM_* values
+	int width, height;
+
+	int frame;			// Frames presented so far
+	int frameLimit;			// Close after this many frames (0 = never)
+	bool shouldClose;
+
+	GLCaps caps;			// What the loaded GL supports past 3.3
+	bool debug;			// Debug context requested, see GLDebugLog.h
+
+	// When the render loop started, for the frame rate printed on exit
+	std::chrono::steady_clock::time_point start;
+
+	// Headless only
+	void *display;			// EGLDisplay
+	void *context;			// EGLContext or OSMesaContext
+	unsigned char *pixels;		// OSMesa color buffer
+	unsigned int FBO, colorBuffer;	// EGL offscreen target
+};
+
+// A second context sharing objects (programs, buffers, ...) with the
+// app's one, for worker threads
+struct AppSharedContext {
+	GLFWwindow *window;		// Hidden window owning the context, GLFW only
+	void *context;			// EGLContext or OSMesaContext
+	unsigned char *pixels;		// OSMesa needs something to render into
+};
+
+bool createAppContext(AppContext*, int, int, const char*);
+// Creates a 3.3 core context of the given size and loads GL with glad.
+// Prints an error and returns false if anything failed
+
+bool appShouldClose(AppContext*);
+// Replaces glfwWindowShouldClose for render loops
+
+void appSetShouldClose(AppContext*);
+// Asks the render loop to stop
+
+bool appKeyPressed(AppContext*, int);
+// Replaces glfwGetKey(window, key) == GLFW_PRESS. Always false headless
+
+void appSetResizeCallback(AppContext*, GLFWframebuffersizefun);
+// Registers a framebuffer resize callback (ignored headless)
+
+void appSwapBuffers(AppContext*);
+// Presents the frame and polls events, or just finishes the frame headless
+
+bool createAppSharedContext(AppContext*, AppSharedContext*);
+// Creates a context sharing objects with the app's context. Call it on
+// the main thread, returns false if the platform can't share
+
+bool appMakeSharedContextCurrent(AppContext*, AppSharedContext*);
+// Makes the shared context current on the calling (worker) thread, or
+// releases it again when given NULL
+
+void destroyAppSharedContext(AppContext*, AppSharedContext*);
+// Destroys a shared context that is no longer current anywhere
+
+void destroyAppContext(AppContext*);
+// Tears everything down, including glfwTerminate. Runs without a
+// window print how many frames per second the loop managed
+
+#endif
@@ -0,0 +1,52 @@
+/*
+* Description: The shader Main and EBORectangle draw with, written
+*		once as a permutation base (see ShaderPermutations.h)
+*		instead of a copy of the same strings in every demo.
+*		Without any features it is the plain orange shader.
+*
+*		The GLSL is in shaders/BasicShader.vert and .frag and
+*		gets loaded from the shader pack (see ShaderPack.h).
+*
+*		The colors come from the BasicColors uniform block, laid
+*		out from C++ (see BlockLayout.h) so a demo fills its
+*		buffer with one glBufferData of the struct. The pack tool
+*		writes the GLSL declaration from the same field list.
+*		Block bindings start out at 0, bind the buffer there.
+*
+*	Features:
+*		HAS_COLOR	per vertex colors from attribute 1
+*		WIREFRAME	plain white, for glPolygonMode(GL_LINE)
+*/
+
+#ifndef BASIC_SHADER_H
+#define BASIC_SHADER_H
+
+#include "BlockLayout.h"
+#include "ShaderPack.h"
+
+#define BASIC_COLORS_FIELDS(FIELD) \
+	FIELD(Vec4, color) \
+	FIELD(Vec4, wireframeColor)
+
+DECLARE_BLOCK(BasicColors, STD140, BASIC_COLORS_FIELDS)
+
+const BasicColors BASIC_COLORS = { { 1.0f, 0.5f, 0.2f, 1.0f }, { 1.0f, 1.0f, 1.0f, 1.0f } };
+
+// Its stages come from the shader pack, NULL if the pack is missing
+inline const char *basicVertexShader() {
+
+	return packedShader("BasicShader.vert");
+
+}
+
+inline const char *basicFragmentShader() {
+
+	return packedShader("BasicShader.frag");
+
+}
+
+const char *const BASIC_FEATURES[] = { "HAS_COLOR", "WIREFRAME" };
+
+const int BASIC_FEATURE_COUNT = 2;
+
+#endif
@@ -0,0 +1,162 @@
+/*
+* Description: Uniform and storage block structs laid out by the
+*		compiler. A block is a list of (type, name) fields written
+*		once; DECLARE_BLOCK turns it into a C++ struct with every
+*		member where std140 (or std430) puts it, static_asserts
+*		that it really is there, and can write the matching GLSL
+*		declaration. Filling a block is then one memcpy of the
+*		struct into the mapped or bound buffer, no packing field
+*		by field, and the shader can't disagree with the C++ side
+*		because it was written from the same list.
+*
+*		Scalars, vectors and matrices line up by themselves.
+*		Arrays only do where the element stride the rules ask for
+*		is the element's own size (vec4, ivec4 and mat4 arrays,
+*		or anything in std430 but vec3); a float[4] in std140
+*		is a compile error, use Vec4 instead.
+*
+*		Typical use:
+*			#define LIGHT_FIELDS(FIELD) \
+*				FIELD(Vec3, direction) \
+*				FIELD(float, power) \
+*				FIELD(Vec4, color)
+*
+*			DECLARE_BLOCK(Light, STD140, LIGHT_FIELDS)
+*
+*			std::string glsl = Light::declaration("Light");	// layout(std140) uniform Light { ... };
+*			Light light = { ... };
+*			glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(light), &light);
+*/
+
+#ifndef BLOCK_LAYOUT_H
+#define BLOCK_LAYOUT_H
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+enum BlockPacking {
+	STD140,		// Uniform blocks, arrays and structs round up to a vec4
+	STD430		// Storage blocks (GL 4.3), arrays pack like their elements
+};
+
+// The GLSL types a block can hold, same memory as their GLSL versions
+struct Vec2 { float x, y; };
+struct Vec3 { float x, y, z; };
+struct Vec4 { float x, y, z, w; };
+struct IVec4 { int x, y, z, w; };
+struct Mat4 { float columns[4][4]; };	// Column major, like GLSL
+
+// Base alignment and size of each type, from the OpenGL spec (7.6.2.2)
+template <typename T>
+struct BlockType;
+
+template <> struct BlockType<float> { enum { ALIGN = 4, SIZE = 4 }; static const char *name() { return "float"; } };
+template <> struct BlockType<int> { enum { ALIGN = 4, SIZE = 4 }; static const char *name() { return "int"; } };
+template <> struct BlockType<unsigned int> { enum { ALIGN = 4, SIZE = 4 }; static const char *name() { return "uint"; } };
+template <> struct BlockType<Vec2> { enum { ALIGN = 8, SIZE = 8 }; static const char *name() { return "vec2"; } };
+template <> struct BlockType<Vec3> { enum { ALIGN = 16, SIZE = 12 }; static const char *name() { return "vec3"; } };
+template <> struct BlockType<Vec4> { enum { ALIGN = 16, SIZE = 16 }; static const char *name() { return "vec4"; } };
+template <> struct BlockType<IVec4> { enum { ALIGN = 16, SIZE = 16 }; static const char *name() { return "ivec4"; } };
+template <> struct BlockType<Mat4> { enum { ALIGN = 16, SIZE = 64 }; static const char *name() { return "mat4"; } };
+
+constexpr size_t roundUp(size_t value, size_t alignment) {
+	return (value + alignment - 1) / alignment * alignment;
+}
+
+// How a member of type T sits in a block with the given packing
+template <typename T, BlockPacking P>
+struct BlockMember {
+
+	enum { ALIGN = BlockType<T>::ALIGN, SIZE = BlockType<T>::SIZE };
+
+	static std::string declaration(const char *name) {
+		return std::string(BlockType<T>::name()) + " " + name;
+	}
+
+};
+
+template <typename T, size_t N, BlockPacking P>
+struct BlockMember<T[N], P> {
+
+	// std140 rounds the alignment of arrays up to a vec4, the stride
+	// is the element size rounded up to that
+	enum {
+		ALIGN = P == STD140 ? roundUp(BlockMember<T, P>::ALIGN, 16) : (size_t) BlockMember<T, P>::ALIGN,
+		STRIDE = roundUp(BlockMember<T, P>::SIZE, ALIGN),
+		SIZE = STRIDE * N
+	};
+
+	static std::string declaration(const char *name) {
+		return BlockMember<T, P>::declaration(name) + "[" + std::to_string(N) + "]";
+	}
+
+};
+
+// Offsets of a list of member types, worked out by the compiler
+template <BlockPacking P, typename... T>
+struct BlockFields;
+
+template <BlockPacking P>
+struct BlockFields<P> {
+
+	static constexpr size_t offsetFrom(size_t, size_t end) {
+		return end;
+	}
+
+};
+
+template <BlockPacking P, typename T, typename... Rest>
+struct BlockFields<P, T, Rest...> {
+
+	// The member at index, when the ones before this start at end
+	static constexpr size_t offsetFrom(size_t index, size_t end) {
+		return index == 0 ? roundUp(end, BlockMember<T, P>::ALIGN)
+			: BlockFields<P, Rest...>::offsetFrom(index - 1, roundUp(end, BlockMember<T, P>::ALIGN) + BlockMember<T, P>::SIZE);
+	}
+
+	static constexpr size_t offset(size_t index) {
+		return offsetFrom(index, 0);
+	}
+
+};
+
+// Lets FIELD(float[4], weights) declare an array member
+template <typename T>
+struct BlockIdentity {
+	typedef T Type;
+};
+
+#define BLOCK_FIELD_TYPE(type, name) , type
+#define BLOCK_FIELD_INDEX(type, name) FIELD_##name,
+#define BLOCK_FIELD_MEMBER(type, name) alignas(BlockMember<type, PACKING>::ALIGN) BlockIdentity<type>::Type name;
+#define BLOCK_FIELD_GLSL(type, name) + "\t" + BlockMember<type, PACKING>::declaration(#name) + ";\n"
+
+#define BLOCK_FIELD_CHECK(type, name) \
+	static_assert(offsetof(Checked, name) == Checked::Layout::offset(Checked::FIELD_##name), \
+		"Block member " #name " is not where the packing rules put it"); \
+	static_assert(sizeof(Checked::name) == BlockMember<type, Checked::PACKING>::SIZE, \
+		"Block member " #name " is an array the packing rules pad the elements of, use a vec4 type");
+
+// Declares the struct Block from the FIELDS list, checks its layout and
+// gives it declaration(name), the GLSL for a block of that name (a
+// uniform block for STD140, a storage block for STD430). The offsets
+// are Block::Layout::offset(Block::FIELD_name)
+#define DECLARE_BLOCK(Block, Packing, FIELDS) \
+	struct Block { \
+		static constexpr BlockPacking PACKING = Packing; \
+		typedef BlockFields<Packing FIELDS(BLOCK_FIELD_TYPE)> Layout; \
+		enum Field { FIELDS(BLOCK_FIELD_INDEX) FIELD_COUNT }; \
+		FIELDS(BLOCK_FIELD_MEMBER) \
+		static std::string declaration(const char *name) { \
+			return std::string(PACKING == STD140 ? "layout(std140) uniform " : "layout(std430) buffer ") \
+				+ name + " {\n" FIELDS(BLOCK_FIELD_GLSL) + "};\n"; \
+		} \
+	}; \
+	struct Block##Check { \
+		typedef Block Checked; \
+		static_assert(std::is_standard_layout<Block>::value, #Block " has to be standard layout to be copied into a buffer"); \
+		FIELDS(BLOCK_FIELD_CHECK) \
+	};
+
+#endif
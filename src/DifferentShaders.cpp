@@ -2,16 +2,45 @@
 * Description: A simple test of working with multiple
 *		shaders. This code will be more straight to the
 *		point as compared too my other files in this repo.
+*
+*	Environment variables:
+*		APP_SHADER_PIPELINE	1 to link the vertex shader once
+*					and swap only the fragment stage
+*					between the triangles (see
+*					ShaderPipeline.h). No hot reload
+*					in that mode
+*		APP_SHADER_MATERIALS	1 to load the shaders as two
+*					materials, which only differ in
+*					their color and so get folded into
+*					one program (see MaterialSystem.h),
+*					and draw both triangles at once
+*		APP_SHADER_PREWARM	off to skip drawing with each
+*					shader once offscreen, the frame
+*					it's ready, before it's drawn on
+*					screen
 */
 
 // Including core libraries
 #include <iostream>
 #include <cstdlib>
+#include <cstring>
+#include <string>
 
 // Including openGL dependencies
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+// Shared window/context setup
+#include "AppContext.h"
+#include "StartupTimeline.h"
+#include "ShaderQueue.h"
+#include "ShaderReload.h"
+#include "ShaderPipeline.h"
+#include "MaterialSystem.h"
+#include "ShaderTelemetry.h"
+#include "ShaderPrewarm.h"
+#include "ShaderPack.h"
+
 const int WIDTH = 800,
 	HEIGHT = 600;
 
@@ -23,68 +52,73 @@ void windowResized(GLFWwindow*, int, int);
 void generateVAO(unsigned int*, unsigned int*);
 // Generates the VAO to draw the two triangles
 
-bool generateShaderProg(unsigned int*, unsigned int*);
-// Generates out two shader programs. Returns true
-// if the process was a success
+bool generateShaderProg(int*, int*);
+// Loads our two shader programs from the shaders directory and
+// queues them (see ShaderReload.h). Returns false if a file is missing
 
-int main() {
+bool generatePipeline(unsigned int*, unsigned int*, unsigned int*, unsigned int*);
+// Builds the vertex shader and both fragment shaders as separable stages
+// and a pipeline to combine them in. Returns false (with nothing left
+// built) if one didn't build
 
-	if (glfwInit() == GLFW_FALSE) {
-		std::cout << "There was an error starting GLFW!\n";
+bool generateMaterials(int*, int*);
+// Loads the shaders from the shader pack as one material per triangle and
+// queues them. Returns false if one is missing
 
-		char dud;
-		std::cin >> dud;
+void generateMaterialVAO(int, int, unsigned int*);
+// One VAO holding both triangles, every vertex tagged with the material
+// index of its triangle
 
-		return -1;
-	}
+int main() {
 
-	// Setting the OpenGL version to 3.3 (CORE)
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	// Create window (or headless context) and load glad
+	AppContext app;
 
-	// For compatibility with Macs
-	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+	if (!createAppContext(&app, WIDTH, HEIGHT, WINDOW_NAME))
+		return -1;
 
-	// Create window object
-	GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, WINDOW_NAME, NULL, NULL);
+	// Set out viewport and configure callback function for resizing
+	glViewport(0, 0, WIDTH, HEIGHT);
+	appSetResizeCallback(&app, windowResized);
 
-	// Did it work?
-	if (window == NULL) {
-		std::cout << "Unable to create GLFW context!\n";
-		glfwTerminate();
+	// Programs, stages and materials alike (see ShaderTelemetry.h)
+	setShaderFamily("DifferentShaders");
 
-		char dud;
-		std::cin >> dud;
+	// Either three separable stages in one pipeline, or two whole programs
+	const char *wantPipeline = getenv("APP_SHADER_PIPELINE");
+	bool usePipeline = wantPipeline != NULL && strcmp(wantPipeline, "1") == 0 && app.caps.separateShaderObjects;
 
-		return -1;
-	}
+	// Or both shaders as materials of one program
+	const char *wantMaterials = getenv("APP_SHADER_MATERIALS");
+	bool useMaterials = !usePipeline && wantMaterials != NULL && strcmp(wantMaterials, "1") == 0;
 
-	// Set window as current context
-	glfwMakeContextCurrent(window);
+	// Start building the shaders, the render loop picks them up once ready
+	int shaderProg1 = -1, shaderProg2 = -1;
+	unsigned int pipeline = 0, vertex = 0, fragment1 = 0, fragment2 = 0;
+	int material1 = -1, material2 = -1;
+	bool generated;
 
-	// Load up glad to make, so it can manage our OS-Specific function pointers
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
-		// GLAD was unable to start :(
-		std::cout << "Unable to intialize GLAD with proc address!\nQuitting\n";
-		glfwTerminate();
-		return -1;
+	if (useMaterials) {
+		beginStartupPhase("generateMaterials");
+		generated = generateMaterials(&material1, &material2);
+		endStartupPhase();
+	}
+	else if (usePipeline) {
+		beginStartupPhase("generatePipeline");
+		generated = generatePipeline(&pipeline, &vertex, &fragment1, &fragment2);
+		endStartupPhase();
+	}
+	else {
+		beginStartupPhase("generateShaderProg");
+		generated = generateShaderProg(&shaderProg1, &shaderProg2);
+		endStartupPhase();
 	}
 
-	// Set out viewport and configure callback function for resizing
-	glViewport(0, 0, WIDTH, HEIGHT);
-	glfwSetFramebufferSizeCallback(window, windowResized);
-
-	// Attempt to generate shaders
-	unsigned int shaderProg1, shaderProg2;
-	if (!generateShaderProg(&shaderProg1, &shaderProg2)) {
+	if (!generated) {
 
 		std::cout << "There was an error generating the shaders!\n";
 
-		glfwTerminate();
-
-		char dud;
-		std::cin >> dud;
+		destroyAppContext(&app);
 
 		return -1;
 
@@ -92,39 +126,162 @@ int main() {
 
 	// Get the VAO
 	unsigned int VAO1, VAO2;
+	beginStartupPhase("generateVAO");
 	generateVAO(&VAO1, &VAO2);
+	endStartupPhase();
+
+	unsigned int materialVAO = 0;
+
+	if (useMaterials)
+		generateMaterialVAO(material1, material2, &materialVAO);
+
+	// The pipeline's stages are built already, so draw with them once
+	// before the first frame, so that frame doesn't wait on the driver
+	// finishing them (see ShaderPrewarm.h). Queued programs get the same
+	// the frame they're ready, in the render loop
+	if (usePipeline) {
+
+		// The pipeline gets drawn with the stages it has, so one pass
+		// per fragment stage
+		WarmDraw warm = { 0, pipeline, VAO1, GL_TRIANGLES, GL_UNSIGNED_INT, GL_FILL };
+
+		usePipelineStage(pipeline, GL_FRAGMENT_SHADER, fragment1);
+		addWarmDraw(warm);
+		prewarmShaders(&app);
+
+		warm.vao = VAO2;
+		usePipelineStage(pipeline, GL_FRAGMENT_SHADER, fragment2);
+		addWarmDraw(warm);
+		prewarmShaders(&app);
+
+	}
 
 	// Simple render loop
-	while (!glfwWindowShouldClose(window)) {
+	while (!appShouldClose(&app)) {
+
+		if (useMaterials) {
+
+			// Never waits, both triangles are flat grey until theirs is ready
+			pollShaderQueue();
+			pollMaterials();
+
+			glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+			glClear(GL_COLOR_BUFFER_BIT);
+
+			WarmDraw warm1 = { materialProgram(material1), 0, materialVAO, GL_TRIANGLES, 0, GL_FILL };
+			WarmDraw warm2 = { materialProgram(material2), 0, materialVAO, GL_TRIANGLES, 0, GL_FILL };
+			warmBeforeDraw(&app, warm1);
+			warmBeforeDraw(&app, warm2);
+
+			glBindVertexArray(materialVAO);
+
+			// Folded into one program, both triangles go in one draw. The
+			// colors come from the material parameters
+			if (warm1.program != 0 && warm1.program == warm2.program) {
+				useMaterial(material1);
+				glDrawArrays(GL_TRIANGLES, 0, 6);
+			}
+			else {
+				useMaterial(material1);
+				glDrawArrays(GL_TRIANGLES, 0, 3);
+				useMaterial(material2);
+				glDrawArrays(GL_TRIANGLES, 3, 3);
+			}
+
+			glBindVertexArray(0);
+
+			appSwapBuffers(&app);
+			continue;
+
+		}
+
+		if (usePipeline) {
+
+			glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+			glClear(GL_COLOR_BUFFER_BIT);
+
+			// The vertex stage stays put, only the fragment stage changes
+			bindPipeline(pipeline);
+
+			usePipelineStage(pipeline, GL_FRAGMENT_SHADER, fragment1);
+			glBindVertexArray(VAO1);
+			glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0);
+
+			usePipelineStage(pipeline, GL_FRAGMENT_SHADER, fragment2);
+			glBindVertexArray(VAO2);
+			glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0);
+
+			glBindVertexArray(0);
+
+			appSwapBuffers(&app);
+			continue;
+
+		}
+
+		// See which shaders finished or changed since the last frame,
+		// never waits. Edit the files in shaders/ to see them reload
+		pollShaderQueue();
+		pollShaderReload();
 
 		// Clear screen
 		glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
 		glClear(GL_COLOR_BUFFER_BIT);
 
-		// Set the shader
-		glUseProgram(shaderProg1);
-		glBindVertexArray(VAO1);
+		// Each triangle is flat grey until its shader is ready, and only
+		// missing when its shader failed
+		unsigned int program1 = watchedProgramOrFallback(shaderProg1);
+		unsigned int program2 = watchedProgramOrFallback(shaderProg2);
+
+		// Drawn once offscreen the frame each one is ready, or reloaded
+		WarmDraw warm1 = { program1, 0, VAO1, GL_TRIANGLES, GL_UNSIGNED_INT, GL_FILL };
+		WarmDraw warm2 = { program2, 0, VAO2, GL_TRIANGLES, GL_UNSIGNED_INT, GL_FILL };
+		warmBeforeDraw(&app, warm1);
+		warmBeforeDraw(&app, warm2);
+
+		if (program1 != 0) {
+
+			glUseProgram(program1);
+			glBindVertexArray(VAO1);
+
+			glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0);
+
+		}
+
+		if (program2 != 0) {
 
-		glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0);
+			glUseProgram(program2);
+			glBindVertexArray(VAO2);
 
-		glUseProgram(shaderProg2);
-		glBindVertexArray(VAO2);
+			glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0);
 
-		glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0);
+		}
 
 		glBindVertexArray(0);
 
-		// Swap buffers
-		glfwSwapBuffers(window);
+		// Swap buffers and handle various events
+		appSwapBuffers(&app);
 
-		// Handle various events
-		glfwPollEvents();
+	}
+
+	// A shader that never built is still an error, even if the
+	// window stayed open
+	bool built = usePipeline
+		|| (useMaterials ? materialProgram(material1) != 0 && materialProgram(material2) != 0
+			: watchedProgram(shaderProg1) != 0 && watchedProgram(shaderProg2) != 0);
+
+	int status = built ? 0 : -1;
 
+	// The stages are only in use while the pipeline is
+	if (usePipeline) {
+		deletePipeline(pipeline);
+		deleteStageProgram(vertex);
+		deleteStageProgram(fragment1);
+		deleteStageProgram(fragment2);
 	}
 
-	glfwTerminate();
+	destroyAppContext(&app);
 
-	return 0;
+	return status;
 
 }
 
@@ -134,135 +291,131 @@ void windowResized(GLFWwindow *window, int width, int height) {
 
 }
 
-// Will return true if the shaders could be created
-bool generateShaderProg(unsigned int *SHADER_PROG1, unsigned int *SHADER_PROG2) {
+// Loads both programs from their files and queues them, they get built
+// while the render loop runs and rebuilt whenever a file changes
+bool generateShaderProg(int *SHADER_PROG1, int *SHADER_PROG2) {
 
 	// Only need 1 vertex shader, but two fragment shaders for different colors!
-	const char *vShader =
-		"#version 330 core\n"
-		"layout (location = 0) in vec3 aPos;\n"
-		"void main() {\n"
-		"	gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
-		"}";
-
-	const char *fShader1 =
-		"#version 330 core\n"
-		"out vec4 FragColor;\n"
-		"void main() {"
-		"	FragColor = vec4(0.5, 0.5, 0.1, 1.0);\n"
-		"}";
-
-	const char *fShader2 =
-		"#version 330 core\n"
-		"out vec4 FragColor;\n"
-		"void main() {"
-		"	FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
-		"}";
-
-	// Create shader objects
-	unsigned int vShaderID, fShaderID1, fShaderID2;
-
-	vShaderID = glCreateShader(GL_VERTEX_SHADER);
-	fShaderID1 = glCreateShader(GL_FRAGMENT_SHADER);
-	fShaderID2 = glCreateShader(GL_FRAGMENT_SHADER);
-
-	// Set shader source
-	glShaderSource(vShaderID, 1, &vShader, NULL);
-	glShaderSource(fShaderID1, 1, &fShader1, NULL);
-	glShaderSource(fShaderID2, 1, &fShader2, NULL);
-
-	// Compile
-	glCompileShader(vShaderID);
-	glCompileShader(fShaderID1);
-	glCompileShader(fShaderID2);
-
-	// Check for compilation errors
-	int success;
-	char infoLog[512];
-
-	glGetProgramiv(vShaderID, GL_COMPILE_STATUS, &success);
-
-	if (!success) {
-
-		glGetShaderInfoLog(vShaderID, 512, NULL, infoLog);
-
-		std::cout << "There was an error compiling the Vertex Shader!\n"
-			<< infoLog;
-
-		return false;
-	}
+	std::string directory = shaderDirectory();
+	std::string vShader = directory + "/DifferentShaders.vert";
+	std::string fShader1 = directory + "/DifferentShaders1.frag";
+	std::string fShader2 = directory + "/DifferentShaders2.frag";
+
+	ShaderFile files1[] = { { GL_VERTEX_SHADER, vShader.c_str() }, { GL_FRAGMENT_SHADER, fShader1.c_str() } };
+	ShaderFile files2[] = { { GL_VERTEX_SHADER, vShader.c_str() }, { GL_FRAGMENT_SHADER, fShader2.c_str() } };
 
-	glGetProgramiv(fShaderID1, GL_COMPILE_STATUS, &success);
+	// Both compiles and links get submitted right here, the vertex shader
+	// only once since both programs use it. Nothing waits for the driver
+	*SHADER_PROG1 = watchProgram(files1, 2);
+	*SHADER_PROG2 = watchProgram(files2, 2);
 
-	if (!success) {
+	return *SHADER_PROG1 >= 0 && *SHADER_PROG2 >= 0;
 
-		glGetShaderInfoLog(fShaderID1, 512, NULL, infoLog);
+}
 
-		std::cout << "There was an error compiling the Fragment Shaders!\n"
-			<< infoLog;
+// Same shaders, but each one linked on its own. Nothing reloads them in this
+// mode, so they come from the shader pack instead of the files. The pipeline
+// gets the vertex stage here and a fragment stage before every draw
+bool generatePipeline(unsigned int *pipeline, unsigned int *vertex, unsigned int *fragment1, unsigned int *fragment2) {
 
-		return false;
+	const char *names[] = { "DifferentShaders.vert", "DifferentShaders1.frag", "DifferentShaders2.frag" };
+	unsigned int types[] = { GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, GL_FRAGMENT_SHADER };
+	unsigned int stages[3] = { 0, 0, 0 };
 
-	}
+	// Three links for three stages, however many combinations get drawn
+	for (int i = 0; i < 3; i++) {
+
+		const char *source = packedShader(names[i]);
 
-	glGetProgramiv(fShaderID2, GL_COMPILE_STATUS, &success);
+		if (source != NULL)
+			stages[i] = createStageProgram(types[i], source);
 
-	if (!success) {
+		if (stages[i] == 0) {
 
-		glGetShaderInfoLog(fShaderID2, 512, NULL, infoLog);
+			// Whatever did build goes, main never gets to see it
+			for (int s = 0; s < i; s++)
+				deleteStageProgram(stages[s]);
 
-		std::cout << "There was an error compiling the Fragment Shaders!\n"
-			<< infoLog;
+			return false;
 
-		return false;
+		}
 
 	}
 
-	// Start the creation of the two shader programs
-	*SHADER_PROG1 = glCreateProgram();
-	*SHADER_PROG2 = glCreateProgram();
+	*pipeline = createPipeline();
+	usePipelineStage(*pipeline, GL_VERTEX_SHADER, stages[0]);
 
-	// Attatch the necessary shaders, and link
-	glAttachShader(*SHADER_PROG1, vShaderID);
-	glAttachShader(*SHADER_PROG1, fShaderID1);
+	*vertex = stages[0];
+	*fragment1 = stages[1];
+	*fragment2 = stages[2];
 
-	glAttachShader(*SHADER_PROG2, vShaderID);
-	glAttachShader(*SHADER_PROG2, fShaderID2);
+	return true;
 
-	glLinkProgram(*SHADER_PROG1);
-	glLinkProgram(*SHADER_PROG2);
+}
 
-	// Make sure programs could be linked
-	glGetProgramiv(*SHADER_PROG1, GL_LINK_STATUS, &success);
+// Same shaders from the shader pack, as two materials. The only difference
+// between them is the color constant, so queueMaterials makes one program
+// out of them
+bool generateMaterials(int *material1, int *material2) {
 
-	if (!success) {
+	const char *names[] = { "DifferentShaders.vert", "DifferentShaders1.frag", "DifferentShaders2.frag" };
+	const char *sources[3];
 
-		glGetProgramInfoLog(*SHADER_PROG1, 512, NULL, infoLog);
+	for (int i = 0; i < 3; i++) {
 
-		std::cout << "There was an error linking the shaders!\n"
-			<< infoLog;
+		sources[i] = packedShader(names[i]);
+
+		if (sources[i] == NULL)
+			return false;
 
-		return false;
 	}
 
-	glGetProgramiv(*SHADER_PROG2, GL_LINK_STATUS, &success);
-	
-	if (!success) {
+	ShaderStage stages1[] = { { GL_VERTEX_SHADER, sources[0] }, { GL_FRAGMENT_SHADER, sources[1] } };
+	ShaderStage stages2[] = { { GL_VERTEX_SHADER, sources[0] }, { GL_FRAGMENT_SHADER, sources[2] } };
 
-		glGetProgramInfoLog(*SHADER_PROG2, 512, NULL, infoLog);
+	*material1 = addMaterial(stages1, 2);
+	*material2 = addMaterial(stages2, 2);
 
-		std::cout << "There was an error linking the shaders!\n"
-			<< infoLog;
+	queueMaterials(true);
 
-		return false;
-	}
+	return true;
+
+}
 
-	// Delete the shaders
-	glDeleteShader(vShaderID);
-	glDeleteShader(fShaderID1);
-	glDeleteShader(fShaderID2);
+// Both triangles in one buffer, the middle vertex twice since each copy
+// belongs to a different material
+void generateMaterialVAO(int material1, int material2, unsigned int *VAO) {
 
-	return true;
+	float vertices[] = {
+		-0.5f, 0.5f, 0.0f,
+		-1.0f, -0.5f, 0.0f,
+		0.0f, -0.5f, 0.0f,
+		0.0f, -0.5f, 0.0f,
+		0.5f, 0.5f, 0.0f,
+		1.0f, -0.5f, 0.0f
+	};
+
+	int index1 = materialIndex(material1), index2 = materialIndex(material2);
+	int indices[] = { index1, index1, index1, index2, index2, index2 };
+
+	unsigned int buffers[2];
+	glGenVertexArrays(1, VAO);
+	glGenBuffers(2, buffers);
+
+	glBindVertexArray(*VAO);
+
+	glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*) 0);
+	glEnableVertexAttribArray(0);
+
+	// Integer attribute, so no conversion to float on the way
+	glBindBuffer(GL_ARRAY_BUFFER, buffers[1]);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+	glVertexAttribIPointer(MATERIAL_ATTRIBUTE, 1, GL_INT, sizeof(int), (void*) 0);
+	glEnableVertexAttribArray(MATERIAL_ATTRIBUTE);
+
+	glBindVertexArray(0);
 
 }
 
@@ -17,82 +17,54 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+// Shared window/context setup
+#include "AppContext.h"
+#include "StartupTimeline.h"
+#include "ShaderPermutations.h"
+#include "ShaderQueue.h"
+#include "BasicShader.h"
+#include "ShaderTelemetry.h"
+#include "ShaderPrewarm.h"
+
 // Window options
 const char *WINDOW_NAME = "Element Buffer Object Rectangle";
 
 const int WIDTH = 800,
 HEIGHT = 600;
 
-// Shaders written in GLSL
-const char *vertexShader =
-"#version 330 core\n"
-"layout (location = 0) in vec3 aPos;\n"
-"void main() {\n"
-"	gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
-"}";
-
-const char *fragmentShader =
-"#version 330 core\n"
-"out vec4 FragColor;\n"
-"void main() {\n"
-"	FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
-"}";
+// Set by the arrow keys, picks the shader permutation to draw with
+bool wireframe = false;
 
 void framebuffer_size_callback(GLFWwindow*, int, int);
 // Called by GLFW automatically when the window is resized
 
-int startRenderLoop(GLFWwindow*);
+int startRenderLoop(AppContext*);
 // The function to start the render loop. Should only be
 // called after OpenGL, GLFW, and GLAD are setup
 // Returns the status that the program should exit with
 
-void handleInput(GLFWwindow*);
+void handleInput(AppContext*);
 // Handles basic user input (call in render loop)
 
-void draw(GLFWwindow*, unsigned int, unsigned int);
-// Clears the screen etc.
+void draw(AppContext*, int, unsigned int);
+// Clears the screen etc. Takes the shader's permutation handle
 
-unsigned int generateVAO();
+unsigned int generateVAO(const GLCaps&);
 // Generates the VAO that should be used to draw
-// the rectangle
+// the rectangle, with direct state access when the driver has it
 
-bool generateShaderPg(unsigned int*);
-// Generates the shader program
+bool generateShaderPg(int*);
+// Starts building the shader program in the background, returning the
+// handle of its permutations (see ShaderPermutations.h)
 
 int main() {
 
-	// Intialize GLFW
-	if (glfwInit() == GL_FALSE) {
-		std::cout << "An error has occurred while trying to start GLFW!\nQuitting..\n";
-		return -1;
-	}
-
-	// Setting the OpenGL version to 3.3 (CORE)
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	// Create our window (or a headless context) and load up glad,
+	// so it can manage our OS-Specific function pointers
+	AppContext app;
 
-	// For compatibility with Macs
-	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-
-	// Create our window object!
-	GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, WINDOW_NAME, NULL, NULL);
-
-	if (window == NULL) {
-		// The window couldn't be created
-		std::cout << "GLFW failed to created the window context!\n";
-		glfwTerminate();
-		return -1;
-	}
-
-	// If window is created, set it to our current context
-	glfwMakeContextCurrent(window);
-
-	// Load up glad to make, so it can manage our OS-Specific function pointers
-	if (!gladLoadGLLoader((GLADloadproc) glfwGetProcAddress)) {
-		// GLAD was unable to start :(
-		std::cout << "Unable to intialize GLAD with proc address!\nQuitting\n";
-		glfwTerminate();
+	if (!createAppContext(&app, WIDTH, HEIGHT, WINDOW_NAME)) {
+		std::cout << "Quitting..\n";
 		return -1;
 	}
 
@@ -100,11 +72,14 @@ int main() {
 	glViewport(0, 0, WIDTH, HEIGHT);
 
 	// Register the framebuffer resize callback function
-	glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+	appSetResizeCallback(&app, framebuffer_size_callback);
 
-	int progStatus = startRenderLoop(window);
+	// Everything it builds is the basic shader (see ShaderTelemetry.h)
+	setShaderFamily("Basic");
 
-	glfwTerminate();
+	int progStatus = startRenderLoop(&app);
+
+	destroyAppContext(&app);
 
 	return progStatus;
 
@@ -119,44 +94,47 @@ void framebuffer_size_callback(GLFWwindow *window, int width, int height) {
 }
 
 // The main loop of the program here.. Keeps it running
-int startRenderLoop(GLFWwindow *window) {
+int startRenderLoop(AppContext *app) {
 
-	// Get shader program ID
-	unsigned int shaderProgram;
+	// Get shader permutations handle
+	int shaderProgram;
 
 	// Make sure the shader was successfully created
-	if (!generateShaderPg(&shaderProgram)) {
+	beginStartupPhase("generateShaderPg");
+	bool generated = generateShaderPg(&shaderProgram);
+	endStartupPhase();
+
+	if (!generated) {
 		
 		// If we get here, something bad happened, so notify the user
 		std::cout << "\nThere was an error while generating the shaders!\n";
-		
-		// Hold open console so we can see any errors
-		char dud;
-		std::cin >> dud;
 
 		// terminate everything
-		glfwSetWindowShouldClose(window, GLFW_TRUE);
+		appSetShouldClose(app);
 
 		return -1;
 
 	}
 
 	// Get our VAO ID
-	unsigned int VAO = generateVAO();
+	beginStartupPhase("generateVAO");
+	unsigned int VAO = generateVAO(app->caps);
+	endStartupPhase();
 
-	while (!glfwWindowShouldClose(window)) {
+	while (!appShouldClose(app)) {
 
 		// Check for any user input
-		handleInput(window);
+		handleInput(app);
 
-		// Draw
-		draw(window, shaderProgram, VAO);
+		// Pick up shaders that finished building, never waits
+		pollShaderQueue();
 
-		// Display all that was on the back buffer
-		glfwSwapBuffers(window);
+		// Draw
+		draw(app, shaderProgram, VAO);
 
-		// Poll any events triggers stored in GLFW
-		glfwPollEvents();
+		// Display all that was on the back buffer and poll any
+		// events triggers stored in GLFW
+		appSwapBuffers(app);
 
 	}
 
@@ -165,32 +143,42 @@ int startRenderLoop(GLFWwindow *window) {
 }
 
 // Basically going to detect an esc press
-void handleInput(GLFWwindow *window) {
+void handleInput(AppContext *app) {
 
-	if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
+	if (appKeyPressed(app, GLFW_KEY_ESCAPE)) {
 		// If an escape key press is detected, set the window to close
-		glfwSetWindowShouldClose(window, GLFW_TRUE);
+		appSetShouldClose(app);
 	}
 
-	if (glfwGetKey(window, GLFW_KEY_RIGHT) == GLFW_PRESS) {
+	if (appKeyPressed(app, GLFW_KEY_RIGHT)) {
 		glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+		wireframe = true;
 	}
 
-	if (glfwGetKey(window, GLFW_KEY_LEFT) == GLFW_PRESS) {
+	if (appKeyPressed(app, GLFW_KEY_LEFT)) {
 		glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+		wireframe = false;
 	}
 
 }
 
 // Clears the screen color and draws the next frame
-void draw(GLFWwindow *window, unsigned int shaderProg, unsigned int VAO) {
+void draw(AppContext *app, int shader, unsigned int VAO) {
 
 	// Clear the back buffer
 	glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
 	glClear(GL_COLOR_BUFFER_BIT);
 
-	// Now draw that sexy rectangle!
-	glUseProgram(shaderProg);
+	// Now draw that sexy rectangle! In white when it's lines, and flat
+	// grey while that version is still building
+	unsigned int features = wireframe ? permutationFeature(shader, "WIREFRAME") : 0;
+	unsigned int program = drawPermutation(shader, features);
+
+	// Once per version, the frame it's first ready (see ShaderPrewarm.h)
+	WarmDraw warm = { program, 0, VAO, GL_TRIANGLES, GL_UNSIGNED_INT, (unsigned int) (wireframe ? GL_LINE : GL_FILL) };
+	warmBeforeDraw(app, warm);
+
+	glUseProgram(program);
 	glBindVertexArray(VAO);
 
 	// The draw function to be used with EBOs.
@@ -206,7 +194,7 @@ void draw(GLFWwindow *window, unsigned int shaderProg, unsigned int VAO) {
 }
 
 // Generates the Vertex Array Object for the rectangle
-unsigned int generateVAO() {
+unsigned int generateVAO(const GLCaps &caps) {
 
 	// Vertices and indices for our rectangle
 	float vertices[] = {
@@ -220,8 +208,33 @@ unsigned int generateVAO() {
 		1, 2, 3    // second triangle
 	};
 
-	// Created VAO to store my vertex's
 	unsigned int VAO;
+
+	if (caps.directStateAccess) {
+
+		// With DSA nothing has to be bound, and the buffers get
+		// immutable storage sized once
+		unsigned int buffers[2];
+		glCreateBuffers(2, buffers);
+
+		glNamedBufferStorage(buffers[0], sizeof(vertices), vertices, 0);
+		glNamedBufferStorage(buffers[1], sizeof(indices), indices, 0);
+
+		glCreateVertexArrays(1, &VAO);
+
+		// Vertex buffer at binding 0, feeding attribute 0
+		glVertexArrayVertexBuffer(VAO, 0, buffers[0], 0, 3 * sizeof(float));
+		glVertexArrayElementBuffer(VAO, buffers[1]);
+
+		glVertexArrayAttribFormat(VAO, 0, 3, GL_FLOAT, GL_FALSE, 0);
+		glVertexArrayAttribBinding(VAO, 0, 0);
+		glEnableVertexArrayAttrib(VAO, 0);
+
+		return VAO;
+
+	}
+
+	// The 3.3 way. Created VAO to store my vertex's
 	glGenVertexArrays(1, &VAO);
 
 	// Genearte the buffer for the VBO
@@ -260,85 +273,31 @@ unsigned int generateVAO() {
 
 // Don't mind the pass by pointer, I'm just testing some things out
 // pass by reference would have worked just fine
-bool generateShaderPg(unsigned int *PROG_ID) {
-
-	unsigned int vShaderID, fShaderID;
-
-	// Create the shader objects
-	vShaderID = glCreateShader(GL_VERTEX_SHADER);
-	fShaderID = glCreateShader(GL_FRAGMENT_SHADER);
-
-	// Set the shader source code and compile them
-	glShaderSource(vShaderID, 1, &vertexShader, NULL);
-	glShaderSource(fShaderID, 1, &fragmentShader, NULL);
-
-	glCompileShader(vShaderID);
-	glCompileShader(fShaderID);
-
-	// Check for errors
-	int success;
-	char log[512];
-
-	glGetProgramiv(vShaderID, GL_COMPILE_STATUS, &success);
-	
-	if (!success) {
+bool generateShaderPg(int *SHADER) {
 
-		// Get some info on why the shader failed
-		glGetShaderInfoLog(vShaderID, 512, NULL, log);
+	// Same basic shader as the other demos, with a wireframe version
+	// for when the rectangle is drawn as lines (see BasicShader.h)
+	const char *vertexShader = basicVertexShader(), *fragmentShader = basicFragmentShader();
 
-		std::cout << "There was an error compiling the vertex shader source code!\n"
-			<< log;
-
-		// 'Error' out since the shader couldn't be compiled
+	if (vertexShader == NULL || fragmentShader == NULL)
 		return false;
-	}
-
-	glGetProgramiv(fShaderID, GL_COMPILE_STATUS, &success);
 
-	if (!success) {
+	ShaderStage stages[] = { { GL_VERTEX_SHADER, vertexShader }, { GL_FRAGMENT_SHADER, fragmentShader } };
 
-		// Get some info on why this shader failed
-		glGetShaderInfoLog(fShaderID, 512, NULL, log);
+	*SHADER = createPermutations(stages, 2, BASIC_FEATURES, BASIC_FEATURE_COUNT);
 
-		std::cout << "There was an error compiling the fragment shader source code!\n"
-			<< log;
-
-		// 'Error' out since the shader couldn't be compiled
-		return false;
-	
-	}
+	// The colors the shader draws with, copied straight from the struct
+	// its uniform block was declared from. Every block reads binding 0
+	unsigned int colors;
+	glGenBuffers(1, &colors);
+	glBindBuffer(GL_UNIFORM_BUFFER, colors);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(BASIC_COLORS), &BASIC_COLORS, GL_STATIC_DRAW);
+	glBindBufferBase(GL_UNIFORM_BUFFER, 0, colors);
 
-	// Create the shader program
-	*PROG_ID = glCreateProgram();
+	// Only the filled version gets queued up front, the wireframe one
+	// waits until somebody presses RIGHT. Neither gets waited on here
+	queuePermutation(*SHADER, 0);
 
-	// Assign the above shaders to the program
-	glAttachShader(*PROG_ID, vShaderID);
-	glAttachShader(*PROG_ID, fShaderID);
-
-	// Link the shaders together as one 'program'
-	glLinkProgram(*PROG_ID);
-
-	// Figure out if the linking was successful
-	glGetProgramiv(*PROG_ID, GL_LINK_STATUS, &success);
-
-	if (!success) {
-
-		// Get some info on why the program failed
-		glGetProgramInfoLog(*PROG_ID, 512, NULL, log);
-
-		std::cout << "There was an error linking the shader program!\n"
-			<< log;
-
-		// Once again error out if something went wrong
-		return false;
-
-	}
-
-	// Delete the shaders since they are part of a program now
-	glDeleteShader(vShaderID);
-	glDeleteShader(fShaderID);
-
-	// If all goes well, then return true!
 	return true;
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,100 @@
+#include "GLCaps.h"
+
+// Including core libraries
+#include <cstdlib>
+#include <cstring>
+
+#include <glad/glad.h>
+
+GLCaps detectGLCaps() {
+
+	GLCaps caps = GLCaps();
+
+	caps.major = GLVersion.major;
+	caps.minor = GLVersion.minor;
+
+	caps.directStateAccess = GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access;
+	caps.bufferStorage = GLAD_GL_VERSION_4_4 || GLAD_GL_ARB_buffer_storage;
+	caps.multiDrawIndirect = GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_multi_draw_indirect;
+	caps.debugOutput = GLAD_GL_VERSION_4_3 || GLAD_GL_KHR_debug;
+	caps.parallelShaderCompile = GLAD_GL_KHR_parallel_shader_compile != 0;
+	caps.separateShaderObjects = GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_separate_shader_objects;
+	caps.spirv = GLAD_GL_VERSION_4_6 || GLAD_GL_ARB_gl_spirv;
+
+	// Some drivers expose the entry points but no formats, which makes
+	// binaries useless
+	if (GLAD_GL_VERSION_4_1 || GLAD_GL_ARB_get_program_binary) {
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &caps.programBinaryFormats);
+		caps.programBinary = caps.programBinaryFormats > 0;
+	}
+
+	// Extension flags can be set on a driver that fails to give us the
+	// functions, so check the ones each tier relies on too
+	if (caps.directStateAccess && (glCreateBuffers == NULL || glNamedBufferStorage == NULL || glCreateVertexArrays == NULL))
+		caps.directStateAccess = false;
+
+	if (caps.bufferStorage && glBufferStorage == NULL)
+		caps.bufferStorage = false;
+
+	if (caps.multiDrawIndirect && glMultiDrawElementsIndirect == NULL)
+		caps.multiDrawIndirect = false;
+
+	if (caps.debugOutput && glDebugMessageCallback == NULL)
+		caps.debugOutput = false;
+
+	if (caps.separateShaderObjects && (glCreateShaderProgramv == NULL || glUseProgramStages == NULL || glGenProgramPipelines == NULL))
+		caps.separateShaderObjects = false;
+
+	if (caps.spirv && (glShaderBinary == NULL || (GLAD_GL_VERSION_4_6 ? glSpecializeShader == NULL : glSpecializeShaderARB == NULL)))
+		caps.spirv = false;
+
+	caps.tier = TIER_3_3;
+
+	if (caps.bufferStorage && caps.multiDrawIndirect && caps.debugOutput) {
+		caps.tier = TIER_4_3;
+
+		if (caps.directStateAccess)
+			caps.tier = TIER_4_5;
+	}
+
+	// Pretend to be an older driver
+	const char *limit = getenv("APP_GL_TIER");
+
+	if (limit != NULL) {
+
+		int maxTier = strcmp(limit, "3.3") == 0 ? TIER_3_3
+			: strcmp(limit, "4.3") == 0 ? TIER_4_3
+			: TIER_4_5;
+
+		if (maxTier < TIER_4_5)
+			caps.directStateAccess = false;
+
+		if (maxTier < TIER_4_3) {
+			caps.bufferStorage = false;
+			caps.multiDrawIndirect = false;
+			caps.debugOutput = false;
+			caps.programBinary = false;
+			caps.parallelShaderCompile = false;
+			caps.separateShaderObjects = false;
+			caps.spirv = false;
+		}
+
+		if (caps.tier > maxTier)
+			caps.tier = maxTier;
+
+	}
+
+	return caps;
+
+}
+
+const char *glTierName(int tier) {
+
+	switch (tier) {
+	case TIER_4_3: return "4.3";
+	case TIER_4_5: return "4.5";
+	}
+
+	return "3.3";
+
+}
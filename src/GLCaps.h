@@ -0,0 +1,48 @@
+/*
+* Description: What the loaded GL can do beyond the 3.3 core the
+*		demos are written against. glad resolves everything up to
+*		4.6 plus the ARB/KHR extensions for the same features, so
+*		a feature counts as available if either the version or
+*		the extension is there. Render code branches on these
+*		flags (or on the tier, when it needs several of them
+*		together) and keeps its 3.3 path for everything else.
+*
+*	Environment variables:
+*		APP_GL_TIER	cap the detected tier at 3.3, 4.3 or
+*				4.5, to run the fallback paths on a
+*				driver that has more
+*/
+
+#ifndef GL_CAPS_H
+#define GL_CAPS_H
+
+enum GLTier {
+	TIER_3_3,	// Core 3.3 only
+	TIER_4_3,	// Plus immutable buffer storage, multi draw indirect and debug output
+	TIER_4_5	// Plus direct state access
+};
+
+struct GLCaps {
+	int major, minor;		// Version the context reports
+	int tier;			// Highest GLTier everything is available for
+
+	bool directStateAccess;		// 4.5 or ARB_direct_state_access
+	bool bufferStorage;		// 4.4 or ARB_buffer_storage
+	bool multiDrawIndirect;		// 4.3 or ARB_multi_draw_indirect
+	bool debugOutput;		// 4.3 or KHR_debug
+	bool programBinary;		// 4.1 or ARB_get_program_binary, with at least one binary format
+	bool parallelShaderCompile;	// KHR_parallel_shader_compile
+	bool separateShaderObjects;	// 4.1 or ARB_separate_shader_objects
+	bool spirv;			// 4.6 or ARB_gl_spirv, shaders from SPIR-V binaries
+
+	int programBinaryFormats;	// Number of program binary formats the driver offers
+};
+
+GLCaps detectGLCaps();
+// Fills in the capabilities of the current context. GL has to be loaded
+// already
+
+const char *glTierName(int);
+// "3.3", "4.3" or "4.5"
+
+#endif
@@ -0,0 +1,251 @@
+#include "GLDebugLog.h"
+
+// Including core libraries
+#include <iostream>
+#include <cstring>
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <glad/glad.h>
+
+// Messages queued between two flushes before new ones get dropped
+const unsigned int RING_SIZE = 1024;
+
+// Longer messages get cut off in the ring
+const int MAX_MESSAGE = 256;
+
+struct DebugMessage {
+	std::atomic<unsigned int> sequence;	// Which lap of the ring this slot is ready for
+	GLenum source, type, severity;
+	GLuint id;
+	int frame;
+	char text[MAX_MESSAGE];
+};
+
+// Bounded multi-producer queue: producers claim a slot by bumping head,
+// fill it, then publish it through the slot's sequence number
+static DebugMessage ring[RING_SIZE];
+static std::atomic<unsigned int> ringHead;
+static unsigned int ringTail;
+
+static std::atomic<int> currentFrame;
+static std::atomic<unsigned int> dropped;
+static bool installed;
+
+struct LogEntry {
+	GLenum source, type, severity;
+	GLuint id;
+	long long count;
+	int firstFrame;
+	std::string text;
+};
+
+typedef std::map<unsigned long long, LogEntry> DebugLog;
+static DebugLog debugLog;
+
+static void APIENTRY debugCallback(GLenum, GLenum, GLuint, GLenum, GLsizei, const GLchar*, const void*);
+// Queues one message, never blocks
+
+static const char *sourceName(GLenum);
+static const char *typeName(GLenum);
+static const char *severityName(GLenum);
+
+bool startGLDebugLog(bool synchronous) {
+
+	if (glDebugMessageCallback == NULL || !(GLAD_GL_VERSION_4_3 || GLAD_GL_KHR_debug))
+		return false;
+
+	for (unsigned int i = 0; i < RING_SIZE; i++)
+		ring[i].sequence.store(i, std::memory_order_relaxed);
+
+	ringHead.store(0);
+	ringTail = 0;
+	currentFrame.store(0);
+	dropped.store(0);
+	debugLog.clear();
+
+	glEnable(GL_DEBUG_OUTPUT);
+
+	if (synchronous)
+		glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+
+	// Everything, including the low severity performance hints
+	glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, GL_TRUE);
+	glDebugMessageCallback(debugCallback, NULL);
+
+	installed = true;
+
+	return true;
+
+}
+
+void flushGLDebugLog(int frame) {
+
+	if (!installed)
+		return;
+
+	for (;;) {
+
+		DebugMessage &slot = ring[ringTail % RING_SIZE];
+
+		// Not published yet, the ring is empty (for now)
+		if (slot.sequence.load(std::memory_order_acquire) != ringTail + 1)
+			break;
+
+		unsigned long long key = ((unsigned long long) slot.source << 48)
+			^ ((unsigned long long) slot.type << 32) ^ slot.id;
+
+		DebugLog::iterator it = debugLog.find(key);
+
+		if (it == debugLog.end()) {
+			LogEntry entry = { slot.source, slot.type, slot.severity, slot.id, 1, slot.frame, slot.text };
+			debugLog.insert(std::make_pair(key, entry));
+		}
+		else {
+			it->second.count++;
+		}
+
+		// Hand the slot to the next lap
+		slot.sequence.store(ringTail + RING_SIZE, std::memory_order_release);
+		ringTail++;
+
+	}
+
+	currentFrame.store(frame, std::memory_order_relaxed);
+
+}
+
+void stopGLDebugLog() {
+
+	if (!installed)
+		return;
+
+	glDebugMessageCallback(NULL, NULL);
+	glDisable(GL_DEBUG_OUTPUT);
+	installed = false;
+
+	flushGLDebugLog(currentFrame.load());
+
+	std::vector<const LogEntry*> entries;
+
+	for (DebugLog::const_iterator it = debugLog.begin(); it != debugLog.end(); ++it)
+		entries.push_back(&it->second);
+
+	// Performance first, those are what this is for, then the most frequent
+	std::sort(entries.begin(), entries.end(), [](const LogEntry *a, const LogEntry *b) {
+		bool aPerformance = a->type == GL_DEBUG_TYPE_PERFORMANCE;
+		bool bPerformance = b->type == GL_DEBUG_TYPE_PERFORMANCE;
+		if (aPerformance != bPerformance)
+			return aPerformance;
+		return a->count > b->count;
+	});
+
+	std::cout << "GL debug messages: " << entries.size() << " unique";
+
+	if (dropped.load() > 0)
+		std::cout << ", " << dropped.load() << " dropped because the ring was full";
+
+	std::cout << "\n";
+
+	for (size_t i = 0; i < entries.size(); i++) {
+
+		const LogEntry *entry = entries[i];
+
+		std::cout << "  [" << typeName(entry->type) << ", " << severityName(entry->severity)
+			<< ", " << sourceName(entry->source) << "] id " << entry->id
+			<< ", " << entry->count << "x, first in frame " << entry->firstFrame
+			<< ": " << entry->text << "\n";
+
+	}
+
+}
+
+static void APIENTRY debugCallback(GLenum source, GLenum type, GLuint id, GLenum severity,
+	GLsizei length, const GLchar *message, const void*) {
+
+	unsigned int position = ringHead.load(std::memory_order_relaxed);
+
+	// Claim a slot, or give up if the consumer hasn't freed it yet
+	for (;;) {
+
+		DebugMessage &slot = ring[position % RING_SIZE];
+		unsigned int sequence = slot.sequence.load(std::memory_order_acquire);
+
+		if (sequence == position) {
+			if (ringHead.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if ((int) (sequence - position) < 0) {
+			dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		else {
+			position = ringHead.load(std::memory_order_relaxed);
+		}
+
+	}
+
+	DebugMessage &slot = ring[position % RING_SIZE];
+	slot.source = source;
+	slot.type = type;
+	slot.id = id;
+	slot.severity = severity;
+	slot.frame = currentFrame.load(std::memory_order_relaxed);
+
+	size_t size = length >= 0 ? (size_t) length : strlen(message);
+
+	if (size >= (size_t) MAX_MESSAGE)
+		size = MAX_MESSAGE - 1;
+
+	memcpy(slot.text, message, size);
+	slot.text[size] = '\0';
+
+	slot.sequence.store(position + 1, std::memory_order_release);
+
+}
+
+static const char *sourceName(GLenum source) {
+
+	switch (source) {
+	case GL_DEBUG_SOURCE_API: return "api";
+	case GL_DEBUG_SOURCE_WINDOW_SYSTEM: return "window system";
+	case GL_DEBUG_SOURCE_SHADER_COMPILER: return "shader compiler";
+	case GL_DEBUG_SOURCE_THIRD_PARTY: return "third party";
+	case GL_DEBUG_SOURCE_APPLICATION: return "application";
+	}
+
+	return "other";
+
+}
+
+static const char *typeName(GLenum type) {
+
+	switch (type) {
+	case GL_DEBUG_TYPE_ERROR: return "error";
+	case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated";
+	case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "undefined behavior";
+	case GL_DEBUG_TYPE_PORTABILITY: return "portability";
+	case GL_DEBUG_TYPE_PERFORMANCE: return "performance";
+	case GL_DEBUG_TYPE_MARKER: return "marker";
+	case GL_DEBUG_TYPE_PUSH_GROUP: return "push group";
+	case GL_DEBUG_TYPE_POP_GROUP: return "pop group";
+	}
+
+	return "other";
+
+}
+
+static const char *severityName(GLenum severity) {
+
+	switch (severity) {
+	case GL_DEBUG_SEVERITY_HIGH: return "high";
+	case GL_DEBUG_SEVERITY_MEDIUM: return "medium";
+	case GL_DEBUG_SEVERITY_LOW: return "low";
+	}
+
+	return "notification";
+
+}
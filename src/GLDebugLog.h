@@ -0,0 +1,33 @@
+/*
+* Description: Collects what the driver reports through KHR_debug
+*		(performance warnings like buffers moving to system
+*		memory or shaders being recompiled, API errors, ...).
+*		The callback can run on any driver thread, so it only
+*		pushes the message into a lock-free ring buffer. Once
+*		per frame the ring is drained into a log that keeps one
+*		entry per message ID with how often it came and the
+*		frame it first showed up in, and the log is printed on
+*		exit.
+*
+*	Environment variables:
+*		APP_GL_DEBUG	1 to create a debug context and log its
+*				messages, sync to also make the driver
+*				report them synchronously, so they come
+*				from inside the call that caused them
+*/
+
+#ifndef GL_DEBUG_LOG_H
+#define GL_DEBUG_LOG_H
+
+bool startGLDebugLog(bool);
+// Installs the debug callback on the current context. Pass true for
+// synchronous output. Returns false if the context has no debug output
+
+void flushGLDebugLog(int);
+// Moves everything the callback queued into the log. The argument is
+// the frame that starts now, new messages get stamped with it
+
+void stopGLDebugLog();
+// Removes the callback and prints the log, performance messages first
+
+#endif
@@ -0,0 +1,148 @@
+/*
+* Description: Generic interception of glad entry points.
+*		Every entry point in glad_procs.h gets an opcode and
+*		a wrapper with the exact same signature. Installing a
+*		hook swaps the glad_gl* pointers over to the wrappers,
+*		which call Hook::before and Hook::after around the real
+*		function. The call tracer and the call statistics are
+*		both built on this.
+*
+*	A Hook is a struct with:
+*		struct Call;	// whatever before() wants to hand to after()
+*		template <typename... A> static Call before(int op, A... args);
+*		template <typename R, typename... A> static void after(Call&, int op, R *result, A... args);
+*	where result is NULL for functions returning void.
+*
+*	Lazily loaded entry points are resolved when they get wrapped,
+*	their trampolines would replace the wrapper on their first call.
+*	With GLAD_GL_MX the glad_gl* pointers are per thread, and so is
+*	what the wrappers call: hooks only see the threads that
+*	installed them.
+*/
+
+#ifndef GL_INTERCEPT_H
+#define GL_INTERCEPT_H
+
+#include <glad/glad.h>
+
+#ifdef GLAD_GL_MX
+#define GL_INTERCEPT_THREAD_LOCAL thread_local
+#else
+#define GL_INTERCEPT_THREAD_LOCAL
+#endif
+
+// One opcode per entry point, in glad_procs.h order
+enum GLOp {
+#define GLAD_PROC(ret, name, pfn, params, args, feature) GL_OP_##name,
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) GL_OP_##name,
+#include <glad/glad_procs.h>
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+	GL_OP_COUNT
+};
+
+inline const char *glOpName(int op) {
+
+	static const char *const NAMES[] = {
+#define GLAD_PROC(ret, name, pfn, params, args, feature) "gl" #name,
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) "gl" #name,
+#include <glad/glad_procs.h>
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+	};
+
+	return op >= 0 && op < GL_OP_COUNT ? NAMES[op] : "(unknown)";
+
+}
+
+template <typename Hook, int Op, typename PFN>
+struct GLIntercept;
+
+template <typename Hook, int Op, typename R, typename... A>
+struct GLIntercept<Hook, Op, R (APIENTRYP)(A...)> {
+
+	static GL_INTERCEPT_THREAD_LOCAL R (APIENTRYP real)(A...);
+
+	static R APIENTRY call(A... args) {
+		typename Hook::Call c = Hook::before(Op, args...);
+		R result = real(args...);
+		Hook::after(c, Op, &result, args...);
+		return result;
+	}
+
+};
+
+template <typename Hook, int Op, typename... A>
+struct GLIntercept<Hook, Op, void (APIENTRYP)(A...)> {
+
+	static GL_INTERCEPT_THREAD_LOCAL void (APIENTRYP real)(A...);
+
+	static void APIENTRY call(A... args) {
+		typename Hook::Call c = Hook::before(Op, args...);
+		real(args...);
+		Hook::after(c, Op, (void*) 0, args...);
+	}
+
+};
+
+template <typename Hook, int Op, typename R, typename... A>
+GL_INTERCEPT_THREAD_LOCAL R (APIENTRYP GLIntercept<Hook, Op, R (APIENTRYP)(A...)>::real)(A...) = 0;
+
+template <typename Hook, int Op, typename... A>
+GL_INTERCEPT_THREAD_LOCAL void (APIENTRYP GLIntercept<Hook, Op, void (APIENTRYP)(A...)>::real)(A...) = 0;
+
+template <typename Hook, int Op, typename PFN>
+void installGLIntercept() {
+// Swaps one glad_gl* pointer over to Hook's wrapper, for hooks that
+// only care about a few entry points. Does nothing if the entry point
+// didn't load or is wrapped by Hook already
+
+	void **slot = gladResolveProcSlot(Op);
+
+	if (slot != 0 && *slot != 0 && *slot != (void*) &GLIntercept<Hook, Op, PFN>::call) {
+		GLIntercept<Hook, Op, PFN>::real = (PFN) *slot;
+		*slot = (void*) &GLIntercept<Hook, Op, PFN>::call;
+	}
+
+}
+
+template <typename Hook, int Op, typename PFN>
+void removeGLIntercept() {
+// Puts the real entry point back, unless another hook wrapped it since.
+// Hook's wrapper then stays in that hook's chain
+
+	void **slot = gladGetProcSlot(Op);
+
+	if (slot != 0 && *slot == (void*) &GLIntercept<Hook, Op, PFN>::call)
+		*slot = (void*) GLIntercept<Hook, Op, PFN>::real;
+
+}
+
+template <typename Hook>
+void installGLIntercepts() {
+// Swaps every loaded glad_gl* pointer over to Hook's wrappers.
+// Entry points that didn't load stay NULL. The pointers are reached
+// through gladResolveProcSlot (opcodes follow the same order), so trimmed
+// builds only get wrappers for what they have
+
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) installGLIntercept<Hook, GL_OP_##name, pfn>();
+#define GLAD_PROC(ret, name, pfn, params, args, feature) GLAD_PROC_VOID(name, pfn, params, args, feature)
+#include <glad/glad_procs.h>
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+
+}
+
+template <typename Hook>
+void removeGLIntercepts() {
+// Puts the real entry points back
+
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) removeGLIntercept<Hook, GL_OP_##name, pfn>();
+#define GLAD_PROC(ret, name, pfn, params, args, feature) GLAD_PROC_VOID(name, pfn, params, args, feature)
+#include <glad/glad_procs.h>
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+
+}
+
+#endif
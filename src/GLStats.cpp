@@ -0,0 +1,223 @@
+#include "GLStats.h"
+
+#ifdef GLAD_GL_INSTRUMENT
+
+#include "GLIntercept.h"
+
+// Including core libraries
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <cstdlib>
+#include <chrono>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+#include <stdint.h>
+
+// How many rows stopGLStats prints
+const int REPORT_ROWS = 20;
+
+// One per thread making calls. Only that thread writes its counters and
+// they only ever go up, flushing takes the difference to what it saw the
+// last time, so the calls never wait on a flush
+struct ThreadCounters {
+	std::atomic<uint64_t> calls[GL_OP_COUNT];
+	std::atomic<uint64_t> time[GL_OP_COUNT];
+	uint64_t flushedCalls[GL_OP_COUNT];	// Under totalsLock
+	uint64_t flushedTime[GL_OP_COUNT];
+};
+
+// Registers the thread's counters on its first call, and folds whatever
+// they have left into the current frame when the thread ends
+struct ThreadSlot {
+	ThreadCounters *counters;
+	ThreadSlot();
+	~ThreadSlot();
+};
+
+static std::mutex totalsLock;
+
+// Every thread with counters, and this frame's calls collected so far
+static std::vector<ThreadCounters*> threads;
+static uint64_t frameCalls[GL_OP_COUNT];
+static uint64_t frameTime[GL_OP_COUNT];
+
+// Every flushed frame from every thread
+static uint64_t totalCalls[GL_OP_COUNT];
+static uint64_t totalTime[GL_OP_COUNT];
+static long long frames;
+static std::ofstream csv;
+
+static thread_local ThreadSlot slot;
+
+static void collect(ThreadCounters*);
+// Adds what the thread counted since the last collect to this frame.
+// Needs totalsLock
+
+static void add(std::atomic<uint64_t> &counter, uint64_t value) {
+	// Only the owning thread writes, so no read-modify-write is needed
+	counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+struct StatsHook {
+
+	typedef std::chrono::steady_clock::time_point Call;
+
+	template <typename... A>
+	static Call before(int, A...) {
+		return std::chrono::steady_clock::now();
+	}
+
+	template <typename R, typename... A>
+	static void after(Call &start, int op, R*, A...) {
+		ThreadCounters *counters = slot.counters;
+		add(counters->calls[op], 1);
+		add(counters->time[op], (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+	}
+
+};
+
+ThreadSlot::ThreadSlot() {
+
+	counters = new ThreadCounters();
+
+	std::lock_guard<std::mutex> guard(totalsLock);
+	threads.push_back(counters);
+
+}
+
+ThreadSlot::~ThreadSlot() {
+
+	std::lock_guard<std::mutex> guard(totalsLock);
+
+	collect(counters);
+	threads.erase(std::find(threads.begin(), threads.end(), counters));
+
+	delete counters;
+
+}
+
+void startGLStats() {
+
+	// Counting starts over, from wherever the threads are now
+	{
+		std::lock_guard<std::mutex> guard(totalsLock);
+
+		for (size_t i = 0; i < threads.size(); i++)
+			collect(threads[i]);
+
+		std::fill(frameCalls, frameCalls + GL_OP_COUNT, 0);
+		std::fill(frameTime, frameTime + GL_OP_COUNT, 0);
+	}
+
+	const char *path = getenv("APP_GL_STATS");
+
+	if (path != NULL && *path != '\0') {
+
+		csv.open(path);
+
+		if (csv)
+			csv << "frame,function,calls,nanoseconds\n";
+		else
+			std::cout << "Unable to create " << path << "!\n";
+
+	}
+
+	installGLIntercepts<StatsHook>();
+
+}
+
+void flushGLStats() {
+
+	std::lock_guard<std::mutex> guard(totalsLock);
+
+	for (size_t i = 0; i < threads.size(); i++)
+		collect(threads[i]);
+
+	for (int op = 0; op < GL_OP_COUNT; op++) {
+
+		if (frameCalls[op] == 0)
+			continue;
+
+		totalCalls[op] += frameCalls[op];
+		totalTime[op] += frameTime[op];
+
+		if (csv.is_open())
+			csv << frames << ',' << glOpName(op) << ',' << frameCalls[op] << ',' << frameTime[op] << '\n';
+
+		frameCalls[op] = 0;
+		frameTime[op] = 0;
+
+	}
+
+	frames++;
+
+}
+
+void stopGLStats() {
+
+	removeGLIntercepts<StatsHook>();
+
+	std::lock_guard<std::mutex> guard(totalsLock);
+
+	if (csv.is_open())
+		csv.close();
+
+	if (frames == 0)
+		return;
+
+	std::vector<int> ops;
+	uint64_t allTime = 0;
+
+	for (int op = 0; op < GL_OP_COUNT; op++) {
+		if (totalCalls[op] > 0) {
+			ops.push_back(op);
+			allTime += totalTime[op];
+		}
+	}
+
+	std::sort(ops.begin(), ops.end(), [](int a, int b) { return totalTime[a] > totalTime[b]; });
+
+	std::ios::fmtflags flags = std::cout.flags();
+	std::streamsize precision = std::cout.precision();
+
+	std::cout << "GL calls per frame over " << frames << " frames (timings include the timer itself):\n";
+	std::cout << std::left << std::setw(32) << "function" << std::right
+		<< std::setw(12) << "calls" << std::setw(12) << "us" << std::setw(9) << "share\n";
+
+	for (size_t i = 0; i < ops.size() && i < (size_t) REPORT_ROWS; i++) {
+
+		int op = ops[i];
+
+		std::cout << std::left << std::setw(32) << glOpName(op) << std::right << std::fixed
+			<< std::setw(12) << std::setprecision(1) << (double) totalCalls[op] / frames
+			<< std::setw(12) << std::setprecision(3) << totalTime[op] / 1000.0 / frames
+			<< std::setw(7) << std::setprecision(1) << (allTime > 0 ? 100.0 * totalTime[op] / allTime : 0.0) << " %\n";
+
+	}
+
+	std::cout.flags(flags);
+	std::cout.precision(precision);
+
+}
+
+static void collect(ThreadCounters *counters) {
+
+	for (int op = 0; op < GL_OP_COUNT; op++) {
+
+		uint64_t calls = counters->calls[op].load(std::memory_order_relaxed);
+		uint64_t time = counters->time[op].load(std::memory_order_relaxed);
+
+		frameCalls[op] += calls - counters->flushedCalls[op];
+		frameTime[op] += time - counters->flushedTime[op];
+
+		counters->flushedCalls[op] = calls;
+		counters->flushedTime[op] = time;
+
+	}
+
+}
+
+#endif
@@ -0,0 +1,41 @@
+/*
+* Description: Per entry point call counts and CPU time. Built only
+*		when GLAD_GL_INSTRUMENT is defined; the wrappers from
+*		GLIntercept.h then count and time every call into
+*		counters of the calling thread, and each swap folds every
+*		thread's counters into that frame's totals (a thread that
+*		ends hands its last counts to the frame it ends in). Without
+*		GLAD_GL_INSTRUMENT every function here is an empty inline
+*		and the glad_gl* pointers are never touched, so calls cost
+*		exactly what they did before.
+*
+*	Environment variables (instrumented builds only):
+*		APP_GL_STATS	also write every frame's counters to
+*				this .csv file (frame, function,
+*				calls, nanoseconds)
+*/
+
+#ifndef GL_STATS_H
+#define GL_STATS_H
+
+#ifdef GLAD_GL_INSTRUMENT
+
+void startGLStats();
+// Starts counting. GL has to be loaded already
+
+void flushGLStats();
+// Ends the frame, taking in the calls of every thread. Call once per swap
+
+void stopGLStats();
+// Stops counting and prints the per-frame table, the most
+// expensive entry points first
+
+#else
+
+inline void startGLStats() {}
+inline void flushGLStats() {}
+inline void stopGLStats() {}
+
+#endif
+
+#endif
@@ -0,0 +1,541 @@
+#include "GLTrace.h"
+#include "GLIntercept.h"
+
+// Including core libraries
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <mutex>
+#include <type_traits>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+// The file grows in steps of this size (and doubles when that isn't enough)
+const size_t TRACE_CHUNK = 64 * 1024 * 1024;
+
+// Payloads per record, more than any GL call needs
+const int MAX_PAYLOADS = 4;
+
+struct TraceFile {
+#ifdef _WIN32
+	HANDLE file, mapping;
+#else
+	int fd;
+#endif
+	unsigned char *base;
+	size_t capacity, used;
+	bool open;
+	std::chrono::steady_clock::time_point start;
+	std::mutex lock;	// Held while reserving or writing, growing the file remaps base
+};
+
+static TraceFile trace;
+
+// A piece of client memory a call reads from or writes to
+struct PayloadRef {
+	int arg;
+	bool output;
+	const void *data;
+	size_t size;
+};
+
+static bool mapTraceFile(size_t);
+// (Re)maps the trace file with the given capacity
+
+static size_t reserveTrace(size_t);
+// Makes room for the given number of bytes and returns their offset.
+// Called with trace.lock held, pointers into the file from before the
+// call can be stale after it
+
+static void closeTraceFile();
+// Unmaps the file and cuts it down to the bytes actually used
+
+static int findPayloads(int, const uint64_t*, PayloadRef*);
+// Fills in the client memory the given call reads from or writes to
+
+static size_t shaderSourceSize(int, const uint64_t*);
+static void writeShaderSource(unsigned char*, int, const uint64_t*);
+// glShaderSource and glCreateShaderProgramv get their strings stored as
+// (uint32 length, characters) pairs
+
+static size_t align8(size_t size) {
+	return (size + 7) & ~(size_t) 7;
+}
+
+static uint64_t traceTime() {
+	return (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - trace.start).count();
+}
+
+// Argument encoding, see GLTrace.h
+template <typename T>
+static typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, uint64_t>::type encodeArg(T value) {
+	return (uint64_t) (int64_t) value;
+}
+
+static uint64_t encodeArg(float value) {
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+static uint64_t encodeArg(double value) {
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+template <typename T>
+static uint64_t encodeArg(T *value) {
+	return (uint64_t) (uintptr_t) value;
+}
+
+struct TraceHook {
+
+	struct Call {
+		size_t offset;		// Where the record starts in the file
+		int payloadCount;
+		PayloadRef payloads[MAX_PAYLOADS];
+	};
+
+	template <typename... A>
+	static Call before(int op, A... args) {
+
+		uint64_t values[] = { encodeArg(args)..., 0 };
+		const int argCount = sizeof...(A);
+
+		Call call;
+		call.payloadCount = findPayloads(op, values, call.payloads);
+
+		size_t size = sizeof(TraceRecord) + argCount * sizeof(uint64_t);
+
+		for (int i = 0; i < call.payloadCount; i++)
+			size += sizeof(TracePayload) + align8(call.payloads[i].size);
+
+		int recordArgs = argCount;
+
+		// Record and payload sizes are 32 bit, a call that doesn't fit
+		// is only marked as dropped rather than written cut short
+		if (size > 0xFFFFFFFFu) {
+
+			std::cout << "A " << glOpName(op) << " call is too big to trace, it is left out!\n";
+
+			op = TRACE_OP_DROPPED;
+			recordArgs = 0;
+			call.payloadCount = 0;
+			size = sizeof(TraceRecord);
+
+		}
+
+		// Other contexts' threads trace too. Nothing keeps a pointer into
+		// the file once the lock is let go
+		std::lock_guard<std::mutex> guard(trace.lock);
+
+		call.offset = reserveTrace(size);
+
+		unsigned char *out = trace.base + call.offset;
+
+		TraceRecord *record = (TraceRecord*) out;
+		record->op = (uint16_t) op;
+		record->argCount = (uint8_t) recordArgs;
+		record->payloadCount = (uint8_t) call.payloadCount;
+		record->size = (uint32_t) size;
+		record->time = traceTime();
+		record->result = 0;
+		out += sizeof(TraceRecord);
+
+		memcpy(out, values, recordArgs * sizeof(uint64_t));
+		out += recordArgs * sizeof(uint64_t);
+
+		for (int i = 0; i < call.payloadCount; i++) {
+
+			TracePayload *payload = (TracePayload*) out;
+			payload->arg = (uint8_t) call.payloads[i].arg;
+			payload->output = call.payloads[i].output ? 1 : 0;
+			payload->reserved = 0;
+			payload->size = (uint32_t) call.payloads[i].size;
+			out += sizeof(TracePayload);
+
+			// Outputs get filled in once the call returns
+			if ((op == GL_OP_ShaderSource || op == GL_OP_CreateShaderProgramv) && !call.payloads[i].output)
+				writeShaderSource(out, op, values);
+			else if (!call.payloads[i].output)
+				memcpy(out, call.payloads[i].data, call.payloads[i].size);
+
+			out += align8(call.payloads[i].size);
+
+		}
+
+		return call;
+
+	}
+
+	template <typename R, typename... A>
+	static void after(Call &call, int, R *result, A...) {
+
+		std::lock_guard<std::mutex> guard(trace.lock);
+
+		// Stopped while another thread's call ran
+		if (!trace.open)
+			return;
+
+		TraceRecord *record = (TraceRecord*) (trace.base + call.offset);
+
+		storeResult(record, result);
+
+		unsigned char *out = trace.base + call.offset + sizeof(TraceRecord) + record->argCount * sizeof(uint64_t);
+
+		for (int i = 0; i < call.payloadCount; i++) {
+
+			out += sizeof(TracePayload);
+
+			if (call.payloads[i].output)
+				memcpy(out, call.payloads[i].data, call.payloads[i].size);
+
+			out += align8(call.payloads[i].size);
+
+		}
+
+	}
+
+	template <typename R>
+	static void storeResult(TraceRecord *record, R *result) {
+		record->result = encodeArg(*result);
+	}
+
+	static void storeResult(TraceRecord*, void*) {
+		// Void functions leave the result at 0
+	}
+
+};
+
+bool startTrace(const char *path) {
+
+	if (trace.open)
+		return false;
+
+#ifdef _WIN32
+	trace.file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+
+	if (trace.file == INVALID_HANDLE_VALUE) {
+#else
+	trace.fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+	if (trace.fd < 0) {
+#endif
+		std::cout << "Unable to create the trace file " << path << "!\n";
+		return false;
+	}
+
+	trace.base = NULL;
+	trace.used = 0;
+
+	if (!mapTraceFile(TRACE_CHUNK)) {
+		closeTraceFile();
+		return false;
+	}
+
+	trace.open = true;
+	trace.start = std::chrono::steady_clock::now();
+
+	std::lock_guard<std::mutex> guard(trace.lock);
+
+	// Header and the names of every entry point, so the replayer
+	// can match opcodes even if its glad has different entry points
+	size_t offset = reserveTrace(sizeof(TraceHeader));
+	TraceHeader *header = (TraceHeader*) (trace.base + offset);
+	header->magic = TRACE_MAGIC;
+	header->version = TRACE_VERSION;
+	header->opCount = GL_OP_COUNT;
+	header->reserved = 0;
+
+	for (int op = 0; op < GL_OP_COUNT; op++) {
+
+		const char *name = glOpName(op);
+		uint16_t length = (uint16_t) strlen(name);
+
+		offset = reserveTrace(sizeof(length) + length);
+		memcpy(trace.base + offset, &length, sizeof(length));
+		memcpy(trace.base + offset + sizeof(length), name, length);
+
+	}
+
+	reserveTrace(align8(trace.used) - trace.used);
+
+	installGLIntercepts<TraceHook>();
+
+	return true;
+
+}
+
+void traceFrame() {
+
+	if (!trace.open)
+		return;
+
+	std::lock_guard<std::mutex> guard(trace.lock);
+
+	TraceRecord *record = (TraceRecord*) (trace.base + reserveTrace(sizeof(TraceRecord)));
+	record->op = TRACE_OP_FRAME;
+	record->argCount = 0;
+	record->payloadCount = 0;
+	record->size = sizeof(TraceRecord);
+	record->time = traceTime();
+	record->result = 0;
+
+}
+
+void stopTrace() {
+
+	if (!trace.open)
+		return;
+
+	removeGLIntercepts<TraceHook>();
+
+	std::lock_guard<std::mutex> guard(trace.lock);
+	closeTraceFile();
+
+}
+
+bool isTracing() {
+
+	return trace.open;
+
+}
+
+static int findPayloads(int op, const uint64_t *args, PayloadRef *payloads) {
+
+	int count = 0;
+
+	// Input memory of the given argument
+	#define INPUT(index, bytes) \
+		if (args[index] != 0 && (bytes) > 0) { \
+			PayloadRef ref = { index, false, (const void*) (uintptr_t) args[index], (size_t) (bytes) }; \
+			payloads[count++] = ref; \
+		}
+
+	// Memory the call writes to, captured after it returns
+	#define OUTPUT(index, bytes) \
+		if (args[index] != 0 && (bytes) > 0) { \
+			PayloadRef ref = { index, true, (const void*) (uintptr_t) args[index], (size_t) (bytes) }; \
+			payloads[count++] = ref; \
+		}
+
+	switch (op) {
+
+	// Buffer contents
+	case GL_OP_BufferData: INPUT(2, args[1]); break;
+	case GL_OP_BufferSubData: INPUT(3, args[2]); break;
+	case GL_OP_BufferStorage: case GL_OP_NamedBufferStorage: INPUT(2, args[1]); break;
+	case GL_OP_NamedBufferData: INPUT(2, args[1]); break;
+	case GL_OP_NamedBufferSubData: INPUT(3, args[2]); break;
+
+	// Shader sources, stored in their own format
+	case GL_OP_ShaderSource: case GL_OP_CreateShaderProgramv: INPUT(2, shaderSourceSize(op, args)); break;
+	case GL_OP_ProgramBinary: INPUT(2, (int) args[3]); break;
+
+	// Uniform arrays
+	case GL_OP_Uniform1fv: case GL_OP_Uniform1iv: case GL_OP_Uniform1uiv: INPUT(2, (int) args[1] * 4); break;
+	case GL_OP_Uniform2fv: case GL_OP_Uniform2iv: case GL_OP_Uniform2uiv: INPUT(2, (int) args[1] * 8); break;
+	case GL_OP_Uniform3fv: case GL_OP_Uniform3iv: case GL_OP_Uniform3uiv: INPUT(2, (int) args[1] * 12); break;
+	case GL_OP_Uniform4fv: case GL_OP_Uniform4iv: case GL_OP_Uniform4uiv: INPUT(2, (int) args[1] * 16); break;
+	case GL_OP_UniformMatrix2fv: INPUT(3, (int) args[1] * 16); break;
+	case GL_OP_UniformMatrix3fv: INPUT(3, (int) args[1] * 36); break;
+	case GL_OP_UniformMatrix4fv: INPUT(3, (int) args[1] * 64); break;
+	case GL_OP_UniformMatrix2x3fv: case GL_OP_UniformMatrix3x2fv: INPUT(3, (int) args[1] * 24); break;
+	case GL_OP_UniformMatrix2x4fv: case GL_OP_UniformMatrix4x2fv: INPUT(3, (int) args[1] * 32); break;
+	case GL_OP_UniformMatrix3x4fv: case GL_OP_UniformMatrix4x3fv: INPUT(3, (int) args[1] * 48); break;
+
+	// Name arrays going in
+	case GL_OP_DeleteBuffers: case GL_OP_DeleteVertexArrays: case GL_OP_DeleteTextures:
+	case GL_OP_DeleteFramebuffers: case GL_OP_DeleteRenderbuffers: case GL_OP_DeleteQueries:
+	case GL_OP_DeleteSamplers: case GL_OP_DeleteProgramPipelines: case GL_OP_DrawBuffers:
+		INPUT(1, (int) args[0] * 4);
+		break;
+
+	// Names looked up by string
+	case GL_OP_GetUniformLocation: case GL_OP_GetAttribLocation:
+	case GL_OP_GetUniformBlockIndex: case GL_OP_GetFragDataLocation:
+		INPUT(1, strlen((const char*) (uintptr_t) args[1]) + 1);
+		break;
+
+	case GL_OP_BindAttribLocation: case GL_OP_BindFragDataLocation:
+		INPUT(2, strlen((const char*) (uintptr_t) args[2]) + 1);
+		break;
+
+	// SPIR-V modules and what to specialize them with
+	case GL_OP_ShaderBinary: INPUT(1, (int) args[0] * 4); INPUT(3, (int) args[4]); break;
+	case GL_OP_SpecializeShader: case GL_OP_SpecializeShaderARB:
+		INPUT(1, strlen((const char*) (uintptr_t) args[1]) + 1);
+		INPUT(3, (int) args[2] * 4);
+		INPUT(4, (int) args[2] * 4);
+		break;
+
+	// Uniform indices for program reflection
+	case GL_OP_GetActiveUniformsiv: INPUT(2, (int) args[1] * 4); break;
+
+	case GL_OP_ClearBufferfv: case GL_OP_ClearBufferiv: case GL_OP_ClearBufferuiv: INPUT(2, 16); break;
+
+	// Names coming out, kept so the replayer can spot mismatches
+	case GL_OP_GenBuffers: case GL_OP_GenVertexArrays: case GL_OP_GenTextures:
+	case GL_OP_GenFramebuffers: case GL_OP_GenRenderbuffers: case GL_OP_GenQueries:
+	case GL_OP_GenSamplers: case GL_OP_GenProgramPipelines:
+	case GL_OP_CreateBuffers: case GL_OP_CreateVertexArrays:
+		OUTPUT(1, (int) args[0] * 4);
+		break;
+
+	}
+
+	#undef INPUT
+	#undef OUTPUT
+
+	return count;
+
+}
+
+static size_t shaderSourceSize(int op, const uint64_t *args) {
+
+	// glCreateShaderProgramv has no lengths, its strings always end in 0
+	GLsizei count = (GLsizei) args[1];
+	const GLchar *const *strings = (const GLchar *const*) (uintptr_t) args[2];
+	const GLint *lengths = op == GL_OP_ShaderSource ? (const GLint*) (uintptr_t) args[3] : NULL;
+
+	size_t size = 0;
+
+	for (GLsizei i = 0; i < count; i++) {
+		size_t length = lengths != NULL && lengths[i] >= 0 ? (size_t) lengths[i] : strlen(strings[i]);
+		size += sizeof(uint32_t) + length;
+	}
+
+	return size;
+
+}
+
+static void writeShaderSource(unsigned char *out, int op, const uint64_t *args) {
+
+	GLsizei count = (GLsizei) args[1];
+	const GLchar *const *strings = (const GLchar *const*) (uintptr_t) args[2];
+	const GLint *lengths = op == GL_OP_ShaderSource ? (const GLint*) (uintptr_t) args[3] : NULL;
+
+	for (GLsizei i = 0; i < count; i++) {
+
+		uint32_t length = (uint32_t) (lengths != NULL && lengths[i] >= 0 ? (size_t) lengths[i] : strlen(strings[i]));
+
+		memcpy(out, &length, sizeof(length));
+		memcpy(out + sizeof(length), strings[i], length);
+		out += sizeof(length) + length;
+
+	}
+
+}
+
+static size_t reserveTrace(size_t bytes) {
+
+	if (trace.used + bytes > trace.capacity) {
+
+		size_t capacity = trace.capacity + TRACE_CHUNK;
+
+		while (capacity < trace.used + bytes)
+			capacity *= 2;
+
+		if (!mapTraceFile(capacity)) {
+			std::cout << "Unable to grow the trace file, stopping the trace!\n";
+			exit(-1);
+		}
+
+	}
+
+	size_t offset = trace.used;
+	trace.used += bytes;
+
+	return offset;
+
+}
+
+#ifdef _WIN32
+
+static bool mapTraceFile(size_t capacity) {
+
+	if (trace.base != NULL) {
+		UnmapViewOfFile(trace.base);
+		CloseHandle(trace.mapping);
+	}
+
+	trace.mapping = CreateFileMappingA(trace.file, NULL, PAGE_READWRITE,
+		(DWORD) ((uint64_t) capacity >> 32), (DWORD) capacity, NULL);
+
+	trace.base = trace.mapping != NULL
+		? (unsigned char*) MapViewOfFile(trace.mapping, FILE_MAP_WRITE, 0, 0, capacity)
+		: NULL;
+
+	trace.capacity = capacity;
+
+	return trace.base != NULL;
+
+}
+
+static void closeTraceFile() {
+
+	if (trace.base != NULL) {
+		UnmapViewOfFile(trace.base);
+		CloseHandle(trace.mapping);
+	}
+
+	LARGE_INTEGER size;
+	size.QuadPart = (LONGLONG) trace.used;
+	SetFilePointerEx(trace.file, size, NULL, FILE_BEGIN);
+	SetEndOfFile(trace.file);
+
+	CloseHandle(trace.file);
+
+	trace.base = NULL;
+	trace.open = false;
+
+}
+
+#else
+
+static bool mapTraceFile(size_t capacity) {
+
+	if (trace.base != NULL)
+		munmap(trace.base, trace.capacity);
+
+	trace.base = NULL;
+	trace.capacity = capacity;
+
+	if (ftruncate(trace.fd, (off_t) capacity) != 0)
+		return false;
+
+	void *base = mmap(NULL, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, trace.fd, 0);
+
+	if (base == MAP_FAILED)
+		return false;
+
+	trace.base = (unsigned char*) base;
+
+	return true;
+
+}
+
+static void closeTraceFile() {
+
+	if (trace.base != NULL)
+		munmap(trace.base, trace.capacity);
+
+	if (ftruncate(trace.fd, (off_t) trace.used) != 0)
+		std::cout << "Unable to trim the trace file!\n";
+
+	close(trace.fd);
+
+	trace.base = NULL;
+	trace.open = false;
+
+}
+
+#endif
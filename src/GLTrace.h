@@ -0,0 +1,73 @@
+/*
+* Description: Binary GL call tracing. While a trace is being
+*		recorded, every glad entry point is wrapped (see
+*		GLIntercept.h) and each call is appended to a memory
+*		mapped trace file as a compact record: opcode, arguments,
+*		return value, a timestamp, and the client memory the
+*		call read from (buffer data, shader sources, ...).
+*		TraceReplay.cpp plays a trace back as fast as it can.
+*
+*	File layout (all little endian):
+*		TraceHeader
+*		opCount names, each a uint16 length and the characters
+*		records, each a TraceRecord followed by argCount uint64
+*		arguments and payloadCount payloads, every part 8 byte aligned
+*
+*	Arguments are stored as 64 bit values: integers sign or zero
+*	extended, floats and doubles as their bits, pointers as
+*	addresses. Pointer arguments whose memory was captured have a
+*	payload, which the replayer passes instead of the address.
+*/
+
+#ifndef GL_TRACE_H
+#define GL_TRACE_H
+
+#include <cstddef>
+#include <stdint.h>
+
+const uint32_t TRACE_MAGIC = 0x52544C47;	// "GLTR"
+const uint32_t TRACE_VERSION = 1;
+
+// Opcode of the marker appSwapBuffers writes at the end of every frame
+const uint16_t TRACE_OP_FRAME = 0xFFFF;
+
+// Opcode left in place of a call too big for a record (more than 4 GB of
+// client memory), with no arguments or payloads. Replay skips it
+const uint16_t TRACE_OP_DROPPED = 0xFFFE;
+
+struct TraceHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t opCount;	// Entry point names follow the header
+	uint32_t reserved;
+};
+
+struct TraceRecord {
+	uint16_t op;
+	uint8_t argCount;
+	uint8_t payloadCount;
+	uint32_t size;		// Whole record, including arguments and payloads
+	uint64_t time;		// Nanoseconds since the trace started
+	uint64_t result;	// Return value, 0 for void functions
+};
+
+struct TracePayload {
+	uint8_t arg;		// Which argument this is the memory of
+	uint8_t output;		// 1 if the call wrote it (e.g. glGenBuffers names)
+	uint16_t reserved;
+	uint32_t size;		// Bytes of data following this struct
+};
+
+bool startTrace(const char*);
+// Starts recording every GL call into the given file. GL has to be
+// loaded already. Returns false if the file couldn't be created
+
+void traceFrame();
+// Marks the end of a frame, call once per swap
+
+void stopTrace();
+// Stops recording, restores the real entry points and closes the file
+
+bool isTracing();
+
+#endif
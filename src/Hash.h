@@ -0,0 +1,67 @@
+/*
+* Description: FNV-1a, the one hash the loader and the shader
+*		modules use: glad's extension registry, reflected and
+*		packed names (32 bit), shader registry and program cache
+*		keys (64 bit). Plain C, so glad.c can include it too.
+*		To hash several pieces as one, pass each result on as the
+*		hash the next piece starts from.
+*
+*		Typical use:
+*			uint64_t key = fnv1a64(FNV1A64_OFFSET, &type, sizeof(type));
+*			key = fnv1a64(key, source, strlen(source));
+*/
+
+#ifndef HASH_H
+#define HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define FNV1A32_OFFSET 2166136261u
+#define FNV1A32_PRIME 16777619u
+#define FNV1A64_OFFSET 14695981039346656037ULL
+#define FNV1A64_PRIME 1099511628211ULL
+
+#if defined(_MSC_VER) && !defined(__cplusplus)
+#define HASH_INLINE static __inline
+#else
+#define HASH_INLINE static inline
+#endif
+
+HASH_INLINE uint32_t fnv1a32(uint32_t hash, const void *data, size_t size) {
+
+	const unsigned char *bytes = (const unsigned char*) data;
+	size_t i;
+
+	for (i = 0; i < size; i++)
+		hash = (hash ^ bytes[i]) * FNV1A32_PRIME;
+
+	return hash;
+
+}
+
+HASH_INLINE uint64_t fnv1a64(uint64_t hash, const void *data, size_t size) {
+
+	const unsigned char *bytes = (const unsigned char*) data;
+	size_t i;
+
+	for (i = 0; i < size; i++)
+		hash = (hash ^ bytes[i]) * FNV1A64_PRIME;
+
+	return hash;
+
+}
+
+#ifdef __cplusplus
+
+// fnv1a32 of a NUL terminated name, one character per step so it stays a
+// C++11 constexpr (see NAME_HASH in ProgramReflection.h)
+constexpr uint32_t nameHash(const char *name, uint32_t hash = FNV1A32_OFFSET) {
+
+	return *name == '\0' ? hash : nameHash(name + 1, (hash ^ (uint32_t) (unsigned char) *name) * FNV1A32_PRIME);
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,214 @@
+/*
+* Description: Startup benchmark for the glad loader. Compares
+*		the normal (eager) gladLoadGLLoader with the lazy
+*		gladLoadGLLoaderLazy by measuring how long it takes
+*		from loading GL to the first frame being presented.
+*
+*	Every run creates a fresh hidden window, loads GL, builds
+*	a shader program and a VAO, then draws and swaps once.
+*	Runs alternate between the two modes so neither one gets
+*	all the warm caches.
+*/
+
+// Including core libraries
+#include <iostream>
+#include <cstdlib>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+// Including openGL dependencies
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// Only for millisecondsSince, the loader is timed without the rest
+#include "StartupTimeline.h"
+
+const int WIDTH = 800,
+	HEIGHT = 600;
+
+const char *WINDOW_NAME = "Loader Startup Benchmark";
+
+// How many times each loading mode is measured
+const int RUNS = 10;
+
+const char *vertexShader =
+	"#version 330 core\n"
+	"layout (location = 0) in vec3 aPos;\n"
+	"void main() {\n"
+	"	gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
+	"}";
+
+const char *fragmentShader =
+	"#version 330 core\n"
+	"out vec4 FragColor;\n"
+	"void main() {\n"
+	"	FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
+	"}";
+
+struct StartupTime {
+	double load;		// Time spent inside the glad loader (ms)
+	double firstFrame;	// Time from loading until the first swap (ms)
+};
+
+bool measureStartup(bool, StartupTime*);
+// Creates a window, loads GL either eagerly or lazily and renders
+// one frame. Returns false if anything failed
+
+void printResults(const char*, std::vector<StartupTime>&);
+// Prints the median and best times of one loading mode
+
+int main() {
+
+	if (glfwInit() == GLFW_FALSE) {
+		std::cout << "There was an error starting GLFW!\n";
+		return -1;
+	}
+
+	// Setting the OpenGL version to 3.3 (CORE)
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	// For compatibility with Macs
+	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+
+	// No need to show anything, we only care about the timing
+	glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+	std::vector<StartupTime> eager, lazy;
+
+	for (int run = 0; run < RUNS; run++) {
+
+		StartupTime time;
+
+		// Alternate which mode goes first on every run
+		for (int i = 0; i < 2; i++) {
+
+			bool useLazy = (run + i) % 2 == 1;
+
+			if (!measureStartup(useLazy, &time)) {
+				std::cout << "Unable to measure the startup time!\n";
+				glfwTerminate();
+				return -1;
+			}
+
+			if (useLazy)
+				lazy.push_back(time);
+			else
+				eager.push_back(time);
+
+		}
+
+	}
+
+	printResults("eager", eager);
+	printResults("lazy", lazy);
+
+	glfwTerminate();
+
+	return 0;
+
+}
+
+bool measureStartup(bool useLazy, StartupTime *time) {
+
+	GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, WINDOW_NAME, NULL, NULL);
+
+	if (window == NULL) {
+		std::cout << "Unable to create GLFW context!\n";
+		return false;
+	}
+
+	glfwMakeContextCurrent(window);
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	int loaded = useLazy
+		? gladLoadGLLoaderLazy((GLADloadproc)glfwGetProcAddress)
+		: gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+
+	time->load = millisecondsSince(start);
+
+	if (!loaded) {
+		std::cout << "Unable to intialize GLAD with proc address!\n";
+		glfwDestroyWindow(window);
+		return false;
+	}
+
+	// Same work as the first frame of the other demos
+	unsigned int vShaderID = glCreateShader(GL_VERTEX_SHADER);
+	unsigned int fShaderID = glCreateShader(GL_FRAGMENT_SHADER);
+
+	glShaderSource(vShaderID, 1, &vertexShader, NULL);
+	glShaderSource(fShaderID, 1, &fragmentShader, NULL);
+
+	glCompileShader(vShaderID);
+	glCompileShader(fShaderID);
+
+	unsigned int progID = glCreateProgram();
+	glAttachShader(progID, vShaderID);
+	glAttachShader(progID, fShaderID);
+	glLinkProgram(progID);
+
+	glDeleteShader(vShaderID);
+	glDeleteShader(fShaderID);
+
+	float vertices[] = {
+		-0.5f, -0.5f, 0.0f,
+		0.5f, -0.5f, 0.0f,
+		0.0f,  0.5f, 0.0f
+	};
+
+	unsigned int VAO, VBO;
+	glGenVertexArrays(1, &VAO);
+	glGenBuffers(1, &VBO);
+
+	glBindVertexArray(VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+
+	glViewport(0, 0, WIDTH, HEIGHT);
+	glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+	glClear(GL_COLOR_BUFFER_BIT);
+
+	glUseProgram(progID);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+
+	glfwSwapBuffers(window);
+
+	// Make sure the driver actually finished the frame
+	glFinish();
+
+	time->firstFrame = millisecondsSince(start);
+
+	glDeleteVertexArrays(1, &VAO);
+	glDeleteBuffers(1, &VBO);
+	glDeleteProgram(progID);
+
+	glfwMakeContextCurrent(NULL);
+	glfwDestroyWindow(window);
+
+	return true;
+
+}
+
+void printResults(const char *mode, std::vector<StartupTime> &times) {
+
+	std::vector<double> load, firstFrame;
+
+	for (size_t i = 0; i < times.size(); i++) {
+		load.push_back(times[i].load);
+		firstFrame.push_back(times[i].firstFrame);
+	}
+
+	std::sort(load.begin(), load.end());
+	std::sort(firstFrame.begin(), firstFrame.end());
+
+	std::cout << mode << ":\n"
+		<< "  load         median " << load[load.size() / 2] << " ms, best " << load[0] << " ms\n"
+		<< "  first frame  median " << firstFrame[firstFrame.size() / 2] << " ms, best " << firstFrame[0] << " ms\n";
+
+}
@@ -7,6 +7,16 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+// Shared window/context setup
+#include "AppContext.h"
+#include "StartupTimeline.h"
+#include "ShaderPermutations.h"
+#include "ShaderQueue.h"
+#include "SpirvShader.h"
+#include "BasicShader.h"
+#include "ShaderTelemetry.h"
+#include "ShaderPrewarm.h"
+
 const int HEIGHT = 600,
 	WIDTH = 800;
 
@@ -17,18 +27,21 @@ void framebuffer_size_callback(GLFWwindow*, int, int);
 // Callback function designed to be called everytime the window is resized
 // for adjusting the viewport
 
-void handleInput(GLFWwindow*);
+void handleInput(AppContext*);
 // Simple function for handling user input. Will be called in our main loop
 
-void renderItems(GLFWwindow*);
+void renderItems();
 // Clears the screen with a certain color and draws everything needed
 
-void drawTriangle(GLFWwindow*, unsigned int&, unsigned int&);
+void drawTriangle(unsigned int&, unsigned int&);
 // Used to draw a basic triangle on the screen!
 
-unsigned int generateShaders();
-// Compiles and generates a shader program to be used in rendering
-// basic objects
+bool generateShaders(bool, int*, int*);
+// Starts building the shader program used in rendering basic objects in
+// the background and gives back its permutation handle. Queues the SPIR-V
+// version instead if asked to and it's there, giving back its queue
+// handle and leaving the permutation handle at -1. Returns false if the
+// shader pack doesn't have the sources
 
 unsigned int generateTriangleVAO();
 // Generates a Vertex Array Object for the triangle we want to draw!
@@ -36,84 +49,80 @@ unsigned int generateTriangleVAO();
 
 int main() {
 
-	// Basic startup of glfw
-
-	glfwInit();
-	
-	// Setting the version of OpenGL to 3.3
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-
-	// Set to use core profile (just basic opengl features)
-	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-
-	// Needed to work on a Maciontosh
-	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+	// Create the window (or a headless context) and load GLAD,
+	// see AppContext.cpp for the glfw startup details
+	AppContext app;
 
-	// Attempt to create the window object
-	GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, WINDOW_NAME, NULL, NULL);
-
-	// Make sure the window was created
-	if (window == NULL) {
-
-		// Window didn't open :(
-		std::cout << "Unable to create GLFW context!\n";
-
-		// Stop glfw (is it even working at this point anyways?!)
-		glfwTerminate();
+	if (!createAppContext(&app, WIDTH, HEIGHT, WINDOW_NAME)) {
 
 		// Return with error code
 		return -1;
 
 	}
-	
-	// If it gets to this point, then we can set the created context as our context
-	glfwMakeContextCurrent(window);
-
-	// Setting up glad to help us with OS specific objects
-	if (!gladLoadGLLoader((GLADloadproc) glfwGetProcAddress)) {
-
-		// GLAD was unable to settup, so abort
-		std::cout << "Unable to initialize GLAD!\n";
-		glfwTerminate();
-		return -1;
-
-	}
 
 	// Set the viewport to the window size
 	glViewport(0, 0, WIDTH, HEIGHT);
 
 	// Register the frame buffer resize callback function
-	glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+	appSetResizeCallback(&app, framebuffer_size_callback);
+
+	// Everything it builds is the basic shader (see ShaderTelemetry.h)
+	setShaderFamily("Basic");
 
-	// Generate our shader program ID
-	unsigned int shaderProg = generateShaders();
+	// Get our shader going, nothing waits for it to compile yet
+	beginStartupPhase("generateShaders");
+	int basicShader = -1, spirvShader = -1;
+	bool generated = generateShaders(app.caps.spirv, &basicShader, &spirvShader);
+	endStartupPhase();
+
+	// The reason was printed already, nothing left to draw with
+	if (!generated) {
+		destroyAppContext(&app);
+		return -1;
+	}
 
 	// Generate an ID for our VAO
+	beginStartupPhase("generateTriangleVAO");
 	unsigned int VAO_ID = generateTriangleVAO();
+	endStartupPhase();
 
 	// Create a basic rendering loop
-	while (!glfwWindowShouldClose(window)) {
+	while (!appShouldClose(&app)) {
 
 		// Handle user input
-		handleInput(window);
+		handleInput(&app);
+
+		// See if the shader finished building, never waits
+		pollShaderQueue();
+
+		// A module the driver turned down, the GLSL version takes over
+		if (basicShader < 0 && programState(spirvShader) == PROGRAM_FAILED
+			&& !generateShaders(false, &basicShader, &spirvShader)) {
+			destroyAppContext(&app);
+			return -1;
+		}
 
 		// Render
-		renderItems(window);
+		renderItems();
+
+		// Draw the triangle! With the fallback program until ours is ready
+		unsigned int program = basicShader >= 0 ? drawPermutation(basicShader, 0) : programOrFallback(spirvShader);
+
+		// Drawn once where nobody sees it first, the frame it's ready, so
+		// the driver finishes it there and not on screen (see ShaderPrewarm.h)
+		WarmDraw warm = { program, 0, VAO_ID, GL_TRIANGLES, 0, GL_FILL };
+		warmBeforeDraw(&app, warm);
 
-		// Draw the triangle!
-		drawTriangle(window, shaderProg, VAO_ID);
+		drawTriangle(program, VAO_ID);
 
 		// Perform the double buffer goodness and display whatever is on the back buffer
-		glfwSwapBuffers(window);
-		
-		// Basically the tick function for glfw
-		glfwPollEvents();
+		// (also polls events, basically the tick function for glfw)
+		appSwapBuffers(&app);
 
 	}
 
 	// Make sure things are cleaned nicely!
-	glfwTerminate();
+	destroyAppContext(&app);
 
 	return 0;
 }
@@ -126,20 +135,20 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
 }
 
 // Handles basic user input
-void handleInput(GLFWwindow *window) {
+void handleInput(AppContext *app) {
 
 	// Some simple checks to see if the user pressed escape
-	if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
+	if (appKeyPressed(app, GLFW_KEY_ESCAPE)) {
 
 		// If escape is detected as pressed, then close the window gracefully
-		glfwSetWindowShouldClose(window, true);
+		appSetShouldClose(app);
 
 	}
 
 }
 
 // Handles basic window rendering
-void renderItems(GLFWwindow *window) {
+void renderItems() {
 
 	// Set the clear color, then clear the screen
 	glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
@@ -148,7 +157,7 @@ void renderItems(GLFWwindow *window) {
 }
 
 // Draws a nice triangle!
-void drawTriangle(GLFWwindow *window, unsigned int &shaderID, unsigned int &VAO) {
+void drawTriangle(unsigned int &shaderID, unsigned int &VAO) {
 	
 	// Tell it to use our Shader program
 	glUseProgram(shaderID);
@@ -162,109 +171,59 @@ void drawTriangle(GLFWwindow *window, unsigned int &shaderID, unsigned int &VAO)
 }
 
 // Generates our basic shader program
-unsigned int generateShaders() {
-
-	// OpenGL has to compile our shaders, so we need to give it
-	// something to compile! Below here will be our
-	// Vertex and Fragment shader
-
-	const char *vShader =
-		"#version 330 core\n"
-		"layout (location = 0) in vec3 aPos;\n"
-		"void main() {\n"
-		"gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
-		"}";
-
-	const char *fShader =
-		"#version 330 core\n"
-		"out vec4 FragColor;\n"
-		"void main() {\n"
-		"FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
-		"}";
-
-	// Hold the IDs of our shaders for later use
-	unsigned int vShaderID, fShaderID;
-	
-	// Get the shaders ready for compilation
-	vShaderID = glCreateShader(GL_VERTEX_SHADER);
-	fShaderID = glCreateShader(GL_FRAGMENT_SHADER);
-
-	// Create a cstring to hold any log messages
-	const int logSize = 512;
-	char log[logSize];
-	int success;
-	bool error = false;
-
-	// Attatch the source code to the shader
-	// First argument is the shader we want to bind the source to
-	// Second argument is how many strings are being passed
-	// Third argument is the source code
-	// Fourth is an int that tells us if the shader compiled successfully
-	glShaderSource(vShaderID, 1, &vShader, NULL);
-	glCompileShader(vShaderID);
-
-	glShaderSource(fShaderID, 1, &fShader, NULL);
-	glCompileShader(vShaderID);
-
-	// Check to see if there were any compilation errors on the vertex shader
-	glGetShaderiv(vShaderID, GL_COMPILE_STATUS, &success);
-
-	if (!success) {
-		// If there was an error, generate and print out the log
-		glGetShaderInfoLog(vShaderID, logSize, NULL, log);
-
-		std::cout << "There was an error while compiling the Vertex Shader:\n"
-			<< log;
+bool generateShaders(bool spirv, int *basicShader, int *spirvShader) {
+
+	// The colors the shader draws with, copied straight from the struct
+	// its uniform block was declared from. Every block reads binding 0.
+	// Only once, the GLSL version comes second when the SPIR-V one failed
+	static unsigned int colors;
+
+	if (colors == 0) {
+		glGenBuffers(1, &colors);
+		glBindBuffer(GL_UNIFORM_BUFFER, colors);
+		glBufferData(GL_UNIFORM_BUFFER, sizeof(BASIC_COLORS), &BASIC_COLORS, GL_STATIC_DRAW);
+		glBindBufferBase(GL_UNIFORM_BUFFER, 0, colors);
+	}
 
-		// An error occurred obviously.. :(
-		error = true;
+	// Drivers that take SPIR-V get the same shader compiled ahead of
+	// time, they only have to specialize and link it (see SpirvShader.h),
+	// on the shader queue like the GLSL version
+	if (spirv) {
 
-	}
-	else {
-		std::cout << "The Vertex Shader compiled successfully!\n";
-	}
+		std::string directory = shaderDirectory();
+		std::string vertexModule = directory + "/Basic.vert.spv";
+		std::string fragmentModule = directory + "/Basic.frag.spv";
 
-	// Next check for any errors on the Fragment Shader
-	glGetShaderiv(fShaderID, GL_COMPILE_STATUS, &success);
+		ShaderFile files[] = { { GL_VERTEX_SHADER, vertexModule.c_str() }, { GL_FRAGMENT_SHADER, fragmentModule.c_str() } };
 
-	if (!success) {
-		// If there was an error here, print out the log
-		glGetShaderInfoLog(fShaderID, logSize, NULL, log);
+		*spirvShader = queueSpirvProgram(files, 2);
 
-		std::cout << "There was an error while compiling the Fragment Shader:\n"
-			<< log;
+		if (*spirvShader >= 0)
+			return true;
 
 	}
-	else {
-		std::cout << "The Fragment shader compiled successfully!\n";
-	}
-
-	// If there was an error, close the program out
-	if (error) {
-		glfwTerminate();
 
-		// Hold the terminal open, so we can see it
-		char dud;
-		std::cin >> dud;
+	// OpenGL has to compile our shaders, so we need to give it
+	// something to compile! The Vertex and Fragment shader are the
+	// basic ones every demo shares (see BasicShader.h), straight out
+	// of the shader pack
+	const char *vertexShader = basicVertexShader(), *fragmentShader = basicFragmentShader();
 
-		exit(-1);
-	}
+	// If there was an error, the message is out already
+	if (vertexShader == NULL || fragmentShader == NULL)
+		return false;
 
-	// Begin creating the Shader Program using the pass-by-reference argument
-	unsigned int progID = glCreateProgram();
+	ShaderStage stages[] = { { GL_VERTEX_SHADER, vertexShader }, { GL_FRAGMENT_SHADER, fragmentShader } };
 
-	// Tell the linker what shaders we want to attatch to our shader program
-	glAttachShader(progID, vShaderID);
-	glAttachShader(progID, fShaderID);
+	int shader = createPermutations(stages, 2, BASIC_FEATURES, BASIC_FEATURE_COUNT);
 
-	// Complete the linking process
-	glLinkProgram(progID);
+	// We only ever draw the plain one, so it's the only one that gets
+	// compiled (or loaded from the program cache), on the shader queue
+	queuePermutation(shader, 0);
 
-	// Cleanup the shader's unique objects since they are now in the program
-	glDeleteShader(vShaderID);
-	glDeleteShader(fShaderID);
+	*basicShader = shader;
 
-	return progID;
+	return true;
 
 }
 
@@ -0,0 +1,322 @@
+/*
+* Description: Benchmark for folding constant-only shader variants
+*		(see MaterialSystem.h). A scene of 10000 quads, each
+*		with its own material made from one of a few shader
+*		templates with colors picked from a small palette, the
+*		way materials in a real scene only differ in their
+*		numbers. Drawn once with a program per distinct source
+*		and a draw per quad in scene order, and once with the
+*		variants folded, one instanced draw per program.
+*
+*	Prints the programs built, the program switches and draws
+*	per frame and the median frame times of both.
+*/
+
+// Including core libraries
+#include <iostream>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+#include <chrono>
+#include <algorithm>
+
+// Including openGL dependencies
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// Shared window/context setup
+#include "AppContext.h"
+#include "MaterialSystem.h"
+#include "StartupTimeline.h"
+
+const int WIDTH = 800,
+	HEIGHT = 600;
+
+const char *WINDOW_NAME = "Material Benchmark";
+
+// A GRID x GRID scene, one material per quad
+const int GRID = 100;
+
+// Frames measured for each way of drawing
+const int FRAMES = 20;
+
+const int TEMPLATES = 4;
+
+// Every color channel is one of these
+const float PALETTE[] = { 0.2f, 0.4f, 0.6f, 0.8f };
+const int PALETTE_SIZE = 4;
+
+const char *vertexShader =
+	"#version 330 core\n"
+	"layout (location = 0) in vec2 aPos;\n"
+	"layout (location = 1) in vec2 aOffset;\n"
+	"void main() {\n"
+	"	gl_Position = vec4(aPos + aOffset, 0.0, 1.0);\n"
+	"}";
+
+// %f gets the three color channels
+const char *fragmentTemplates[TEMPLATES] = {
+	"#version 330 core\n"
+	"out vec4 FragColor;\n"
+	"void main() {\n"
+	"	FragColor = vec4(%f, %f, %f, 1.0);\n"
+	"}",
+
+	"#version 330 core\n"
+	"out vec4 FragColor;\n"
+	"void main() {\n"
+	"	FragColor = vec4(vec3(%f, %f, %f) * (0.5 + 0.5 * gl_FragCoord.y / 600.0), 1.0);\n"
+	"}",
+
+	"#version 330 core\n"
+	"out vec4 FragColor;\n"
+	"void main() {\n"
+	"	FragColor = vec4(mix(vec3(%f, %f, %f), vec3(1.0), 0.25), 1.0);\n"
+	"}",
+
+	"#version 330 core\n"
+	"out vec4 FragColor;\n"
+	"void main() {\n"
+	"	vec3 color = vec3(%f, %f, %f);\n"
+	"	FragColor = vec4(color * color, 1.0);\n"
+	"}"
+};
+
+struct SceneResult {
+	int programs;		// Distinct programs the materials ended up with
+	double buildMs;		// Building all of them
+	int switches;		// Program switches per frame
+	int draws;		// Draw calls per frame
+	double submit;		// Median time issuing a frame (ms)
+	double frame;		// Median time including waiting for it (ms)
+};
+
+bool runScene(bool, unsigned int, SceneResult*);
+// Registers the scene's materials, builds them folded or not and draws
+// FRAMES frames. Returns false if a material didn't build
+
+void printResult(const char*, const SceneResult&);
+
+int main() {
+
+	AppContext app;
+
+	if (!createAppContext(&app, WIDTH, HEIGHT, WINDOW_NAME))
+		return -1;
+
+	// One quad, moved to its place in the grid by aOffset
+	float size = 1.8f / GRID;
+	float quad[] = {
+		0.0f, 0.0f, size, 0.0f, size, size,
+		0.0f, 0.0f, size, size, 0.0f, size
+	};
+
+	unsigned int quadVBO;
+	glGenBuffers(1, &quadVBO);
+	glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+
+	glViewport(0, 0, WIDTH, HEIGHT);
+
+	SceneResult separate, folded;
+
+	if (!runScene(false, quadVBO, &separate) || !runScene(true, quadVBO, &folded)) {
+		std::cout << "There was an error building the materials!\n";
+		glDeleteBuffers(1, &quadVBO);
+		destroyAppContext(&app);
+		return -1;
+	}
+
+	std::cout << GRID * GRID << " materials from " << TEMPLATES << " templates\n";
+
+	printResult("separate", separate);
+	printResult("folded", folded);
+
+	glDeleteBuffers(1, &quadVBO);
+
+	destroyAppContext(&app);
+
+	return 0;
+
+}
+
+bool runScene(bool fold, unsigned int quadVBO, SceneResult *result) {
+
+	// Same scene both times
+	unsigned int seed = 12345;
+	std::vector<std::string> sources;
+
+	for (int i = 0; i < GRID * GRID; i++) {
+
+		float channels[3];
+
+		for (int c = 0; c < 3; c++) {
+			seed = seed * 1103515245u + 12345u;
+			channels[c] = PALETTE[(seed >> 16) % PALETTE_SIZE];
+		}
+
+		seed = seed * 1103515245u + 12345u;
+
+		char source[512];
+		snprintf(source, sizeof(source), fragmentTemplates[(seed >> 16) % TEMPLATES], channels[0], channels[1], channels[2]);
+		sources.push_back(source);
+
+	}
+
+	std::vector<int> materials;
+
+	for (int i = 0; i < GRID * GRID; i++) {
+		ShaderStage stages[] = { { GL_VERTEX_SHADER, vertexShader }, { GL_FRAGMENT_SHADER, sources[i].c_str() } };
+		materials.push_back(addMaterial(stages, 2));
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	bool built = buildMaterials(fold);
+	result->buildMs = millisecondsSince(start);
+
+	if (!built) {
+		stopMaterials();
+		return false;
+	}
+
+	// Quads sharing a program go in one instanced draw when folded, each
+	// bucket starting with a material to bind for it
+	std::map<unsigned int, std::vector<int> > buckets;
+
+	for (int i = 0; i < GRID * GRID; i++)
+		buckets[materialProgram(materials[i])].push_back(i);
+
+	result->programs = (int) buckets.size();
+
+	unsigned int quadVAO;
+	glGenVertexArrays(1, &quadVAO);
+	glBindVertexArray(quadVAO);
+	glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*) 0);
+	glEnableVertexAttribArray(0);
+
+	std::vector<unsigned int> bucketVAOs, bucketVBOs;
+	std::vector<int> bucketFirst, bucketSize;
+
+	for (std::map<unsigned int, std::vector<int> >::iterator it = buckets.begin(); fold && it != buckets.end(); ++it) {
+
+		// Per instance: offset (2 floats), then the material index
+		std::vector<float> offsets;
+		std::vector<int> indices;
+
+		for (size_t q = 0; q < it->second.size(); q++) {
+			int i = it->second[q];
+			offsets.push_back(-0.9f + 1.8f * (i % GRID) / GRID);
+			offsets.push_back(-0.9f + 1.8f * (i / GRID) / GRID);
+			indices.push_back(materialIndex(materials[i]));
+		}
+
+		unsigned int VAO, VBOs[2];
+		glGenVertexArrays(1, &VAO);
+		glGenBuffers(2, VBOs);
+
+		glBindVertexArray(VAO);
+
+		glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*) 0);
+		glEnableVertexAttribArray(0);
+
+		glBindBuffer(GL_ARRAY_BUFFER, VBOs[0]);
+		glBufferData(GL_ARRAY_BUFFER, offsets.size() * sizeof(float), &offsets[0], GL_STATIC_DRAW);
+		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*) 0);
+		glVertexAttribDivisor(1, 1);
+		glEnableVertexAttribArray(1);
+
+		glBindBuffer(GL_ARRAY_BUFFER, VBOs[1]);
+		glBufferData(GL_ARRAY_BUFFER, indices.size() * sizeof(int), &indices[0], GL_STATIC_DRAW);
+		glVertexAttribIPointer(MATERIAL_ATTRIBUTE, 1, GL_INT, sizeof(int), (void*) 0);
+		glVertexAttribDivisor(MATERIAL_ATTRIBUTE, 1);
+		glEnableVertexAttribArray(MATERIAL_ATTRIBUTE);
+
+		bucketVAOs.push_back(VAO);
+		bucketVBOs.push_back(VBOs[0]);
+		bucketVBOs.push_back(VBOs[1]);
+		bucketFirst.push_back(it->second[0]);
+		bucketSize.push_back((int) it->second.size());
+
+	}
+
+	glBindVertexArray(0);
+
+	std::vector<double> submit, frame;
+	materialSwitches();
+
+	for (int f = 0; f < FRAMES; f++) {
+
+		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		start = std::chrono::steady_clock::now();
+		int draws = 0;
+
+		if (fold) {
+
+			for (size_t b = 0; b < bucketVAOs.size(); b++) {
+				useMaterial(materials[bucketFirst[b]]);
+				glBindVertexArray(bucketVAOs[b]);
+				glDrawArraysInstanced(GL_TRIANGLES, 0, 6, bucketSize[b]);
+				draws++;
+			}
+
+		}
+		else {
+
+			// Scene order, a quad's neighbour rarely has its program
+			glBindVertexArray(quadVAO);
+
+			for (int i = 0; i < GRID * GRID; i++) {
+				useMaterial(materials[i]);
+				glVertexAttrib2f(1, -0.9f + 1.8f * (i % GRID) / GRID, -0.9f + 1.8f * (i / GRID) / GRID);
+				glDrawArrays(GL_TRIANGLES, 0, 6);
+				draws++;
+			}
+
+		}
+
+		glBindVertexArray(0);
+		submit.push_back(millisecondsSince(start));
+
+		glFinish();
+		frame.push_back(millisecondsSince(start));
+
+		result->switches = materialSwitches();
+		result->draws = draws;
+
+	}
+
+	std::sort(submit.begin(), submit.end());
+	std::sort(frame.begin(), frame.end());
+
+	result->submit = submit[submit.size() / 2];
+	result->frame = frame[frame.size() / 2];
+
+	glUseProgram(0);
+
+	glDeleteVertexArrays(1, &quadVAO);
+
+	if (!bucketVAOs.empty()) {
+		glDeleteVertexArrays((int) bucketVAOs.size(), &bucketVAOs[0]);
+		glDeleteBuffers((int) bucketVBOs.size(), &bucketVBOs[0]);
+	}
+
+	stopMaterials();
+
+	return true;
+
+}
+
+void printResult(const char *mode, const SceneResult &result) {
+
+	std::cout << mode << ":\n"
+		<< "  programs  " << result.programs << ", built in " << result.buildMs << " ms\n"
+		<< "  per frame " << result.switches << " program switches, " << result.draws << " draws\n"
+		<< "  frame     submit median " << result.submit << " ms, with the GPU " << result.frame << " ms\n";
+
+}
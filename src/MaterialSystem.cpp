@@ -0,0 +1,802 @@
+#include "MaterialSystem.h"
+#include "ShaderRegistry.h"
+#include "ProgramReflection.h"
+#include "ShaderTelemetry.h"
+#include "ShaderQueue.h"
+#include "ShaderPermutations.h"
+
+// Including core libraries
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cctype>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <map>
+#include <regex>
+
+#include <glad/glad.h>
+
+struct SourceLiteral {
+	size_t start, length;		// Where it is in the source
+	float value;
+};
+
+struct MaterialStage {
+	unsigned int type;
+	std::string source;
+	std::vector<SourceLiteral> literals;	// Float literals only, in order
+	std::string pattern;			// The source with every literal replaced by \1
+						// and the comments taken out
+};
+
+struct Material {
+	std::vector<MaterialStage> stages;
+	unsigned int program;		// 0 until it's built
+	int queued;			// Shader queue handle while it builds there, -1 otherwise
+	unsigned int texture;		// Parameters of its group, 0 if it has none
+	int index;			// Row in that texture
+	const char *family;		// Shader family it was added under (ShaderTelemetry.h)
+};
+
+struct MaterialGroup {
+	std::vector<int> members;
+	std::vector<std::vector<bool> > varies;	// Per stage, per literal
+	int stride;				// Parameters per material
+};
+
+struct QueuedBuild {
+	int build;		// Shader queue handle
+	bool folded;		// The group's folded program, or one of its separate ones
+	MaterialGroup group;
+};
+
+static std::vector<Material> materials;
+
+// Programs queueMaterials started that pollMaterials hasn't collected yet
+static std::vector<QueuedBuild> queuedBuilds;
+
+// Everything built, for cleaning up
+static std::vector<unsigned int> programs, buffers, textures;
+
+// Stages used while building, so programs sharing one compile it once
+static std::vector<unsigned int> heldShaders;
+
+static unsigned int currentProgram, currentTexture;
+static int switches;
+
+static void findLiterals(MaterialStage*);
+// Fills in the float literals and the pattern of the stage's source
+
+static void groupMaterials(std::map<std::string, MaterialGroup>*);
+// Groups the materials that have no program and aren't queued by their
+// sources without the literals, and works out which literals vary
+
+static bool foldedSources(const MaterialGroup&, std::vector<std::string>*, std::vector<ShaderStage>*);
+// The stages of the group's one program. Returns false if the group
+// can't be folded
+
+static bool foldGroup(MaterialGroup&);
+// Builds the group's one program and its parameter texture. Returns false
+// if the group can't be folded, nothing is left behind then
+
+static void finishFold(const MaterialGroup&, unsigned int);
+// Makes the parameter texture of a group folded into the given program
+// and hands that program to every member
+
+static bool buildSeparately(const MaterialGroup&);
+// One program per distinct source, the way it would be without folding
+
+static void queueSeparately(const MaterialGroup&);
+// Same, in the shader queue
+
+static std::string foldedSource(const MaterialGroup&, size_t, int, bool, bool);
+// Source of one stage of the folded program, with the varying literals
+// read from the parameters starting at the given one
+
+static unsigned int buildProgram(const std::vector<ShaderStage>&, bool);
+// Compiles (through the registry) and links the stages, or loads the
+// program from the cache. Returns 0 if it didn't build
+
+int addMaterial(const ShaderStage *stages, int count) {
+
+	Material material;
+	material.program = 0;
+	material.queued = -1;
+	material.texture = 0;
+	material.index = 0;
+	material.family = shaderFamily("materials");
+
+	for (int i = 0; i < count; i++) {
+
+		MaterialStage stage;
+		stage.type = stages[i].type;
+		stage.source = stages[i].source;
+		findLiterals(&stage);
+
+		material.stages.push_back(stage);
+
+	}
+
+	materials.push_back(material);
+
+	return (int) materials.size() - 1;
+
+}
+
+bool buildMaterials(bool fold) {
+
+	std::map<std::string, MaterialGroup> groups;
+	groupMaterials(&groups);
+
+	bool success = true;
+
+	for (std::map<std::string, MaterialGroup>::iterator it = groups.begin(); it != groups.end(); ++it) {
+
+		MaterialGroup &group = it->second;
+
+		// A folded program counts under the family of its first material
+		const char *outer = setShaderFamily(materials[group.members[0]].family);
+
+		// Nothing varies, all of them are one program anyway
+		bool built = fold && group.stride > 0 && foldGroup(group);
+
+		if (!built && !buildSeparately(group))
+			success = false;
+
+		setShaderFamily(outer);
+
+	}
+
+	for (size_t i = 0; i < heldShaders.size(); i++)
+		releaseShader(heldShaders[i]);
+
+	heldShaders.clear();
+
+	return success;
+
+}
+
+void queueMaterials(bool fold) {
+
+	std::map<std::string, MaterialGroup> groups;
+	groupMaterials(&groups);
+
+	for (std::map<std::string, MaterialGroup>::iterator it = groups.begin(); it != groups.end(); ++it) {
+
+		MaterialGroup &group = it->second;
+		const char *outer = setShaderFamily(materials[group.members[0]].family);
+
+		std::vector<std::string> sources;
+		std::vector<ShaderStage> stages;
+
+		if (fold && group.stride > 0 && foldedSources(group, &sources, &stages)) {
+
+			QueuedBuild queued;
+			queued.build = queueProgram(&stages[0], (int) stages.size());
+			queued.folded = true;
+			queued.group = group;
+
+			queuedBuilds.push_back(queued);
+
+			// Known now, so vertex data can be made while it builds. A
+			// program built separately ignores it
+			for (size_t m = 0; m < group.members.size(); m++) {
+				materials[group.members[m]].queued = queued.build;
+				materials[group.members[m]].index = (int) m;
+			}
+
+		}
+		else {
+			queueSeparately(group);
+		}
+
+		setShaderFamily(outer);
+
+	}
+
+}
+
+bool pollMaterials() {
+
+	std::vector<QueuedBuild> building;
+	building.swap(queuedBuilds);
+
+	for (size_t i = 0; i < building.size(); i++) {
+
+		const QueuedBuild &queued = building[i];
+
+		if (programState(queued.build) == PROGRAM_PENDING) {
+			queuedBuilds.push_back(queued);
+			continue;
+		}
+
+		// The queue printed the log if it failed. The registry keeps the
+		// stages for whatever else uses them
+		unsigned int program = queuedProgram(queued.build);
+		releaseQueuedProgram(queued.build);
+
+		if (program != 0)
+			programs.push_back(program);
+
+		if (queued.folded && program != 0) {
+			finishFold(queued.group, program);
+			continue;
+		}
+
+		if (queued.folded) {
+			std::cout << "Unable to fold " << queued.group.members.size() << " materials into one program, building them separately\n";
+			queueSeparately(queued.group);
+			continue;
+		}
+
+		for (size_t m = 0; m < queued.group.members.size(); m++) {
+
+			Material &material = materials[queued.group.members[m]];
+
+			if (material.queued == queued.build) {
+				material.program = program;
+				material.queued = -1;
+			}
+
+		}
+
+	}
+
+	return queuedBuilds.empty();
+
+}
+
+unsigned int materialProgram(int material) {
+
+	return materials[material].program;
+
+}
+
+int materialIndex(int material) {
+
+	return materials[material].index;
+
+}
+
+void useMaterial(int handle) {
+
+	const Material &material = materials[handle];
+
+	// The fallback program until a queued one is ready
+	unsigned int program = material.queued >= 0 ? programOrFallback(material.queued) : material.program;
+
+	if (program != currentProgram) {
+		glUseProgram(program);
+		currentProgram = program;
+		switches++;
+	}
+
+	if (material.texture != 0 && material.texture != currentTexture) {
+		glActiveTexture(GL_TEXTURE0 + MATERIAL_TEXTURE_UNIT);
+		glBindTexture(GL_TEXTURE_BUFFER, material.texture);
+		glActiveTexture(GL_TEXTURE0);
+		currentTexture = material.texture;
+	}
+
+}
+
+int materialSwitches() {
+
+	int count = switches;
+	switches = 0;
+
+	return count;
+
+}
+
+void stopMaterials() {
+
+	// Finished in the queue but never collected. The queue leaves deleting
+	// its programs to whoever asked for them
+	for (size_t i = 0; i < queuedBuilds.size(); i++) {
+
+		unsigned int program = queuedProgram(queuedBuilds[i].build);
+
+		if (program != 0)
+			programs.push_back(program);
+
+	}
+
+	for (size_t i = 0; i < programs.size(); i++) {
+		forgetProgram(programs[i]);
+		glDeleteProgram(programs[i]);
+	}
+
+	if (!textures.empty())
+		glDeleteTextures((int) textures.size(), &textures[0]);
+
+	if (!buffers.empty())
+		glDeleteBuffers((int) buffers.size(), &buffers[0]);
+
+	materials.clear();
+	queuedBuilds.clear();
+	programs.clear();
+	textures.clear();
+	buffers.clear();
+
+	currentProgram = currentTexture = 0;
+	switches = 0;
+
+}
+
+static void findLiterals(MaterialStage *stage) {
+
+	const std::string &source = stage->source;
+	size_t copied = 0;
+	bool lineStart = true;
+
+	for (size_t i = 0; i < source.size(); ) {
+
+		char c = source[i];
+		char next = i + 1 < source.size() ? source[i + 1] : '\0';
+
+		if (c == '\n') {
+			lineStart = true;
+			i++;
+		}
+		else if (isspace((unsigned char) c)) {
+			i++;
+		}
+		else if (lineStart && c == '#') {
+
+			// Preprocessor lines (#version 330, ...) stay as they are
+			while (i < source.size() && source[i] != '\n')
+				i++;
+
+		}
+		else if (c == '/' && (next == '/' || next == '*')) {
+
+			// Comments don't count as a difference between materials
+			stage->pattern += source.substr(copied, i - copied) + ' ';
+
+			if (next == '/') {
+				while (i < source.size() && source[i] != '\n')
+					i++;
+			}
+			else {
+				size_t end = source.find("*/", i + 2);
+				i = end == std::string::npos ? source.size() : end + 2;
+				lineStart = false;
+			}
+
+			copied = i;
+
+		}
+		else if (isalpha((unsigned char) c) || c == '_') {
+
+			// Identifiers, so the 4 in vec4 is never a literal
+			while (i < source.size() && (isalnum((unsigned char) source[i]) || source[i] == '_'))
+				i++;
+
+			lineStart = false;
+
+		}
+		else if (isdigit((unsigned char) c) || (c == '.' && isdigit((unsigned char) next))) {
+
+			size_t start = i;
+			bool isFloat = false;
+
+			if (c == '0' && (next == 'x' || next == 'X')) {
+				i += 2;
+				while (i < source.size() && isxdigit((unsigned char) source[i]))
+					i++;
+			}
+			else {
+
+				while (i < source.size() && isdigit((unsigned char) source[i]))
+					i++;
+
+				if (i < source.size() && source[i] == '.') {
+					isFloat = true;
+					i++;
+					while (i < source.size() && isdigit((unsigned char) source[i]))
+						i++;
+				}
+
+				if (i < source.size() && (source[i] == 'e' || source[i] == 'E')) {
+
+					size_t exponent = i + 1;
+
+					if (exponent < source.size() && (source[exponent] == '+' || source[exponent] == '-'))
+						exponent++;
+
+					if (exponent < source.size() && isdigit((unsigned char) source[exponent])) {
+						isFloat = true;
+						i = exponent;
+						while (i < source.size() && isdigit((unsigned char) source[i]))
+							i++;
+					}
+
+				}
+
+			}
+
+			// Doubles (lf) stay, a float parameter would lose precision
+			if (i + 1 < source.size() && (source.compare(i, 2, "lf") == 0 || source.compare(i, 2, "LF") == 0)) {
+				isFloat = false;
+				i += 2;
+			}
+			else if (i < source.size() && (source[i] == 'f' || source[i] == 'F')) {
+				isFloat = true;
+				i++;
+			}
+			else if (i < source.size() && (source[i] == 'u' || source[i] == 'U')) {
+				i++;
+			}
+
+			if (isFloat) {
+
+				SourceLiteral literal;
+				literal.start = start;
+				literal.length = i - start;
+				literal.value = strtof(source.substr(start, i - start).c_str(), NULL);
+
+				stage->literals.push_back(literal);
+				stage->pattern += source.substr(copied, start - copied) + '\1';
+				copied = i;
+
+			}
+
+			lineStart = false;
+
+		}
+		else {
+			i++;
+			lineStart = false;
+		}
+
+	}
+
+	stage->pattern += source.substr(copied);
+
+}
+
+static void groupMaterials(std::map<std::string, MaterialGroup> *groups) {
+
+	// Materials whose sources only differ in float literals end up together
+	for (size_t i = 0; i < materials.size(); i++) {
+
+		if (materials[i].program != 0 || materials[i].queued >= 0)
+			continue;
+
+		std::string key;
+
+		for (size_t s = 0; s < materials[i].stages.size(); s++) {
+			char type[16];
+			snprintf(type, sizeof(type), "%u:", materials[i].stages[s].type);
+			key += type + materials[i].stages[s].pattern + '\0';
+		}
+
+		(*groups)[key].members.push_back((int) i);
+
+	}
+
+	for (std::map<std::string, MaterialGroup>::iterator it = groups->begin(); it != groups->end(); ++it) {
+
+		MaterialGroup &group = it->second;
+		const Material &first = materials[group.members[0]];
+
+		group.stride = 0;
+		group.varies.resize(first.stages.size());
+
+		for (size_t s = 0; s < first.stages.size(); s++) {
+
+			size_t count = first.stages[s].literals.size();
+			group.varies[s].assign(count, false);
+
+			for (size_t l = 0; l < count; l++) {
+
+				for (size_t m = 1; m < group.members.size(); m++) {
+					if (materials[group.members[m]].stages[s].literals[l].value != first.stages[s].literals[l].value) {
+						group.varies[s][l] = true;
+						group.stride++;
+						break;
+					}
+				}
+
+			}
+
+		}
+
+	}
+
+}
+
+static bool foldedSources(const MaterialGroup &group, std::vector<std::string> *sources, std::vector<ShaderStage> *stages) {
+
+	const Material &first = materials[group.members[0]];
+
+	int vertexStage = -1;
+	bool vertexParameters = false, fragmentParameters = false, otherParameters = false;
+
+	for (size_t s = 0; s < first.stages.size(); s++) {
+
+		bool parameters = false;
+
+		for (size_t l = 0; l < group.varies[s].size(); l++)
+			parameters = parameters || group.varies[s][l];
+
+		if (first.stages[s].type == GL_VERTEX_SHADER) {
+			vertexStage = (int) s;
+			vertexParameters = parameters;
+		}
+		else if (first.stages[s].type == GL_FRAGMENT_SHADER) {
+			fragmentParameters = parameters;
+		}
+		else if (parameters) {
+			otherParameters = true;
+		}
+
+	}
+
+	// The index comes in through the vertex stage and has to get to the
+	// fragment stage directly
+	if (vertexStage < 0 || otherParameters)
+		return false;
+
+	if (fragmentParameters && first.stages.size() != 2)
+		return false;
+
+	int maxTexels = 0;
+	glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels);
+
+	if ((long long) group.members.size() * group.stride > maxTexels)
+		return false;
+
+	sources->resize(first.stages.size());
+	stages->resize(first.stages.size());
+	int parameter = 0;
+
+	for (size_t s = 0; s < first.stages.size(); s++) {
+
+		(*sources)[s] = foldedSource(group, s, parameter, vertexParameters, fragmentParameters);
+
+		// An empty source means main wasn't where we expected it
+		if ((*sources)[s].empty())
+			return false;
+
+		for (size_t l = 0; l < group.varies[s].size(); l++)
+			parameter += group.varies[s][l] ? 1 : 0;
+
+	}
+
+	// Pointing into the strings only once they're all in place
+	for (size_t s = 0; s < first.stages.size(); s++) {
+		(*stages)[s].type = first.stages[s].type;
+		(*stages)[s].source = (*sources)[s].c_str();
+	}
+
+	return true;
+
+}
+
+static bool foldGroup(MaterialGroup &group) {
+
+	std::vector<std::string> sources;
+	std::vector<ShaderStage> stages;
+
+	if (!foldedSources(group, &sources, &stages))
+		return false;
+
+	unsigned int program = buildProgram(stages, false);
+
+	if (program == 0) {
+		std::cout << "Unable to fold " << group.members.size() << " materials into one program, building them separately\n";
+		return false;
+	}
+
+	finishFold(group, program);
+
+	return true;
+
+}
+
+static void finishFold(const MaterialGroup &group, unsigned int program) {
+
+	// One row of parameters per material, in the order of the members
+	std::vector<float> parameters;
+	parameters.reserve(group.members.size() * group.stride);
+
+	for (size_t m = 0; m < group.members.size(); m++) {
+
+		const Material &material = materials[group.members[m]];
+
+		for (size_t s = 0; s < material.stages.size(); s++) {
+			for (size_t l = 0; l < group.varies[s].size(); l++) {
+				if (group.varies[s][l])
+					parameters.push_back(material.stages[s].literals[l].value);
+			}
+		}
+
+	}
+
+	unsigned int buffer, texture;
+	glGenBuffers(1, &buffer);
+	glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+	glBufferData(GL_TEXTURE_BUFFER, parameters.size() * sizeof(float), &parameters[0], GL_STATIC_DRAW);
+	glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_BUFFER, texture);
+	glTexBuffer(GL_TEXTURE_BUFFER, GL_R32F, buffer);
+	glBindTexture(GL_TEXTURE_BUFFER, 0);
+
+	glUseProgram(program);
+	glUniform1i(uniformLocation(reflectProgram(program), NAME_HASH("materialParameters")), MATERIAL_TEXTURE_UNIT);
+	glUseProgram(currentProgram);
+
+	buffers.push_back(buffer);
+	textures.push_back(texture);
+
+	for (size_t m = 0; m < group.members.size(); m++) {
+		Material &material = materials[group.members[m]];
+		material.program = program;
+		material.queued = -1;
+		material.texture = texture;
+		material.index = (int) m;
+	}
+
+}
+
+static bool buildSeparately(const MaterialGroup &group) {
+
+	// Same sources, same program
+	std::map<std::string, unsigned int> built;
+	bool success = true;
+
+	for (size_t m = 0; m < group.members.size(); m++) {
+
+		Material &material = materials[group.members[m]];
+
+		std::string key;
+		std::vector<ShaderStage> stages(material.stages.size());
+
+		for (size_t s = 0; s < material.stages.size(); s++) {
+			key += material.stages[s].source + '\0';
+			stages[s].type = material.stages[s].type;
+			stages[s].source = material.stages[s].source.c_str();
+		}
+
+		std::map<std::string, unsigned int>::iterator it = built.find(key);
+
+		if (it == built.end())
+			it = built.insert(std::make_pair(key, buildProgram(stages, true))).first;
+
+		material.program = it->second;
+		material.queued = -1;
+		material.texture = 0;
+		material.index = 0;
+
+		if (material.program == 0)
+			success = false;
+
+	}
+
+	return success;
+
+}
+
+static void queueSeparately(const MaterialGroup &group) {
+
+	// Same sources, same program
+	std::map<std::string, int> queued;
+
+	for (size_t m = 0; m < group.members.size(); m++) {
+
+		Material &material = materials[group.members[m]];
+
+		std::string key;
+		std::vector<ShaderStage> stages(material.stages.size());
+
+		for (size_t s = 0; s < material.stages.size(); s++) {
+			key += material.stages[s].source + '\0';
+			stages[s].type = material.stages[s].type;
+			stages[s].source = material.stages[s].source.c_str();
+		}
+
+		std::map<std::string, int>::iterator it = queued.find(key);
+
+		if (it == queued.end()) {
+
+			QueuedBuild build;
+			build.build = queueProgram(&stages[0], (int) stages.size());
+			build.folded = false;
+			build.group = group;
+
+			queuedBuilds.push_back(build);
+			it = queued.insert(std::make_pair(key, build.build)).first;
+
+		}
+
+		material.queued = it->second;
+		material.texture = 0;
+		material.index = 0;
+
+	}
+
+}
+
+static std::string foldedSource(const MaterialGroup &group, size_t s, int parameter, bool vertexParameters, bool fragmentParameters) {
+
+	const MaterialStage &stage = materials[group.members[0]].stages[s];
+	bool vertex = stage.type == GL_VERTEX_SHADER;
+
+	char stride[16];
+	snprintf(stride, sizeof(stride), "%d", group.stride);
+
+	std::string index = vertex ? "materialAttribute" : "materialIndex";
+	std::string source;
+	size_t copied = 0;
+
+	for (size_t l = 0; l < stage.literals.size(); l++) {
+
+		if (!group.varies[s][l])
+			continue;
+
+		char offset[16];
+		snprintf(offset, sizeof(offset), "%d", parameter++);
+
+		source += stage.source.substr(copied, stage.literals[l].start - copied);
+		source += "texelFetch(materialParameters, " + index + " * " + stride + " + " + offset + ").r";
+		copied = stage.literals[l].start + stage.literals[l].length;
+
+	}
+
+	source += stage.source.substr(copied);
+
+	std::string declarations;
+
+	if (vertex) {
+
+		char attribute[64];
+		snprintf(attribute, sizeof(attribute), "layout(location = %d) in int materialAttribute;\n", MATERIAL_ATTRIBUTE);
+
+		declarations = attribute;
+
+		if (fragmentParameters)
+			declarations += "flat out int materialIndex;\n";
+
+		if (vertexParameters)
+			declarations += "uniform samplerBuffer materialParameters;\n";
+
+		// Passed on first thing, before anything can return
+		if (fragmentParameters) {
+
+			std::smatch match;
+
+			if (!std::regex_search(source, match, std::regex("\\bvoid\\s+main\\s*\\(\\s*(void\\s*)?\\)\\s*\\{")))
+				return "";
+
+			// On the same line, so the lines after it keep their numbers
+			size_t body = match.position(0) + match.length(0);
+			source.insert(body, " materialIndex = materialAttribute;");
+
+		}
+
+	}
+	else if (fragmentParameters) {
+		declarations = "flat in int materialIndex;\nuniform samplerBuffer materialParameters;\n";
+	}
+
+	return withPreamble(source, declarations);
+
+}
+
+static unsigned int buildProgram(const std::vector<ShaderStage> &stages, bool printLog) {
+
+	// Stages let go of in buildMaterials, once every program is linked
+	unsigned int program = buildLinkedProgram(&stages[0], (int) stages.size(), &heldShaders, printLog ? "material program" : NULL);
+
+	if (program != 0)
+		programs.push_back(program);
+
+	return program;
+
+}
@@ -0,0 +1,84 @@
+/*
+* Description: Materials as sets of shader stages, built so that
+*		materials differing only in float constants share one
+*		program. All registered materials are grouped by their
+*		sources with the float literals taken out; within a
+*		group, every literal that isn't the same for all of
+*		them becomes a per-material parameter, read from a
+*		buffer texture indexed by a material index the vertex
+*		stage gets as an attribute. A group then draws with a
+*		single program, and objects with different materials
+*		of the group can go into the same (instanced) draw.
+*
+*		Folding needs a vertex stage to add the material index
+*		to (GLSL 3.30 or later, it comes in at an explicit
+*		location), and only a vertex and a fragment stage when
+*		the fragment stage has parameters. Literals that have to be
+*		constant (const initializers, ...) make the folded
+*		program fail to compile; the group is then built as one
+*		program per distinct source, like without folding.
+*
+*		A render loop that mustn't stall queues the materials
+*		instead of building them: the programs get built by the
+*		shader queue (ShaderQueue.h) and useMaterial binds its
+*		fallback program until they're ready.
+*
+*		Typical use:
+*			int material = addMaterial(stages, 2);
+*			... more materials ...
+*			buildMaterials(true);
+*			useMaterial(material);
+*			glVertexAttribI1i(MATERIAL_ATTRIBUTE, materialIndex(material));
+*			glDrawArrays(...);
+*/
+
+#ifndef MATERIAL_SYSTEM_H
+#define MATERIAL_SYSTEM_H
+
+#include "ProgramCache.h"
+
+// Vertex attribute the material index comes in on, per vertex or per
+// instance (an int, see glVertexAttribIPointer)
+const int MATERIAL_ATTRIBUTE = 15;
+
+// Texture unit the parameters of the current group are bound to
+const int MATERIAL_TEXTURE_UNIT = 15;
+
+int addMaterial(const ShaderStage*, int);
+// Registers a material made of these stages and returns its handle. The
+// sources are copied, nothing is built until buildMaterials
+
+bool buildMaterials(bool);
+// Builds the programs of every registered material, folding constant-only
+// variants into one program when asked to. Returns false if any material
+// ended up without a program, the log was printed
+
+void queueMaterials(bool);
+// Same, but starts building the programs in the shader queue and returns
+// right away. Materials queued or built already are left alone
+
+bool pollMaterials();
+// Picks up the queued programs that finished, after pollShaderQueue.
+// A folded program that failed gets queued again as separate ones.
+// Returns true once nothing is queued anymore
+
+unsigned int materialProgram(int);
+// The program the material draws with, 0 while it's queued or if it
+// didn't build
+
+int materialIndex(int);
+// What to feed MATERIAL_ATTRIBUTE for this material, 0 when its program
+// has no parameters. Known as soon as the materials are queued
+
+void useMaterial(int);
+// Makes the material's program current and binds its parameters,
+// skipping whatever is current already. The shader queue's fallback
+// program while it's queued
+
+int materialSwitches();
+// How many times useMaterial changed the program since the last call
+
+void stopMaterials();
+// Deletes the programs and parameter buffers and forgets every material
+
+#endif
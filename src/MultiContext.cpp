@@ -0,0 +1,278 @@
+/*
+* Description: Offscreen batch rendering with one OpenGL context
+*		per thread. Every worker thread loads its own glad
+*		dispatch table with gladLoadGLContext, makes it current
+*		for itself, and then renders a batch of frames into a
+*		framebuffer object using the normal gl* functions.
+*
+*	Both this file and glad.c have to be compiled with GLAD_GL_MX
+*	defined, so the glad function pointers are thread-local.
+*	Pass the number of threads as the first argument (defaults
+*	to the number of cores).
+*/
+
+#ifndef GLAD_GL_MX
+#error "MultiContext.cpp (and glad.c) must be compiled with GLAD_GL_MX defined"
+#endif
+
+// Including core libraries
+#include <iostream>
+#include <cstdlib>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Including openGL dependencies
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// Size of the offscreen image every thread renders into
+const int WIDTH = 256,
+	HEIGHT = 256;
+
+// How many frames each thread renders
+const int FRAMES = 1000;
+
+const char *WINDOW_NAME = "Multi Context Test";
+
+const char *vertexShader =
+	"#version 330 core\n"
+	"layout (location = 0) in vec3 aPos;\n"
+	"void main() {\n"
+	"	gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
+	"}";
+
+const char *fragmentShader =
+	"#version 330 core\n"
+	"out vec4 FragColor;\n"
+	"void main() {\n"
+	"	FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
+	"}";
+
+struct WorkerResult {
+	bool success;
+	double milliseconds;
+	unsigned char centerPixel[4];
+};
+
+void renderBatch(GLFWwindow*, WorkerResult*);
+// Thread function. Loads GL for the window's context, then renders
+// FRAMES frames offscreen and reads back the center pixel
+
+unsigned int generateShaderProg();
+// Builds the shader program for the current context. Returns 0 on failure
+
+int main(int argc, char **argv) {
+
+	unsigned int threadCount = std::thread::hardware_concurrency();
+
+	if (argc > 1)
+		threadCount = (unsigned int) atoi(argv[1]);
+
+	if (threadCount == 0)
+		threadCount = 1;
+
+	if (glfwInit() == GLFW_FALSE) {
+		std::cout << "There was an error starting GLFW!\n";
+		return -1;
+	}
+
+	// Setting the OpenGL version to 3.3 (CORE)
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+	// For compatibility with Macs
+	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+
+	// The windows are only there to own a context, so keep them hidden
+	glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+	// Windows (and their contexts) have to be created on the main thread
+	std::vector<GLFWwindow*> windows;
+
+	for (unsigned int i = 0; i < threadCount; i++) {
+
+		GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, WINDOW_NAME, NULL, NULL);
+
+		if (window == NULL) {
+			std::cout << "Unable to create GLFW context!\n";
+			glfwTerminate();
+			return -1;
+		}
+
+		windows.push_back(window);
+
+	}
+
+	std::vector<WorkerResult> results(threadCount);
+	std::vector<std::thread> workers;
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	for (unsigned int i = 0; i < threadCount; i++)
+		workers.push_back(std::thread(renderBatch, windows[i], &results[i]));
+
+	for (unsigned int i = 0; i < threadCount; i++)
+		workers[i].join();
+
+	double total = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	int status = 0;
+
+	for (unsigned int i = 0; i < threadCount; i++) {
+
+		if (!results[i].success) {
+			std::cout << "Thread " << i << " failed!\n";
+			status = -1;
+			continue;
+		}
+
+		std::cout << "Thread " << i << ": " << FRAMES << " frames in " << results[i].milliseconds << " ms, center pixel ("
+			<< (int) results[i].centerPixel[0] << ", " << (int) results[i].centerPixel[1] << ", "
+			<< (int) results[i].centerPixel[2] << ")\n";
+
+	}
+
+	std::cout << threadCount * FRAMES << " frames on " << threadCount << " threads in " << total << " ms\n";
+
+	for (unsigned int i = 0; i < threadCount; i++)
+		glfwDestroyWindow(windows[i]);
+
+	glfwTerminate();
+
+	return status;
+
+}
+
+void renderBatch(GLFWwindow *window, WorkerResult *result) {
+
+	result->success = false;
+
+	// Every thread gets its own dispatch table for its own context
+	glfwMakeContextCurrent(window);
+
+	gladGLContext context;
+
+	if (!gladLoadGLContext(&context, (GLADloadproc) glfwGetProcAddress)) {
+		glfwMakeContextCurrent(NULL);
+		return;
+	}
+
+	// gladLoadGLContext already made it current, but this is how a
+	// thread would switch between several loaded contexts
+	gladMakeGLContextCurrent(&context);
+
+	unsigned int shaderProg = generateShaderProg();
+
+	if (shaderProg == 0) {
+		gladFreeGLContext(&context);
+		glfwMakeContextCurrent(NULL);
+		return;
+	}
+
+	// Offscreen target, since hidden windows have no visible framebuffer
+	unsigned int FBO, colorBuffer;
+	glGenFramebuffers(1, &FBO);
+	glGenRenderbuffers(1, &colorBuffer);
+
+	glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, WIDTH, HEIGHT);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+
+	// Same triangle as Main.cpp
+	float vertices[] = {
+		-0.5f, -0.5f, 0.0f,
+		0.5f, -0.5f, 0.0f,
+		0.0f,  0.5f, 0.0f
+	};
+
+	unsigned int VAO, VBO;
+	glGenVertexArrays(1, &VAO);
+	glGenBuffers(1, &VBO);
+
+	glBindVertexArray(VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+
+	glViewport(0, 0, WIDTH, HEIGHT);
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	for (int frame = 0; frame < FRAMES; frame++) {
+
+		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		glUseProgram(shaderProg);
+		glBindVertexArray(VAO);
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+
+	}
+
+	// Reading the result back waits for all the frames to finish
+	glReadPixels(WIDTH / 2, HEIGHT / 2, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, result->centerPixel);
+
+	result->milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	result->success = glGetError() == GL_NO_ERROR;
+
+	// Clean up everything this context owns
+	glDeleteVertexArrays(1, &VAO);
+	glDeleteBuffers(1, &VBO);
+	glDeleteRenderbuffers(1, &colorBuffer);
+	glDeleteFramebuffers(1, &FBO);
+	glDeleteProgram(shaderProg);
+
+	gladFreeGLContext(&context);
+	glfwMakeContextCurrent(NULL);
+
+}
+
+unsigned int generateShaderProg() {
+
+	unsigned int vShaderID, fShaderID;
+
+	vShaderID = glCreateShader(GL_VERTEX_SHADER);
+	fShaderID = glCreateShader(GL_FRAGMENT_SHADER);
+
+	glShaderSource(vShaderID, 1, &vertexShader, NULL);
+	glShaderSource(fShaderID, 1, &fragmentShader, NULL);
+
+	glCompileShader(vShaderID);
+	glCompileShader(fShaderID);
+
+	unsigned int progID = glCreateProgram();
+
+	glAttachShader(progID, vShaderID);
+	glAttachShader(progID, fShaderID);
+
+	glLinkProgram(progID);
+
+	glDeleteShader(vShaderID);
+	glDeleteShader(fShaderID);
+
+	// Make sure the program linked, which also covers compile errors
+	int success;
+	char log[512];
+
+	glGetProgramiv(progID, GL_LINK_STATUS, &success);
+
+	if (!success) {
+
+		glGetProgramInfoLog(progID, 512, NULL, log);
+
+		std::cout << "There was an error linking the shader program!\n"
+			<< log;
+
+		glDeleteProgram(progID);
+		return 0;
+
+	}
+
+	return progID;
+
+}
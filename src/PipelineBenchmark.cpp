@@ -0,0 +1,376 @@
+/*
+* Description: Benchmark for separable program pipelines. Builds
+*		every combination of a set of vertex and fragment shader
+*		variants twice: once as whole programs, the way the
+*		demos' generateShaderProg does it (one link per
+*		combination), and once as separable stages combined in a
+*		program pipeline (one link per stage, see
+*		ShaderPipeline.h). Then draws every combination each
+*		frame with both, to compare what switching costs.
+*
+*	Frames alternate between the two ways of binding so neither
+*	one gets all the warm caches. Needs GL 4.1 or
+*	ARB_separate_shader_objects.
+*/
+
+// Including core libraries
+#include <iostream>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+
+// Including openGL dependencies
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// Shared window/context setup
+#include "AppContext.h"
+#include "ShaderPipeline.h"
+#include "ProgramReflection.h"
+#include "StartupTimeline.h"
+
+const int WIDTH = 800,
+	HEIGHT = 600;
+
+const char *WINDOW_NAME = "Pipeline Benchmark";
+
+// Every vertex variant gets drawn with every fragment variant
+const int VERTEX_VARIANTS = 8,
+	FRAGMENT_VARIANTS = 16;
+
+// Frames measured for each way of binding
+const int FRAMES = 100;
+
+struct BindTime {
+	double submit;		// Time spent issuing binds and draws (ms)
+	double frame;		// Same, plus waiting for the frame to finish (ms)
+};
+
+std::string vertexSource(int);
+// A vertex shader that puts its triangle somewhere of its own
+
+std::string fragmentSource(int);
+// A fragment shader with its own color
+
+bool linkPrograms(std::vector<unsigned int>&);
+// One program per combination. Returns false if one didn't link
+
+bool linkStages(std::vector<unsigned int>&, std::vector<unsigned int>&);
+// One separable program per variant. Returns false if one didn't build
+
+std::vector<int> columnLocations(const std::vector<unsigned int>&);
+// Where the column uniform is in each of the programs
+
+void drawPrograms(const std::vector<unsigned int>&, const std::vector<int>&, BindTime*);
+// Draws every combination with glUseProgram
+
+void drawPipeline(unsigned int, const std::vector<unsigned int>&, const std::vector<int>&,
+	const std::vector<unsigned int>&, BindTime*);
+// Draws every combination by swapping stages in the pipeline
+
+void printResults(const char*, int, double, std::vector<BindTime>&);
+// Prints the link count and time and the median frame times
+
+int main() {
+
+	AppContext app;
+
+	if (!createAppContext(&app, WIDTH, HEIGHT, WINDOW_NAME))
+		return -1;
+
+	if (!app.caps.separateShaderObjects) {
+		std::cout << "Separate shader objects aren't available, nothing to compare!\n";
+		destroyAppContext(&app);
+		return -1;
+	}
+
+	// Whole programs first, so the driver's own caches can only help
+	// the separable stages if anything
+	std::vector<unsigned int> programs;
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	bool linked = linkPrograms(programs);
+	double programMs = millisecondsSince(start);
+
+	std::vector<unsigned int> vertexStages, fragmentStages;
+
+	start = std::chrono::steady_clock::now();
+	linked = linkStages(vertexStages, fragmentStages) && linked;
+	double stageMs = millisecondsSince(start);
+
+	if (!linked) {
+		std::cout << "There was an error building the shaders!\n";
+		destroyAppContext(&app);
+		return -1;
+	}
+
+	// A small triangle, each vertex variant moves it somewhere else
+	float vertices[] = {
+		-0.05f, -0.05f, 0.0f,
+		0.05f, -0.05f, 0.0f,
+		0.0f,  0.05f, 0.0f
+	};
+
+	unsigned int VAO, VBO;
+	glGenVertexArrays(1, &VAO);
+	glGenBuffers(1, &VBO);
+
+	glBindVertexArray(VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+
+	glViewport(0, 0, WIDTH, HEIGHT);
+
+	unsigned int pipeline = createPipeline();
+
+	// Looked up front, neither loop should pay for the lookups
+	std::vector<int> programColumns = columnLocations(programs);
+	std::vector<int> stageColumns = columnLocations(vertexStages);
+
+	std::vector<BindTime> programTimes, pipelineTimes;
+
+	for (int frame = 0; frame < 2 * FRAMES; frame++) {
+
+		BindTime time;
+
+		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+
+		// Alternate which way gets measured on every frame
+		if (frame % 2 == 0) {
+			drawPrograms(programs, programColumns, &time);
+			programTimes.push_back(time);
+		}
+		else {
+			drawPipeline(pipeline, vertexStages, stageColumns, fragmentStages, &time);
+			pipelineTimes.push_back(time);
+		}
+
+		appSwapBuffers(&app);
+
+	}
+
+	std::cout << VERTEX_VARIANTS << " vertex x " << FRAGMENT_VARIANTS << " fragment variants, "
+		<< VERTEX_VARIANTS * FRAGMENT_VARIANTS << " draws per frame\n";
+
+	printResults("programs", (int) programs.size(), programMs, programTimes);
+	printResults("pipeline", (int) (vertexStages.size() + fragmentStages.size()), stageMs, pipelineTimes);
+
+	deletePipeline(pipeline);
+
+	for (size_t i = 0; i < programs.size(); i++) {
+		forgetProgram(programs[i]);
+		glDeleteProgram(programs[i]);
+	}
+
+	for (size_t i = 0; i < vertexStages.size(); i++)
+		deleteStageProgram(vertexStages[i]);
+
+	for (size_t i = 0; i < fragmentStages.size(); i++)
+		deleteStageProgram(fragmentStages[i]);
+
+	glDeleteVertexArrays(1, &VAO);
+	glDeleteBuffers(1, &VBO);
+
+	destroyAppContext(&app);
+
+	return 0;
+
+}
+
+std::string vertexSource(int variant) {
+
+	// Spread over a grid of rows, one row per vertex variant
+	char offset[64];
+	snprintf(offset, sizeof(offset), "vec3(-0.9, %f, 0.0)", -0.9 + 1.8 * variant / VERTEX_VARIANTS);
+
+	return std::string("#version 330 core\n"
+		"layout (location = 0) in vec3 aPos;\n"
+		"uniform float column;\n"
+		"void main() {\n"
+		"	gl_Position = vec4(aPos + ") + offset + " + vec3(column, 0.0, 0.0), 1.0);\n"
+		"}";
+
+}
+
+std::string fragmentSource(int variant) {
+
+	char color[64];
+	snprintf(color, sizeof(color), "vec4(%f, 0.5, %f, 1.0)",
+		(float) variant / FRAGMENT_VARIANTS, 1.0f - (float) variant / FRAGMENT_VARIANTS);
+
+	return std::string("#version 330 core\n"
+		"out vec4 FragColor;\n"
+		"void main() {\n"
+		"	FragColor = ") + color + ";\n"
+		"}";
+
+}
+
+bool linkPrograms(std::vector<unsigned int> &programs) {
+
+	std::vector<unsigned int> vertexShaders, fragmentShaders;
+
+	// Each stage compiled once, only the links multiply
+	for (int v = 0; v < VERTEX_VARIANTS; v++) {
+		std::string source = vertexSource(v);
+		const char *text = source.c_str();
+		vertexShaders.push_back(glCreateShader(GL_VERTEX_SHADER));
+		glShaderSource(vertexShaders.back(), 1, &text, NULL);
+		glCompileShader(vertexShaders.back());
+	}
+
+	for (int f = 0; f < FRAGMENT_VARIANTS; f++) {
+		std::string source = fragmentSource(f);
+		const char *text = source.c_str();
+		fragmentShaders.push_back(glCreateShader(GL_FRAGMENT_SHADER));
+		glShaderSource(fragmentShaders.back(), 1, &text, NULL);
+		glCompileShader(fragmentShaders.back());
+	}
+
+	bool success = true;
+
+	for (int v = 0; v < VERTEX_VARIANTS; v++) {
+		for (int f = 0; f < FRAGMENT_VARIANTS; f++) {
+
+			unsigned int program = glCreateProgram();
+			glAttachShader(program, vertexShaders[v]);
+			glAttachShader(program, fragmentShaders[f]);
+			glLinkProgram(program);
+
+			// Waits for the link, so the time covers all of it
+			int linked;
+			glGetProgramiv(program, GL_LINK_STATUS, &linked);
+
+			if (!linked)
+				success = false;
+
+			programs.push_back(program);
+
+		}
+	}
+
+	for (int v = 0; v < VERTEX_VARIANTS; v++)
+		glDeleteShader(vertexShaders[v]);
+
+	for (int f = 0; f < FRAGMENT_VARIANTS; f++)
+		glDeleteShader(fragmentShaders[f]);
+
+	return success;
+
+}
+
+bool linkStages(std::vector<unsigned int> &vertexStages, std::vector<unsigned int> &fragmentStages) {
+
+	bool success = true;
+
+	// createStageProgram reads the link status, same as above
+	for (int v = 0; v < VERTEX_VARIANTS; v++) {
+		vertexStages.push_back(createStageProgram(GL_VERTEX_SHADER, vertexSource(v).c_str()));
+		success = success && vertexStages.back() != 0;
+	}
+
+	for (int f = 0; f < FRAGMENT_VARIANTS; f++) {
+		fragmentStages.push_back(createStageProgram(GL_FRAGMENT_SHADER, fragmentSource(f).c_str()));
+		success = success && fragmentStages.back() != 0;
+	}
+
+	return success;
+
+}
+
+std::vector<int> columnLocations(const std::vector<unsigned int> &programs) {
+
+	std::vector<int> locations;
+
+	for (size_t i = 0; i < programs.size(); i++)
+		locations.push_back(uniformLocation(reflectProgram(programs[i]), NAME_HASH("column")));
+
+	return locations;
+
+}
+
+void drawPrograms(const std::vector<unsigned int> &programs, const std::vector<int> &columns, BindTime *time) {
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	for (int v = 0; v < VERTEX_VARIANTS; v++) {
+		for (int f = 0; f < FRAGMENT_VARIANTS; f++) {
+
+			// Every draw is a different program, with its own uniforms
+			int combination = v * FRAGMENT_VARIANTS + f;
+			glUseProgram(programs[combination]);
+			glUniform1f(columns[combination], 1.8f * f / FRAGMENT_VARIANTS);
+
+			glDrawArrays(GL_TRIANGLES, 0, 3);
+
+		}
+	}
+
+	time->submit = millisecondsSince(start);
+
+	glFinish();
+	time->frame = millisecondsSince(start);
+
+	// The pipeline only gets used with no program active
+	glUseProgram(0);
+
+}
+
+void drawPipeline(unsigned int pipeline, const std::vector<unsigned int> &vertexStages, const std::vector<int> &columns,
+	const std::vector<unsigned int> &fragmentStages, BindTime *time) {
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	bindPipeline(pipeline);
+
+	for (int v = 0; v < VERTEX_VARIANTS; v++) {
+
+		// Only changes every FRAGMENT_VARIANTS draws
+		usePipelineStage(pipeline, GL_VERTEX_SHADER, vertexStages[v]);
+
+		for (int f = 0; f < FRAGMENT_VARIANTS; f++) {
+
+			usePipelineStage(pipeline, GL_FRAGMENT_SHADER, fragmentStages[f]);
+			// The uniform lives in the vertex stage, set it there
+			glProgramUniform1f(vertexStages[v], columns[v], 1.8f * f / FRAGMENT_VARIANTS);
+
+			glDrawArrays(GL_TRIANGLES, 0, 3);
+
+		}
+
+	}
+
+	time->submit = millisecondsSince(start);
+
+	glFinish();
+	time->frame = millisecondsSince(start);
+
+	bindPipeline(0);
+
+}
+
+void printResults(const char *mode, int links, double linkMs, std::vector<BindTime> &times) {
+
+	std::vector<double> submit, frame;
+
+	for (size_t i = 0; i < times.size(); i++) {
+		submit.push_back(times[i].submit);
+		frame.push_back(times[i].frame);
+	}
+
+	std::sort(submit.begin(), submit.end());
+	std::sort(frame.begin(), frame.end());
+
+	int draws = VERTEX_VARIANTS * FRAGMENT_VARIANTS;
+
+	std::cout << mode << ":\n"
+		<< "  links   " << links << " in " << linkMs << " ms\n"
+		<< "  submit  median " << submit[submit.size() / 2] << " ms (" << 1000.0 * submit[submit.size() / 2] / draws << " us per draw)\n"
+		<< "  frame   median " << frame[frame.size() / 2] << " ms, best " << frame[0] << " ms\n";
+
+}
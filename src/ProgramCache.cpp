@@ -0,0 +1,239 @@
+#include "ProgramCache.h"
+#include "ShaderTelemetry.h"
+#include "Hash.h"
+
+// Including core libraries
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+#include <glad/glad.h>
+
+// Bump when CacheHeader changes, old files then just miss
+const uint32_t CACHE_VERSION = 1;
+
+// Anything bigger is a broken file, not a program
+const uint32_t MAX_BINARY = 64 * 1024 * 1024;
+
+struct CacheHeader {
+	char magic[4];			// "GLPB"
+	uint32_t version;
+	uint64_t key;			// Same as the file name, guards against renamed files
+	uint32_t format;		// Binary format glGetProgramBinary gave us
+	uint32_t length;		// Bytes of binary following the header
+};
+
+static bool enabled;
+static std::string directory;
+static uint64_t driverKey;
+
+static int hits, misses, rejected, stored;
+
+static uint64_t programKey(const ShaderStage*, int);
+// The driver identity and every stage's type and source
+
+static std::string cachePath(uint64_t);
+// Where the binary with the given key lives
+
+void startProgramCache(const GLCaps &caps) {
+
+	enabled = false;
+	hits = misses = rejected = stored = 0;
+
+	if (!caps.programBinary)
+		return;
+
+	const char *path = getenv("APP_PROGRAM_CACHE");
+
+	if (path != NULL && (strcmp(path, "off") == 0 || strcmp(path, "0") == 0))
+		return;
+
+	directory = path != NULL && *path != '\0' ? path : "program_cache";
+
+	// Fails harmlessly when it's already there
+#ifdef _WIN32
+	_mkdir(directory.c_str());
+#else
+	mkdir(directory.c_str(), 0755);
+#endif
+
+	// Binaries are only good for the exact driver that made them
+	GLenum names[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+
+	driverKey = FNV1A64_OFFSET;
+
+	for (int i = 0; i < 3; i++) {
+		const char *value = (const char*) glGetString(names[i]);
+		if (value != NULL)
+			driverKey = fnv1a64(driverKey, value, strlen(value) + 1);
+	}
+
+	enabled = true;
+
+}
+
+bool loadCachedProgram(const ShaderStage *stages, int count, unsigned int *program) {
+
+	if (!enabled)
+		return false;
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	uint64_t key = programKey(stages, count);
+	std::string path = cachePath(key);
+
+	std::ifstream file(path.c_str(), std::ios::binary);
+	CacheHeader header;
+
+	if (!file || !file.read((char*) &header, sizeof(header))
+		|| memcmp(header.magic, "GLPB", 4) != 0 || header.version != CACHE_VERSION
+		|| header.key != key || header.length == 0 || header.length > MAX_BINARY) {
+		misses++;
+		return false;
+	}
+
+	std::vector<char> binary(header.length);
+
+	if (!file.read(&binary[0], header.length)) {
+		misses++;
+		return false;
+	}
+
+	file.close();
+
+	unsigned int id = glCreateProgram();
+	glProgramBinary(id, header.format, &binary[0], (GLsizei) header.length);
+
+	int success;
+	glGetProgramiv(id, GL_LINK_STATUS, &success);
+
+	// Usually a driver update that kept its version string, rebuild it
+	if (!success) {
+		glDeleteProgram(id);
+		std::remove(path.c_str());
+		rejected++;
+		return false;
+	}
+
+	*program = id;
+	hits++;
+
+	size_t sourceBytes = 0;
+
+	for (int i = 0; i < count; i++)
+		sourceBytes += strlen(stages[i].source);
+
+	recordProgramBuild(id, sourceBytes, start, true);
+
+	return true;
+
+}
+
+void markProgramCacheable(unsigned int program) {
+
+	if (enabled)
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
+}
+
+void storeCachedProgram(const ShaderStage *stages, int count, unsigned int program) {
+
+	if (!enabled)
+		return;
+
+	int success, length = 0;
+
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+
+	if (!success || length <= 0 || (uint32_t) length > MAX_BINARY)
+		return;
+
+	std::vector<char> binary(length);
+	GLenum format = 0;
+	GLsizei written = 0;
+
+	glGetProgramBinary(program, length, &written, &format, &binary[0]);
+
+	if (written <= 0)
+		return;
+
+	uint64_t key = programKey(stages, count);
+
+	CacheHeader header;
+	memcpy(header.magic, "GLPB", 4);
+	header.version = CACHE_VERSION;
+	header.key = key;
+	header.format = format;
+	header.length = (uint32_t) written;
+
+	// Written next to the real file and renamed over it, so a run starting
+	// at the same time never reads half a binary
+	std::string path = cachePath(key);
+	std::string temporary = path + ".tmp";
+
+	std::ofstream file(temporary.c_str(), std::ios::binary);
+
+	if (!file.write((const char*) &header, sizeof(header)) || !file.write(&binary[0], written)) {
+		file.close();
+		std::remove(temporary.c_str());
+		return;
+	}
+
+	file.close();
+
+#ifdef _WIN32
+	std::remove(path.c_str());
+#endif
+
+	if (std::rename(temporary.c_str(), path.c_str()) == 0)
+		stored++;
+	else
+		std::remove(temporary.c_str());
+
+}
+
+void stopProgramCache() {
+
+	if (!enabled || hits + misses + rejected == 0)
+		return;
+
+	std::cout << "Program cache: " << hits << " loaded, " << misses << " compiled ("
+		<< stored << " stored), " << rejected << " rejected by the driver\n";
+
+	enabled = false;
+
+}
+
+static uint64_t programKey(const ShaderStage *stages, int count) {
+
+	uint64_t hash = driverKey;
+
+	for (int i = 0; i < count; i++) {
+		uint32_t type = stages[i].type;
+		hash = fnv1a64(hash, &type, sizeof(type));
+		hash = fnv1a64(hash, stages[i].source, strlen(stages[i].source) + 1);
+	}
+
+	return hash;
+
+}
+
+static std::string cachePath(uint64_t key) {
+
+	char name[32];
+	snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long) key);
+
+	return directory + "/" + name;
+
+}
@@ -0,0 +1,52 @@
+/*
+* Description: Keeps linked shader programs on disk as driver
+*		binaries (glGetProgramBinary), so later runs skip compiling
+*		and linking. Each program is stored under a hash of its
+*		stage sources and of GL_VENDOR, GL_RENDERER and GL_VERSION,
+*		so a different GPU or driver update never loads a binary
+*		built for something else. If the driver rejects a binary
+*		anyway, the file is dropped and the caller compiles from
+*		source like it always did.
+*
+*		Typical use:
+*			if (!loadCachedProgram(stages, 2, &program)) {
+*				... compile the shaders, create program ...
+*				markProgramCacheable(program);
+*				glLinkProgram(program);
+*				storeCachedProgram(stages, 2, program);
+*			}
+*
+*	Environment variables:
+*		APP_PROGRAM_CACHE	directory the binaries go in
+*					(program_cache by default),
+*					off to always compile
+*/
+
+#ifndef PROGRAM_CACHE_H
+#define PROGRAM_CACHE_H
+
+#include "GLCaps.h"
+
+struct ShaderStage {
+	unsigned int type;		// GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, ...
+	const char *source;
+};
+
+void startProgramCache(const GLCaps&);
+// Hashes the driver identity and creates the cache directory. Does
+// nothing (and every load misses) without program binary support
+
+bool loadCachedProgram(const ShaderStage*, int, unsigned int*);
+// Creates a linked program from the cached binary of these stages.
+// Returns false if there is none or the driver rejected it
+
+void markProgramCacheable(unsigned int);
+// Asks the driver to keep the binary around, call before linking
+
+void storeCachedProgram(const ShaderStage*, int, unsigned int);
+// Saves the binary of a linked program built from these stages
+
+void stopProgramCache();
+// Prints how often the cache was hit, if it was used at all
+
+#endif
@@ -0,0 +1,232 @@
+#include "ProgramReflection.h"
+
+// Including core libraries
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+#include <glad/glad.h>
+
+// By program, nodes stay put so references handed out stay valid
+static std::unordered_map<unsigned int, ProgramReflection> reflections;
+
+static std::string variableName(const char*);
+// The name without a trailing [0], so arrays are found by their name
+
+template <typename T>
+static bool byHash(const T &a, const T &b) {
+	return a.hash < b.hash;
+}
+
+template <typename T>
+static const T *findHash(const std::vector<T>&, uint32_t);
+// Binary search of a table sorted by hash
+
+static void checkCollisions(unsigned int, std::vector<std::pair<uint32_t, std::string> >&);
+// Warns about two names in one table hashing the same
+
+const ProgramReflection &reflectProgram(unsigned int program) {
+
+	std::unordered_map<unsigned int, ProgramReflection>::iterator found = reflections.find(program);
+
+	if (found != reflections.end())
+		return found->second;
+
+	ProgramReflection &reflection = reflections[program];
+	reflection.program = program;
+
+	// Only needed to name the culprits of a collision
+	std::vector<std::pair<uint32_t, std::string> > uniformNames, attributeNames, blockNames;
+
+	int count = 0, maxLength = 0;
+	glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+	glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+	std::vector<char> name(maxLength + 1);
+
+	for (int i = 0; i < count; i++) {
+
+		ReflectedUniform uniform;
+		int size = 0;
+		GLenum type = 0;
+
+		name[0] = '\0';
+		glGetActiveUniform(program, (GLuint) i, (GLsizei) name.size(), NULL, &size, &type, &name[0]);
+
+		std::string variable = variableName(&name[0]);
+
+		// Programs from SPIR-V can come without names, nothing to find
+		// those by
+		if (variable.empty())
+			continue;
+
+		uniform.hash = nameHash(variable.c_str());
+		uniform.type = type;
+		uniform.size = size;
+		uniform.location = glGetUniformLocation(program, &name[0]);
+
+		// Block layout, only meaningful for members of a block
+		GLuint index = (GLuint) i;
+		glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_BLOCK_INDEX, &uniform.block);
+		glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_OFFSET, &uniform.offset);
+		glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_ARRAY_STRIDE, &uniform.arrayStride);
+		glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_MATRIX_STRIDE, &uniform.matrixStride);
+
+		reflection.uniforms.push_back(uniform);
+		uniformNames.push_back(std::make_pair(uniform.hash, variable));
+
+	}
+
+	count = maxLength = 0;
+	glGetProgramiv(program, GL_ACTIVE_ATTRIBUTES, &count);
+	glGetProgramiv(program, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &maxLength);
+
+	name.assign(maxLength + 1, '\0');
+
+	for (int i = 0; i < count; i++) {
+
+		ReflectedAttribute attribute;
+		int size = 0;
+		GLenum type = 0;
+
+		name[0] = '\0';
+		glGetActiveAttrib(program, (GLuint) i, (GLsizei) name.size(), NULL, &size, &type, &name[0]);
+
+		std::string variable = variableName(&name[0]);
+
+		if (variable.empty())
+			continue;
+
+		attribute.hash = nameHash(variable.c_str());
+		attribute.type = type;
+		attribute.size = size;
+		attribute.location = glGetAttribLocation(program, &name[0]);
+
+		reflection.attributes.push_back(attribute);
+		attributeNames.push_back(std::make_pair(attribute.hash, variable));
+
+	}
+
+	count = maxLength = 0;
+	glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &count);
+	glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxLength);
+
+	name.assign(maxLength + 1, '\0');
+
+	for (int i = 0; i < count; i++) {
+
+		ReflectedBlock block;
+
+		name[0] = '\0';
+		glGetActiveUniformBlockName(program, (GLuint) i, (GLsizei) name.size(), NULL, &name[0]);
+
+		if (name[0] == '\0')
+			continue;
+
+		block.hash = nameHash(&name[0]);
+		block.index = i;
+		block.dataSize = 0;
+		glGetActiveUniformBlockiv(program, (GLuint) i, GL_UNIFORM_BLOCK_DATA_SIZE, &block.dataSize);
+
+		reflection.blocks.push_back(block);
+		blockNames.push_back(std::make_pair(block.hash, std::string(&name[0])));
+
+	}
+
+	std::sort(reflection.uniforms.begin(), reflection.uniforms.end(), byHash<ReflectedUniform>);
+	std::sort(reflection.attributes.begin(), reflection.attributes.end(), byHash<ReflectedAttribute>);
+	std::sort(reflection.blocks.begin(), reflection.blocks.end(), byHash<ReflectedBlock>);
+
+	checkCollisions(program, uniformNames);
+	checkCollisions(program, attributeNames);
+	checkCollisions(program, blockNames);
+
+	return reflection;
+
+}
+
+void forgetProgram(unsigned int program) {
+
+	reflections.erase(program);
+
+}
+
+int uniformLocation(const ProgramReflection &reflection, uint32_t hash) {
+
+	const ReflectedUniform *uniform = findHash(reflection.uniforms, hash);
+
+	return uniform != NULL ? uniform->location : -1;
+
+}
+
+const ReflectedUniform *findUniform(const ProgramReflection &reflection, uint32_t hash) {
+
+	return findHash(reflection.uniforms, hash);
+
+}
+
+int attributeLocation(const ProgramReflection &reflection, uint32_t hash) {
+
+	const ReflectedAttribute *attribute = findHash(reflection.attributes, hash);
+
+	return attribute != NULL ? attribute->location : -1;
+
+}
+
+const ReflectedBlock *findUniformBlock(const ProgramReflection &reflection, uint32_t hash) {
+
+	return findHash(reflection.blocks, hash);
+
+}
+
+void stopProgramReflection() {
+
+	reflections.clear();
+
+}
+
+static std::string variableName(const char *name) {
+
+	std::string variable = name;
+
+	if (variable.size() > 3 && variable.compare(variable.size() - 3, 3, "[0]") == 0)
+		variable.erase(variable.size() - 3);
+
+	return variable;
+
+}
+
+template <typename T>
+static const T *findHash(const std::vector<T> &table, uint32_t hash) {
+
+	size_t low = 0, high = table.size();
+
+	while (low < high) {
+
+		size_t middle = (low + high) / 2;
+
+		if (table[middle].hash < hash)
+			low = middle + 1;
+		else
+			high = middle;
+
+	}
+
+	return low < table.size() && table[low].hash == hash ? &table[low] : NULL;
+
+}
+
+static void checkCollisions(unsigned int program, std::vector<std::pair<uint32_t, std::string> > &names) {
+
+	std::sort(names.begin(), names.end());
+
+	for (size_t i = 1; i < names.size(); i++) {
+		if (names[i].first == names[i - 1].first) {
+			std::cout << names[i - 1].second << " and " << names[i].second << " in program " << program
+				<< " have the same hash, only one of them can be looked up!\n";
+		}
+	}
+
+}
@@ -0,0 +1,88 @@
+/*
+* Description: What a linked program exposes, read from the driver
+*		once (glGetActiveUniform, glGetActiveAttrib, uniform block
+*		queries) and kept in flat tables sorted by a hash of the
+*		names. Names are hashed at compile time with NAME_HASH, so
+*		finding a location is a binary search over a few integers:
+*		no glGetUniformLocation and no string work in the render
+*		loop.
+*
+*		The modules that build programs (ShaderQueue, the program
+*		cache, ShaderPermutations, MaterialSystem, ShaderPipeline)
+*		reflect them right after linking and forget them when
+*		they delete them, so looking one up never goes to the
+*		driver. Main thread only.
+*
+*		Typical use:
+*			const ProgramReflection &reflection = reflectProgram(program);
+*			int color = uniformLocation(reflection, NAME_HASH("color"));
+*			... every frame ...
+*			glUniform4f(color, ...);
+*/
+
+#ifndef PROGRAM_REFLECTION_H
+#define PROGRAM_REFLECTION_H
+
+#include <type_traits>
+#include <vector>
+#include <stdint.h>
+
+#include "Hash.h"
+
+struct ReflectedUniform {
+	uint32_t hash;		// nameHash of the name, without any [0]
+	int location;		// -1 for members of uniform blocks
+	unsigned int type;	// GL_FLOAT_VEC4, GL_SAMPLER_2D, ...
+	int size;		// Array length, 1 for everything else
+	int block;		// Uniform block index, -1 if not in one
+	int offset;		// Byte offset in the block, -1 if not in one
+	int arrayStride;	// Bytes between array elements in the block
+	int matrixStride;	// Bytes between matrix columns in the block
+};
+
+struct ReflectedAttribute {
+	uint32_t hash;
+	int location;
+	unsigned int type;
+	int size;
+};
+
+struct ReflectedBlock {
+	uint32_t hash;
+	int index;		// For glUniformBlockBinding
+	int dataSize;		// Bytes the buffer bound to it needs
+};
+
+struct ProgramReflection {
+	unsigned int program;
+	std::vector<ReflectedUniform> uniforms;		// Each sorted by hash
+	std::vector<ReflectedAttribute> attributes;
+	std::vector<ReflectedBlock> blocks;
+};
+
+// The hash of a string literal, always worked out by the compiler
+#define NAME_HASH(name) (std::integral_constant<uint32_t, nameHash(name)>::value)
+
+const ProgramReflection &reflectProgram(unsigned int);
+// The tables of a linked program, queried from the driver the first
+// time and kept until the program is forgotten
+
+void forgetProgram(unsigned int);
+// Drops the tables of a program that is about to be deleted
+
+int uniformLocation(const ProgramReflection&, uint32_t);
+// Location of the uniform with this name hash, -1 if there is none
+
+const ReflectedUniform *findUniform(const ProgramReflection&, uint32_t);
+// Everything known about the uniform, NULL if there is none
+
+int attributeLocation(const ProgramReflection&, uint32_t);
+// Location of the vertex attribute, -1 if there is none
+
+const ReflectedBlock *findUniformBlock(const ProgramReflection&, uint32_t);
+// The uniform block with this name hash, NULL if there is none
+
+void stopProgramReflection();
+// Forgets every program
+
+#endif
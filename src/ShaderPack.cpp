@@ -0,0 +1,244 @@
+#include "ShaderPack.h"
+#include "ShaderReload.h"
+#include "Hash.h"
+
+// Including core libraries
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+// The mapped pack, NULL until the first shader is asked for
+static const unsigned char *pack;
+static size_t packSize;
+
+// Set once opening it failed, so that is only reported once
+static bool packFailed;
+
+static bool openShaderPack();
+// Maps the pack and checks every entry stays inside it
+
+static bool validPack(const unsigned char*, size_t);
+// Whether the header fits this build and every offset, length and NUL
+// terminator is inside the file
+
+static void reportStalePack(const char*);
+// Prints the shaders in the shader directory edited after the pack was
+// written. Only their times are looked at, nothing is read
+
+static const unsigned char *mapPack(const char*, size_t&);
+// Maps the whole file read only, NULL if it can't be
+
+static void unmapPack(const unsigned char*, size_t);
+// Undoes mapPack
+
+const char *packedShader(const char *name) {
+
+	if (pack == NULL && (packFailed || !openShaderPack()))
+		return NULL;
+
+	const ShaderPackHeader *header = (const ShaderPackHeader*) pack;
+	const ShaderPackEntry *entries = (const ShaderPackEntry*) (pack + sizeof(ShaderPackHeader));
+
+	uint32_t hash = nameHash(name);
+	uint32_t low = 0, high = header->count;
+
+	while (low < high) {
+
+		uint32_t middle = low + (high - low) / 2;
+
+		if (entries[middle].hash < hash)
+			low = middle + 1;
+		else
+			high = middle;
+
+	}
+
+	// The tool refuses collisions, the name check catches a stale pack
+	if (low < header->count && entries[low].hash == hash && strcmp((const char*) pack + entries[low].name, name) == 0)
+		return (const char*) pack + entries[low].source;
+
+	std::cout << "The shader pack has no " << name << ", rerun tools/shader_pack.py!\n";
+
+	return NULL;
+
+}
+
+void closeShaderPack() {
+
+	if (pack != NULL)
+		unmapPack(pack, packSize);
+
+	pack = NULL;
+	packSize = 0;
+	packFailed = false;
+
+}
+
+static bool openShaderPack() {
+
+	const char *path = getenv("APP_SHADER_PACK");
+	std::string defaultPath = std::string(shaderDirectory()) + "/shaders.pack";
+
+	if (path == NULL || *path == '\0')
+		path = defaultPath.c_str();
+
+	size_t size = 0;
+	const unsigned char *data = mapPack(path, size);
+
+	if (data == NULL) {
+		std::cout << "Unable to open the shader pack " << path << ", run tools/shader_pack.py!\n";
+		packFailed = true;
+		return false;
+	}
+
+	if (!validPack(data, size)) {
+		std::cout << "The shader pack " << path << " is damaged or out of date, rerun tools/shader_pack.py!\n";
+		unmapPack(data, size);
+		packFailed = true;
+		return false;
+	}
+
+	pack = data;
+	packSize = size;
+
+	reportStalePack(path);
+
+	return true;
+
+}
+
+static bool validPack(const unsigned char *data, size_t size) {
+
+	if (size < sizeof(ShaderPackHeader))
+		return false;
+
+	const ShaderPackHeader *header = (const ShaderPackHeader*) data;
+
+	if (header->magic != SHADER_PACK_MAGIC || header->version != SHADER_PACK_VERSION)
+		return false;
+
+	if (header->count > (size - sizeof(ShaderPackHeader)) / sizeof(ShaderPackEntry))
+		return false;
+
+	const ShaderPackEntry *entries = (const ShaderPackEntry*) (data + sizeof(ShaderPackHeader));
+
+	for (uint32_t i = 0; i < header->count; i++) {
+
+		const ShaderPackEntry &entry = entries[i];
+
+		// Sorted, or the binary search misses entries
+		if (i > 0 && entries[i - 1].hash > entry.hash)
+			return false;
+
+		if (entry.name >= size || memchr(data + entry.name, '\0', size - entry.name) == NULL)
+			return false;
+
+		if (entry.source >= size || entry.length >= size - entry.source || data[entry.source + entry.length] != '\0')
+			return false;
+
+	}
+
+	return true;
+
+}
+
+static void reportStalePack(const char *path) {
+
+	struct stat packInfo;
+
+	if (stat(path, &packInfo) != 0)
+		return;
+
+	const ShaderPackHeader *header = (const ShaderPackHeader*) pack;
+	const ShaderPackEntry *entries = (const ShaderPackEntry*) (pack + sizeof(ShaderPackHeader));
+
+	for (uint32_t i = 0; i < header->count; i++) {
+
+		std::string source = std::string(shaderDirectory()) + "/" + ((const char*) pack + entries[i].name);
+		struct stat sourceInfo;
+
+		// A pack shipped without its sources is fine
+		if (stat(source.c_str(), &sourceInfo) == 0 && sourceInfo.st_mtime > packInfo.st_mtime)
+			std::cout << "The shader pack " << path << " is older than " << source << ", rerun tools/shader_pack.py!\n";
+
+	}
+
+}
+
+#ifdef _WIN32
+
+static const unsigned char *mapPack(const char *path, size_t &size) {
+
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+	if (file == INVALID_HANDLE_VALUE)
+		return NULL;
+
+	LARGE_INTEGER fileSize;
+	GetFileSizeEx(file, &fileSize);
+	size = (size_t) fileSize.QuadPart;
+
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+
+	if (mapping == NULL)
+		return NULL;
+
+	// The view keeps the mapping alive
+	const unsigned char *data = (const unsigned char*) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+
+	return data;
+
+}
+
+static void unmapPack(const unsigned char *data, size_t) {
+
+	UnmapViewOfFile(data);
+
+}
+
+#else
+
+static const unsigned char *mapPack(const char *path, size_t &size) {
+
+	int fd = open(path, O_RDONLY);
+
+	if (fd < 0)
+		return NULL;
+
+	struct stat info;
+
+	if (fstat(fd, &info) != 0 || info.st_size == 0) {
+		close(fd);
+		return NULL;
+	}
+
+	size = (size_t) info.st_size;
+
+	void *data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	return data != MAP_FAILED ? (const unsigned char*) data : NULL;
+
+}
+
+static void unmapPack(const unsigned char *data, size_t size) {
+
+	munmap((void*) data, size);
+
+}
+
+#endif
@@ -0,0 +1,58 @@
+/*
+* Description: The GLSL the demos build from source, preprocessed
+*		offline and packed into one file by tools/shader_pack.py
+*		(includes pasted in, comments, spaces and unused functions
+*		taken out, constant arithmetic folded). The pack is mapped
+*		into memory the first time a shader is asked for, and a
+*		shader is then a binary search of its hash: the source
+*		goes to glShaderSource straight from the mapping, no file
+*		read, no copy and no string put together at startup.
+*		Rerun the tool after editing a shader in shaders/; one
+*		edited after the pack was written is reported when the
+*		pack is opened.
+*
+*	File layout (all little endian):
+*		ShaderPackHeader
+*		count ShaderPackEntry, sorted by hash
+*		the names and sources, each NUL terminated
+*
+*		Typical use:
+*			const char *source = packedShader("BasicShader.frag");
+*			glShaderSource(shader, 1, &source, NULL);
+*
+*	Environment variables:
+*		APP_SHADER_PACK	the pack to load, shaders.pack in the
+*				shader directory by default
+*/
+
+#ifndef SHADER_PACK_H
+#define SHADER_PACK_H
+
+#include <stdint.h>
+
+const uint32_t SHADER_PACK_MAGIC = 0x50534C47;	// "GLSP"
+const uint32_t SHADER_PACK_VERSION = 1;
+
+struct ShaderPackHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t count;		// Entries right after the header
+	uint32_t reserved;
+};
+
+struct ShaderPackEntry {
+	uint32_t hash;		// nameHash of the name (see Hash.h)
+	uint32_t name;		// Offsets from the start of the file
+	uint32_t source;
+	uint32_t length;	// Of the source, without the NUL
+};
+
+const char *packedShader(const char*);
+// The source of the named shader (its path under shaders/), valid until
+// closeShaderPack. NULL if it isn't in the pack or there is no pack, the
+// reason was printed. Maps the pack on the first call
+
+void closeShaderPack();
+// Unmaps the pack, once nothing uses its sources anymore
+
+#endif
@@ -0,0 +1,317 @@
+#include "ShaderPermutations.h"
+#include "ShaderRegistry.h"
+#include "ProgramReflection.h"
+#include "ShaderTelemetry.h"
+#include "ShaderQueue.h"
+
+// Including core libraries
+#include <iostream>
+#include <cstdio>
+#include <cctype>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <utility>
+
+#include <glad/glad.h>
+
+// Feature masks are 32 bit
+const int MAX_FEATURES = 32;
+
+struct PermutationShader {
+	std::vector<std::pair<unsigned int, std::string> > stages;
+	std::vector<std::string> features;
+	std::vector<unsigned int> mentioned;	// Per stage, the features its source uses
+	std::unordered_map<unsigned int, unsigned int> programs;	// By feature mask, 0 if it failed
+	std::unordered_map<unsigned int, int> queued;	// By feature mask, shader queue handles not collected yet
+	std::vector<unsigned int> held;		// Registry stages of the built permutations
+	const char *family;			// Shader family it was declared under (ShaderTelemetry.h)
+};
+
+static std::vector<PermutationShader> shaders;
+
+static bool mentions(const std::string&, const std::string&);
+// Whether the source uses the key as a whole identifier
+
+static std::string withDefines(const PermutationShader&, size_t, unsigned int);
+// The stage's source with a #define for each enabled feature it uses
+
+static void permutationStages(const PermutationShader&, unsigned int, std::vector<std::string>*, std::vector<ShaderStage>*);
+// The sources of one permutation, and stages pointing at them
+
+static unsigned int collectQueued(PermutationShader&, unsigned int);
+// Moves a permutation the shader queue finished into the built ones and
+// returns its program, 0 if it failed
+
+static unsigned int buildPermutation(PermutationShader&, unsigned int);
+// Compiles and links one permutation, or loads it from the program cache.
+// Returns 0 if it didn't build
+
+int createPermutations(const ShaderStage *stages, int count, const char *const *features, int featureCount) {
+
+	PermutationShader shader;
+	shader.family = shaderFamily("permutations");
+
+	if (featureCount > MAX_FEATURES) {
+		std::cout << "Only " << MAX_FEATURES << " features per shader, ignoring the rest!\n";
+		featureCount = MAX_FEATURES;
+	}
+
+	for (int f = 0; f < featureCount; f++)
+		shader.features.push_back(features[f]);
+
+	for (int i = 0; i < count; i++) {
+
+		shader.stages.push_back(std::make_pair(stages[i].type, std::string(stages[i].source)));
+
+		unsigned int mentioned = 0;
+
+		for (int f = 0; f < featureCount; f++) {
+			if (mentions(shader.stages.back().second, shader.features[f]))
+				mentioned |= 1u << f;
+		}
+
+		shader.mentioned.push_back(mentioned);
+
+	}
+
+	shaders.push_back(shader);
+
+	return (int) shaders.size() - 1;
+
+}
+
+unsigned int permutationFeature(int handle, const char *name) {
+
+	const PermutationShader &shader = shaders[handle];
+
+	for (size_t f = 0; f < shader.features.size(); f++) {
+		if (shader.features[f] == name)
+			return 1u << f;
+	}
+
+	std::cout << "Unknown shader feature " << name << "!\n";
+
+	return 0;
+
+}
+
+unsigned int permutationProgram(int handle, unsigned int mask) {
+
+	PermutationShader &shader = shaders[handle];
+
+	std::unordered_map<unsigned int, unsigned int>::iterator it = shader.programs.find(mask);
+
+	if (it != shader.programs.end())
+		return it->second;
+
+	std::unordered_map<unsigned int, int>::iterator building = shader.queued.find(mask);
+
+	// Waiting on the background build beats building it a second time
+	if (building != shader.queued.end()) {
+
+		waitForProgram(building->second);
+		return collectQueued(shader, mask);
+
+	}
+
+	// Failures get remembered too, so a broken one only prints once.
+	// Built whenever it's first drawn, but counted where it was declared
+	const char *outer = setShaderFamily(shader.family);
+	unsigned int program = buildPermutation(shader, mask);
+	setShaderFamily(outer);
+
+	shader.programs[mask] = program;
+
+	return program;
+
+}
+
+void queuePermutation(int handle, unsigned int mask) {
+
+	PermutationShader &shader = shaders[handle];
+
+	if (shader.programs.count(mask) != 0 || shader.queued.count(mask) != 0)
+		return;
+
+	std::vector<std::string> sources;
+	std::vector<ShaderStage> stages;
+	permutationStages(shader, mask, &sources, &stages);
+
+	const char *outer = setShaderFamily(shader.family);
+	shader.queued[mask] = queueProgram(&stages[0], (int) stages.size());
+	setShaderFamily(outer);
+
+}
+
+unsigned int drawPermutation(int handle, unsigned int mask) {
+
+	PermutationShader &shader = shaders[handle];
+
+	std::unordered_map<unsigned int, unsigned int>::iterator it = shader.programs.find(mask);
+
+	if (it != shader.programs.end())
+		return it->second;
+
+	queuePermutation(handle, mask);
+
+	int building = shader.queued[mask];
+
+	if (programState(building) == PROGRAM_PENDING)
+		return programOrFallback(building);
+
+	return collectQueued(shader, mask);
+
+}
+
+void stopPermutations() {
+
+	size_t built = 0;
+	unsigned long long possible = 0;	// Up to 2^32 for one shader, too many for size_t on 32 bit
+
+	for (size_t i = 0; i < shaders.size(); i++) {
+
+		std::unordered_map<unsigned int, unsigned int>::iterator it;
+
+		for (it = shaders[i].programs.begin(); it != shaders[i].programs.end(); ++it) {
+			if (it->second != 0) {
+				forgetProgram(it->second);
+				glDeleteProgram(it->second);
+			}
+		}
+
+		std::unordered_map<unsigned int, int>::iterator building;
+
+		// Finished in the queue but never drawn with since. The queue
+		// leaves deleting its programs to whoever asked for them
+		for (building = shaders[i].queued.begin(); building != shaders[i].queued.end(); ++building) {
+
+			unsigned int program = queuedProgram(building->second);
+
+			if (program != 0) {
+				forgetProgram(program);
+				glDeleteProgram(program);
+			}
+
+		}
+
+		for (size_t s = 0; s < shaders[i].held.size(); s++)
+			releaseShader(shaders[i].held[s]);
+
+		built += shaders[i].programs.size() + shaders[i].queued.size();
+		possible += 1ull << shaders[i].features.size();
+
+	}
+
+	// Only worth saying when there were permutations to skip
+	if (built > 0 && possible > (unsigned long long) built)
+		std::cout << "Shader permutations: " << built << " of " << possible << " built\n";
+
+	shaders.clear();
+
+}
+
+static bool mentions(const std::string &source, const std::string &key) {
+
+	for (size_t at = source.find(key); at != std::string::npos; at = source.find(key, at + 1)) {
+
+		size_t end = at + key.size();
+
+		bool startsWord = at == 0 || !(isalnum((unsigned char) source[at - 1]) || source[at - 1] == '_');
+		bool endsWord = end == source.size() || !(isalnum((unsigned char) source[end]) || source[end] == '_');
+
+		if (startsWord && endsWord)
+			return true;
+
+	}
+
+	return false;
+
+}
+
+static std::string withDefines(const PermutationShader &shader, size_t stage, unsigned int mask) {
+
+	std::string defines;
+
+	for (size_t f = 0; f < shader.features.size(); f++) {
+		if ((mask & shader.mentioned[stage]) & (1u << f))
+			defines += "#define " + shader.features[f] + " 1\n";
+	}
+
+	return withPreamble(shader.stages[stage].second, defines);
+
+}
+
+static void permutationStages(const PermutationShader &shader, unsigned int mask, std::vector<std::string> *sources, std::vector<ShaderStage> *stages) {
+
+	sources->resize(shader.stages.size());
+	stages->resize(shader.stages.size());
+
+	for (size_t i = 0; i < shader.stages.size(); i++) {
+		(*sources)[i] = withDefines(shader, i, mask);
+		(*stages)[i].type = shader.stages[i].first;
+		(*stages)[i].source = (*sources)[i].c_str();
+	}
+
+}
+
+static unsigned int collectQueued(PermutationShader &shader, unsigned int mask) {
+
+	// The queue printed the log if it failed. Its stages stay held until
+	// the queue stops, so other permutations still share them
+	unsigned int program = queuedProgram(shader.queued[mask]);
+
+	shader.programs[mask] = program;
+	shader.queued.erase(mask);
+
+	return program;
+
+}
+
+static unsigned int buildPermutation(PermutationShader &shader, unsigned int mask) {
+
+	std::vector<std::string> sources;
+	std::vector<ShaderStage> stages;
+	permutationStages(shader, mask, &sources, &stages);
+
+	std::string label = "shader permutation";
+
+	for (size_t f = 0; f < shader.features.size(); f++) {
+		if (mask & (1u << f))
+			label += " " + shader.features[f];
+	}
+
+	// Stages no enabled feature touches are the same source every time,
+	// the registry compiles those once. Held until the end, so the next
+	// permutation finds them compiled
+	return buildLinkedProgram(&stages[0], (int) stages.size(), &shader.held, label.c_str());
+
+}
+
+std::string withPreamble(const std::string &source, const std::string &lines) {
+
+	if (lines.empty())
+		return source;
+
+	// After #version and any #extension lines, which have to come first
+	size_t at = 0;
+	int line = 1;
+
+	while (at < source.size() && (source.compare(at, 8, "#version") == 0 || source.compare(at, 10, "#extension") == 0)) {
+		size_t end = source.find('\n', at);
+		at = end == std::string::npos ? source.size() : end + 1;
+		line++;
+	}
+
+	std::string preamble = lines;
+
+	// A #version with nothing after it on the same line
+	if (at == source.size() && (source.empty() || source[source.size() - 1] != '\n'))
+		preamble = "\n" + preamble;
+
+	char directive[32];
+	snprintf(directive, sizeof(directive), "#line %d\n", line);
+
+	return source.substr(0, at) + preamble + directive + source.substr(at);
+
+}
@@ -0,0 +1,69 @@
+/*
+* Description: Shader permutations built on first use. A base shader
+*		is a set of stages plus the feature keys its sources
+*		check with #ifdef (HAS_COLOR, WIREFRAME, ...). Asking
+*		for a combination of features builds that permutation
+*		the first time, with a #define for every enabled key
+*		put in after the #version line, and hands back the same
+*		program after that. Combinations nobody asks for are
+*		never compiled, so startup only pays for what a scene
+*		actually draws with, however many features there are.
+*
+*		A stage only gets the defines for keys its source
+*		mentions, so stages a feature doesn't touch stay the
+*		same source and get shared through the shader registry
+*		(ShaderRegistry.h). Built permutations go through the
+*		program cache (ProgramCache.h) like everything else.
+*
+*		A render loop that mustn't stall asks drawPermutation
+*		instead of permutationProgram: the permutation gets built
+*		in the background by the shader queue and the fallback
+*		program draws in its place until it's done.
+*
+*		Typical use:
+*			const char *features[] = { "HAS_COLOR", "WIREFRAME" };
+*			int shader = createPermutations(stages, 2, features, 2);
+*			unsigned int wireframe = permutationFeature(shader, "WIREFRAME");
+*			glUseProgram(permutationProgram(shader, wireframe));
+*/
+
+#ifndef SHADER_PERMUTATIONS_H
+#define SHADER_PERMUTATIONS_H
+
+#include "ProgramCache.h"
+
+#include <string>
+
+int createPermutations(const ShaderStage*, int, const char *const*, int);
+// Declares a base shader from these stages and its feature keys (at most
+// 32) and returns its handle. The sources are copied, nothing is built
+
+unsigned int permutationFeature(int, const char*);
+// The bit of the named feature, to OR together into a combination.
+// Prints a warning and returns 0 for a key the shader didn't declare
+
+unsigned int permutationProgram(int, unsigned int);
+// The program for this combination of features, built the first time
+// it is asked for (or waited for, if it was queued). Returns 0 if it
+// didn't build, the log is printed once and later calls don't try again
+
+void queuePermutation(int, unsigned int);
+// Starts building this combination in the shader queue (ShaderQueue.h),
+// unless it is built or building already
+
+unsigned int drawPermutation(int, unsigned int);
+// The program to draw this combination with this frame, never waiting
+// on the compiler: the permutation once it's built, the queue's fallback
+// program while it builds (queued on the first call), 0 if it failed.
+// Counts as a draw waiting on it. Needs pollShaderQueue every frame
+
+void stopPermutations();
+// Deletes every built program and prints how many of the possible
+// permutations were built
+
+std::string withPreamble(const std::string&, const std::string&);
+// The source with the given lines (each ending in a newline) put in after
+// its #version and #extension lines, which have to come first. A #line
+// after them keeps the rest of the source at its own line numbers
+
+#endif
@@ -0,0 +1,153 @@
+#include "ShaderPipeline.h"
+#include "ProgramReflection.h"
+#include "ShaderTelemetry.h"
+
+// Including core libraries
+#include <iostream>
+#include <cstring>
+#include <unordered_map>
+
+#include <glad/glad.h>
+
+// Vertex, tessellation control, tessellation evaluation, geometry,
+// fragment and compute
+const int STAGE_COUNT = 6;
+
+struct PipelineStages {
+	unsigned int programs[STAGE_COUNT];
+};
+
+// What each pipeline made here has in its stages, by pipeline name
+static std::unordered_map<unsigned int, PipelineStages> pipelines;
+
+static int stageIndex(unsigned int);
+// Slot of the stage type in PipelineStages, -1 if unknown
+
+static unsigned int stageBit(unsigned int);
+// The GL_*_SHADER_BIT of the stage type
+
+unsigned int createStageProgram(unsigned int type, const char *source) {
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	// Compiles, marks separable and links in one go
+	unsigned int program = glCreateShaderProgramv(type, 1, &source);
+
+	int success = GL_FALSE;
+
+	if (program != 0)
+		glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+	if (!success) {
+
+		// The compile log ends up in the program's log
+		char log[512] = "";
+
+		if (program != 0) {
+			glGetProgramInfoLog(program, sizeof(log), NULL, log);
+			glDeleteProgram(program);
+		}
+
+		std::cout << "Unable to build separable stage program!\n" << log;
+
+		return 0;
+
+	}
+
+	// One call, so the compile counts as part of the link
+	const char *outer = setShaderFamily(shaderFamily("pipeline"));
+	recordProgramBuild(program, strlen(source), start, false);
+	setShaderFamily(outer);
+
+	reflectProgram(program);
+
+	return program;
+
+}
+
+unsigned int createPipeline() {
+
+	unsigned int pipeline;
+	glGenProgramPipelines(1, &pipeline);
+
+	PipelineStages &stages = pipelines[pipeline];
+
+	for (int i = 0; i < STAGE_COUNT; i++)
+		stages.programs[i] = 0;
+
+	return pipeline;
+
+}
+
+void bindPipeline(unsigned int pipeline) {
+
+	glBindProgramPipeline(pipeline);
+
+}
+
+void usePipelineStage(unsigned int pipeline, unsigned int type, unsigned int program) {
+
+	int index = stageIndex(type);
+
+	if (index < 0)
+		return;
+
+	std::unordered_map<unsigned int, PipelineStages>::iterator it = pipelines.find(pipeline);
+
+	// Drawing with one stage swapped only changes that stage
+	if (it != pipelines.end() && it->second.programs[index] == program)
+		return;
+
+	glUseProgramStages(pipeline, stageBit(type), program);
+
+	if (it != pipelines.end())
+		it->second.programs[index] = program;
+
+}
+
+void deletePipeline(unsigned int pipeline) {
+
+	glDeleteProgramPipelines(1, &pipeline);
+	pipelines.erase(pipeline);
+
+}
+
+void deleteStageProgram(unsigned int program) {
+
+	if (program == 0)
+		return;
+
+	forgetProgram(program);
+	glDeleteProgram(program);
+
+}
+
+static int stageIndex(unsigned int type) {
+
+	switch (type) {
+	case GL_VERTEX_SHADER: return 0;
+	case GL_TESS_CONTROL_SHADER: return 1;
+	case GL_TESS_EVALUATION_SHADER: return 2;
+	case GL_GEOMETRY_SHADER: return 3;
+	case GL_FRAGMENT_SHADER: return 4;
+	case GL_COMPUTE_SHADER: return 5;
+	}
+
+	return -1;
+
+}
+
+static unsigned int stageBit(unsigned int type) {
+
+	switch (type) {
+	case GL_VERTEX_SHADER: return GL_VERTEX_SHADER_BIT;
+	case GL_TESS_CONTROL_SHADER: return GL_TESS_CONTROL_SHADER_BIT;
+	case GL_TESS_EVALUATION_SHADER: return GL_TESS_EVALUATION_SHADER_BIT;
+	case GL_GEOMETRY_SHADER: return GL_GEOMETRY_SHADER_BIT;
+	case GL_FRAGMENT_SHADER: return GL_FRAGMENT_SHADER_BIT;
+	case GL_COMPUTE_SHADER: return GL_COMPUTE_SHADER_BIT;
+	}
+
+	return 0;
+
+}
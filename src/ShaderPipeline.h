@@ -0,0 +1,52 @@
+/*
+* Description: Separable shader programs (ARB_separate_shader_objects)
+*		combined per draw in a program pipeline. Every stage is
+*		built on its own with glCreateShaderProgramv and linked
+*		once, then glUseProgramStages plugs it into the pipeline,
+*		so V vertex and F fragment variants cost V + F links
+*		instead of the V * F a program per combination needs.
+*		Switching a single stage between draws also leaves the
+*		other stages of the pipeline alone.
+*
+*		Only available when app.caps.separateShaderObjects is
+*		set. Separable stages talk to each other by location or
+*		by matching names, like the stages of one program.
+*
+*		Typical use:
+*			unsigned int vertex = createStageProgram(GL_VERTEX_SHADER, source);
+*			unsigned int pipeline = createPipeline();
+*			bindPipeline(pipeline);
+*			usePipelineStage(pipeline, GL_VERTEX_SHADER, vertex);
+*			usePipelineStage(pipeline, GL_FRAGMENT_SHADER, fragment);
+*			glDrawElements(...);
+*			...
+*			deletePipeline(pipeline);
+*			deleteStageProgram(vertex);
+*/
+
+#ifndef SHADER_PIPELINE_H
+#define SHADER_PIPELINE_H
+
+unsigned int createStageProgram(unsigned int, const char*);
+// Compiles and links a separable program holding just this stage.
+// Prints the log and returns 0 if it didn't build
+
+unsigned int createPipeline();
+// Generates an empty program pipeline
+
+void bindPipeline(unsigned int);
+// Binds the pipeline for drawing. glUseProgram(0) has to come first if
+// a program was in use, an active program wins over the pipeline
+
+void usePipelineStage(unsigned int, unsigned int, unsigned int);
+// Puts the separable program in the given stage (GL_VERTEX_SHADER, ...)
+// of the pipeline. Skips the call if it is there already
+
+void deletePipeline(unsigned int);
+// Deletes the pipeline, not the programs in it
+
+void deleteStageProgram(unsigned int);
+// Deletes a program from createStageProgram and drops its reflection.
+// Ignores 0, so it can take whatever a failed build left
+
+#endif
@@ -0,0 +1,230 @@
+#include "ShaderPrewarm.h"
+#include "ShaderQueue.h"
+#include "StartupTimeline.h"
+
+// Including core libraries
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <chrono>
+
+#include <glad/glad.h>
+
+// Declared since the last pass
+static std::vector<WarmDraw> pending;
+
+// Every combination a pass got, so warmBeforeDraw only warms each once
+static std::vector<WarmDraw> done;
+
+// The 1x1 target, made on the first pass and kept for later ones
+static unsigned int framebuffer, colorBuffer;
+static bool targetFailed;
+
+// For the summary printed on exit
+static int passes, warmed;
+static double passMilliseconds, slowestDraw;
+
+static bool createTarget();
+// Makes the 1x1 RGBA8 framebuffer. Returns false if it isn't complete
+
+static bool sameDraw(const WarmDraw&, const WarmDraw&);
+// Whether both draw the same program, VAO and state
+
+static int primitiveVertices(unsigned int);
+// The fewest vertices that make one whole primitive
+
+bool prewarmEnabled() {
+
+	const char *wanted = getenv("APP_SHADER_PREWARM");
+
+	return wanted == NULL || strcmp(wanted, "off") != 0;
+
+}
+
+void addWarmDraw(const WarmDraw &draw) {
+
+	// Nothing to draw with yet, or a shader that failed
+	if (draw.program == 0 && draw.pipeline == 0)
+		return;
+
+	pending.push_back(draw);
+
+}
+
+bool warmBeforeDraw(AppContext *app, const WarmDraw &draw) {
+
+	if (!prewarmEnabled() || (draw.program == 0 && draw.pipeline == 0) || draw.program == fallbackProgram())
+		return false;
+
+	for (size_t i = 0; i < done.size(); i++) {
+		if (sameDraw(done[i], draw))
+			return false;
+	}
+
+	addWarmDraw(draw);
+
+	return prewarmShaders(app) > 0.0;
+
+}
+
+double prewarmShaders(AppContext *app) {
+
+	std::vector<WarmDraw> draws;
+	draws.swap(pending);
+
+	// Even when nothing gets drawn, so nothing asks again every frame
+	done.insert(done.end(), draws.begin(), draws.end());
+
+	if (draws.empty() || !prewarmEnabled() || app->platform == GLAD_PLATFORM_NULL)
+		return 0.0;
+
+	if (framebuffer == 0 && !targetFailed && !createTarget()) {
+		std::cout << "Unable to create the prewarm target, shaders warm up on screen!\n";
+		targetFailed = true;
+	}
+
+	if (targetFailed)
+		return 0.0;
+
+	// Only shows up in the timeline before the first frame is out
+	beginStartupPhase("prewarmShaders");
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	// Everything the draws change, to put back afterwards
+	int drawFramebuffer = 0, program = 0, pipeline = 0, vao = 0;
+	int viewport[4] = { 0, 0, 0, 0 };
+	int polygonMode[2] = { GL_FILL, GL_FILL };
+
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFramebuffer);
+	glGetIntegerv(GL_VIEWPORT, viewport);
+	glGetIntegerv(GL_CURRENT_PROGRAM, &program);
+	glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &vao);
+	glGetIntegerv(GL_POLYGON_MODE, polygonMode);
+
+	if (app->caps.separateShaderObjects)
+		glGetIntegerv(GL_PROGRAM_PIPELINE_BINDING, &pipeline);
+
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+	glViewport(0, 0, 1, 1);
+
+	for (size_t i = 0; i < draws.size(); i++) {
+
+		const WarmDraw &draw = draws[i];
+
+		glUseProgram(draw.program);
+
+		if (draw.program == 0)
+			glBindProgramPipeline(draw.pipeline);
+
+		glBindVertexArray(draw.vao);
+		glPolygonMode(GL_FRONT_AND_BACK, draw.polygonMode);
+
+		// The driver finishes the program for this state here
+		std::chrono::steady_clock::time_point drawStart = std::chrono::steady_clock::now();
+
+		if (draw.indexType == 0)
+			glDrawArrays(draw.primitive, 0, primitiveVertices(draw.primitive));
+		else
+			glDrawElements(draw.primitive, primitiveVertices(draw.primitive), draw.indexType, 0);
+
+		double drawMilliseconds = millisecondsSince(drawStart);
+
+		if (drawMilliseconds > slowestDraw)
+			slowestDraw = drawMilliseconds;
+
+	}
+
+	glPolygonMode(GL_FRONT_AND_BACK, polygonMode[0]);
+	glBindVertexArray(vao);
+	glUseProgram(program);
+
+	if (app->caps.separateShaderObjects)
+		glBindProgramPipeline(pipeline);
+
+	glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, drawFramebuffer);
+
+	// Drivers that compile on their own threads are done by now too
+	glFinish();
+
+	double milliseconds = millisecondsSince(start);
+	endStartupPhase();
+
+	passes++;
+	warmed += (int) draws.size();
+	passMilliseconds += milliseconds;
+
+	return milliseconds;
+
+}
+
+void stopShaderPrewarm() {
+
+	if (framebuffer != 0) {
+		glDeleteFramebuffers(1, &framebuffer);
+		glDeleteRenderbuffers(1, &colorBuffer);
+		framebuffer = colorBuffer = 0;
+	}
+
+	if (warmed > 0) {
+		std::cout << "Shader prewarm: " << warmed << " combinations in " << passes << (passes == 1 ? " pass, " : " passes, ")
+			<< passMilliseconds << " ms, slowest draw " << slowestDraw << " ms\n";
+	}
+
+	pending.clear();
+	done.clear();
+	targetFailed = false;
+	passes = warmed = 0;
+	passMilliseconds = slowestDraw = 0.0;
+
+}
+
+static bool createTarget() {
+
+	glGenRenderbuffers(1, &colorBuffer);
+	glBindRenderbuffer(GL_RENDERBUFFER, colorBuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, 1, 1);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	int drawFramebuffer = 0;
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFramebuffer);
+
+	glGenFramebuffers(1, &framebuffer);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+	glFramebufferRenderbuffer(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorBuffer);
+
+	bool complete = glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, drawFramebuffer);
+
+	if (!complete) {
+		glDeleteFramebuffers(1, &framebuffer);
+		glDeleteRenderbuffers(1, &colorBuffer);
+		framebuffer = colorBuffer = 0;
+	}
+
+	return complete;
+
+}
+
+static bool sameDraw(const WarmDraw &a, const WarmDraw &b) {
+
+	return a.program == b.program && a.pipeline == b.pipeline && a.vao == b.vao
+		&& a.primitive == b.primitive && a.indexType == b.indexType && a.polygonMode == b.polygonMode;
+
+}
+
+static int primitiveVertices(unsigned int primitive) {
+
+	switch (primitive) {
+	case GL_POINTS: return 1;
+	case GL_LINES: case GL_LINE_STRIP: case GL_LINE_LOOP: return 2;
+	case GL_LINES_ADJACENCY: case GL_LINE_STRIP_ADJACENCY: return 4;
+	case GL_TRIANGLES_ADJACENCY: case GL_TRIANGLE_STRIP_ADJACENCY: return 6;
+	}
+
+	return 3;
+
+}
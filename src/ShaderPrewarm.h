@@ -0,0 +1,73 @@
+/*
+* Description: Warms up shaders before the first visible frame. Many
+*		drivers only generate the final code for a program once
+*		it is drawn with, and again for every vertex layout and
+*		bit of state (polygon mode, ...) that changes it, so the
+*		first frames hitch even though every program linked long
+*		before. A scene declares each combination it is going to
+*		draw with, and the prewarm pass draws each of them once
+*		(one primitive) into a 1x1 offscreen target and waits
+*		for the GPU, before the render loop starts.
+*
+*		Programs still building in the shader queue can't be
+*		warmed up front, and waiting for them would keep the
+*		fallback program from ever drawing. Those are warmed
+*		the same way right before their first draw, the frame
+*		the queue delivers them (or a key press first asks for
+*		them), and never waited for.
+*
+*		The target is RGBA8 without depth, like the frame the
+*		demos draw into. Every bit of state the pass changes is
+*		put back afterwards. The draw is the scene's own VAO, so
+*		an indexed one needs its element buffer bound in the VAO
+*		with a primitive's worth of indices.
+*
+*		Typical use:
+*			WarmDraw warm = { program, 0, VAO, GL_TRIANGLES, 0, GL_FILL };
+*			addWarmDraw(warm);
+*			prewarmShaders(&app);
+*
+*			... or every frame, for a queued program
+*			warm.program = drawPermutation(shader, 0);
+*			warmBeforeDraw(&app, warm);
+*
+*	Environment variables:
+*		APP_SHADER_PREWARM	off to skip the pass, to see the
+*					hitches it takes away
+*/
+
+#ifndef SHADER_PREWARM_H
+#define SHADER_PREWARM_H
+
+#include "AppContext.h"
+
+struct WarmDraw {
+	unsigned int program;		// What to draw with, 0 for the pipeline
+	unsigned int pipeline;		// Bound with the stages it has at the time
+	unsigned int vao;		// The vertex layout
+	unsigned int primitive;		// GL_TRIANGLES, GL_LINES, ...
+	unsigned int indexType;		// GL_UNSIGNED_INT, ... or 0 to draw arrays
+	unsigned int polygonMode;	// GL_FILL, GL_LINE or GL_POINT
+};
+
+bool prewarmEnabled();
+// Whether the pass runs at all, so a scene can skip waiting on shaders
+// just to warm them
+
+void addWarmDraw(const WarmDraw&);
+// Declares a combination the scene draws with, for the next pass
+
+bool warmBeforeDraw(AppContext*, const WarmDraw&);
+// Warms one combination with a pass of its own, the first time the scene
+// is about to draw with it. Does nothing for combinations warmed already
+// and for the shader queue's fallback program. Returns whether it ran
+
+double prewarmShaders(AppContext*);
+// Draws every combination declared since the last pass once, waits for
+// the GPU and returns how long it took in milliseconds. Does nothing on
+// the null platform
+
+void stopShaderPrewarm();
+// Deletes the offscreen target and prints what the passes cost
+
+#endif
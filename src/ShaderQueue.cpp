@@ -0,0 +1,737 @@
+#include "ShaderQueue.h"
+#include "GLTrace.h"
+#include "ShaderRegistry.h"
+#include "ProgramReflection.h"
+#include "ShaderTelemetry.h"
+#include "ShaderPack.h"
+#include "SpirvShader.h"
+#include "StartupTimeline.h"
+
+// Including core libraries
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <deque>
+#include <utility>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <climits>
+
+#include <glad/glad.h>
+
+enum QueueMode {
+	MODE_PARALLEL,
+	MODE_THREAD,
+	MODE_INLINE
+};
+
+static const char *MODE_NAMES[] = { "parallel", "thread", "inline" };
+
+// Lets the driver use as many compiler threads as it likes
+const GLuint MAX_COMPILER_THREADS = 0xFFFFFFFF;
+
+// How long the worker waits on a fence at a time, in nanoseconds
+const GLuint64 FENCE_TIMEOUT = 1000000000;
+
+struct ShaderBuild {
+	std::vector<std::pair<unsigned int, std::string> > stages;
+	bool spirv;			// The stages are SPIR-V modules, not GLSL
+	std::vector<unsigned int> shaders;	// From the registry, held as long as the build
+	unsigned int program;
+	std::atomic<int> state;		// ProgramState, written by whoever builds it
+	bool finished;			// Stored in the cache or reported by the main thread
+	bool released;			// Its handle is free for the next build
+	std::string log;
+	const char *family;		// Shader family it was queued under (ShaderTelemetry.h)
+	std::chrono::steady_clock::time_point submitted;	// When the link was asked for
+	int waiting;			// Draws that fell back on it since the last poll
+	std::atomic<int> priority;	// Same for the frame before, what the next build is picked by
+	GLsync queuedAt;		// Fence after the main context's work up to queueing, thread mode only
+};
+
+static AppContext *app;
+static int mode;
+static std::vector<ShaderBuild*> builds;
+static std::vector<int> freeHandles;	// Released builds, taken again before builds grows
+
+// Worker thread, thread mode only
+static std::thread worker;
+static AppSharedContext sharedContext;
+static std::mutex jobsLock;
+static std::condition_variable jobsReady;
+static std::condition_variable buildDone;	// A build finished or the worker gave up
+static std::deque<ShaderBuild*> jobs;
+static bool stopping;
+static std::atomic<bool> workerFailed;
+
+// Drawn with in place of programs that aren't ready
+static unsigned int fallback;
+static std::vector<unsigned int> fallbackShaders;
+static bool fallbackTried;
+
+// For the summary printed on exit
+static int queued, fromCache, failed;
+static long fallbackDraws;
+static bool busy;
+static std::chrono::steady_clock::time_point busySince;
+static double busyMilliseconds;
+
+static int addBuild(ShaderBuild*);
+// Starts building it, or takes it from the program cache, and returns its
+// handle
+
+static void submitBuild(ShaderBuild*);
+// Compiles the stages that aren't yet and links the program, without
+// waiting for either
+
+static bool checkBuild(ShaderBuild*);
+// Reads the link status (waiting for it if the build isn't done yet)
+// and collects the logs when it failed
+
+static void buildFallback();
+// Links the fallback program from the shader pack, waiting for it
+
+static ShaderBuild *takeNextJob();
+// Takes the job the most draws waited on in the last frame out of the
+// worker's list, the oldest of those. Called with jobsLock held
+
+static const char *stageName(unsigned int);
+// "vertex", "fragment", ... for the logs
+
+static void workerLoop();
+// Builds queued programs on the shared context until stopped
+
+static void stopWorker();
+// Lets the worker finish its current build, joins it and drops its context
+
+static void deleteBuild(ShaderBuild*);
+// Drops the fence and the stages it still holds and deletes it. Not the
+// program, that belongs to whoever queued it
+
+void startShaderQueue(AppContext *context) {
+
+	app = context;
+	queued = fromCache = failed = 0;
+	fallbackDraws = 0;
+	busy = false;
+	busyMilliseconds = 0.0;
+
+	mode = app->caps.parallelShaderCompile ? MODE_PARALLEL
+		: app->platform == GLAD_PLATFORM_NULL ? MODE_INLINE
+		: MODE_THREAD;
+
+	const char *wanted = getenv("APP_SHADER_QUEUE");
+
+	if (wanted != NULL) {
+		if (strcmp(wanted, "inline") == 0)
+			mode = MODE_INLINE;
+		else if (strcmp(wanted, "thread") == 0 && app->platform != GLAD_PLATFORM_NULL)
+			mode = MODE_THREAD;
+	}
+
+	// Traces only know about one context, so keep every call on it
+	if (mode == MODE_THREAD && isTracing())
+		mode = MODE_INLINE;
+
+	if (mode == MODE_PARALLEL && glMaxShaderCompilerThreadsKHR != NULL)
+		glMaxShaderCompilerThreadsKHR(MAX_COMPILER_THREADS);
+
+}
+
+int queueProgram(const ShaderStage *stages, int count) {
+
+	ShaderBuild *build = new ShaderBuild();
+	build->spirv = false;
+
+	for (int i = 0; i < count; i++)
+		build->stages.push_back(std::make_pair(stages[i].type, std::string(stages[i].source)));
+
+	return addBuild(build);
+
+}
+
+int queueSpirvModules(const unsigned int *types, const std::string *modules, int count) {
+
+	ShaderBuild *build = new ShaderBuild();
+	build->spirv = true;
+
+	for (int i = 0; i < count; i++)
+		build->stages.push_back(std::make_pair(types[i], modules[i]));
+
+	return addBuild(build);
+
+}
+
+static int addBuild(ShaderBuild *build) {
+
+	build->program = 0;
+	build->state.store(PROGRAM_PENDING);
+	build->finished = false;
+	build->released = false;
+	build->family = shaderFamily("queue");
+	build->waiting = 0;
+	build->priority.store(0);
+	build->queuedAt = NULL;
+
+	int handle;
+
+	// Hot reloads queue a build every time, released ones make room
+	if (!freeHandles.empty()) {
+		handle = freeHandles.back();
+		freeHandles.pop_back();
+		deleteBuild(builds[handle]);
+		builds[handle] = build;
+	}
+	else {
+		handle = (int) builds.size();
+		builds.push_back(build);
+	}
+
+	queued++;
+
+	std::vector<ShaderStage> stages(build->stages.size());
+
+	for (size_t s = 0; s < stages.size(); s++) {
+		stages[s].type = build->stages[s].first;
+		stages[s].source = build->stages[s].second.c_str();
+	}
+
+	// Nothing to build at all when an earlier run left us the binary. The
+	// cache keys on source text, SPIR-V modules don't go in there
+	const char *outer = setShaderFamily(build->family);
+	bool cached = !build->spirv && loadCachedProgram(&stages[0], (int) stages.size(), &build->program);
+	setShaderFamily(outer);
+
+	if (cached) {
+		build->state.store(PROGRAM_READY);
+		build->finished = true;
+		fromCache++;
+		reflectProgram(build->program);
+		return handle;
+	}
+
+	// Something to draw with until this is done, made the first time
+	// anything has to wait
+	if (!fallbackTried)
+		buildFallback();
+
+	if (!busy) {
+		busy = true;
+		busySince = std::chrono::steady_clock::now();
+	}
+
+	if (mode == MODE_THREAD && !worker.joinable()) {
+
+		// Started on first use, most runs get everything from the cache
+		if (createAppSharedContext(app, &sharedContext)) {
+			stopping = false;
+			workerFailed.store(false);
+			worker = std::thread(workerLoop);
+		}
+		else {
+			std::cout << "Unable to create a shared context, building shaders inline\n";
+			mode = MODE_INLINE;
+		}
+
+	}
+
+	if (mode == MODE_PARALLEL) {
+		submitBuild(build);
+	}
+	else if (mode == MODE_THREAD) {
+
+		// Stages the registry has from this context may still be compiling
+		// here, the worker waits for this before attaching them
+		build->queuedAt = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		glFlush();
+
+		std::lock_guard<std::mutex> guard(jobsLock);
+		jobs.push_back(build);
+		jobsReady.notify_one();
+
+	}
+
+	return handle;
+
+}
+
+bool pollShaderQueue() {
+
+	// A worker that never got its context going leaves its jobs untouched
+	if (mode == MODE_THREAD && workerFailed.load()) {
+		std::cout << "The shader worker has no context, building shaders inline\n";
+		stopWorker();
+		jobs.clear();
+		mode = MODE_INLINE;
+	}
+
+	// The draws that fell back since the last poll decide what gets built
+	// next, inline here and on the worker thread
+	ShaderBuild *next = NULL;
+
+	for (size_t i = 0; i < builds.size(); i++) {
+
+		ShaderBuild *build = builds[i];
+
+		if (build->finished)
+			continue;
+
+		build->priority.store(build->waiting, std::memory_order_relaxed);
+		build->waiting = 0;
+
+		if (mode == MODE_INLINE && build->state.load() == PROGRAM_PENDING && (next == NULL || build->priority.load() > next->priority.load()))
+			next = build;
+
+	}
+
+	bool pending = false;
+
+	for (size_t i = 0; i < builds.size(); i++) {
+
+		ShaderBuild *build = builds[i];
+
+		if (build->finished)
+			continue;
+
+		if (build->state.load(std::memory_order_acquire) == PROGRAM_PENDING) {
+
+			if (mode == MODE_PARALLEL) {
+
+				int done = GL_FALSE;
+				glGetProgramiv(build->program, GL_COMPLETION_STATUS_KHR, &done);
+
+				if (done)
+					build->state.store(checkBuild(build) ? PROGRAM_READY : PROGRAM_FAILED);
+
+			}
+			else if (build == next) {
+
+				// One per poll, so a long list only costs a frame at a time
+				submitBuild(build);
+				build->state.store(checkBuild(build) ? PROGRAM_READY : PROGRAM_FAILED);
+
+			}
+
+		}
+
+		int state = build->state.load(std::memory_order_acquire);
+
+		if (state == PROGRAM_PENDING) {
+			pending = true;
+			continue;
+		}
+
+		if (state == PROGRAM_READY && build->spirv) {
+			reflectProgram(build->program);
+		}
+		else if (state == PROGRAM_READY) {
+
+			std::vector<ShaderStage> stages(build->stages.size());
+
+			for (size_t s = 0; s < stages.size(); s++) {
+				stages[s].type = build->stages[s].first;
+				stages[s].source = build->stages[s].second.c_str();
+			}
+
+			storeCachedProgram(&stages[0], (int) stages.size(), build->program);
+			reflectProgram(build->program);
+
+		}
+		else {
+
+			std::cout << "Unable to build shader program " << i << ":\n" << build->log;
+
+			glDeleteProgram(build->program);
+			build->program = 0;
+			failed++;
+
+		}
+
+		build->finished = true;
+
+	}
+
+	if (!pending && busy) {
+
+		busy = false;
+		busyMilliseconds += millisecondsSince(busySince);
+
+	}
+
+	return !pending;
+
+}
+
+void waitForProgram(int handle) {
+
+	ShaderBuild *build = builds[handle];
+
+	if (build->finished)
+		return;
+
+	if (mode == MODE_THREAD) {
+
+		// Next in line for the worker, then asleep until it says it's done
+		std::unique_lock<std::mutex> lock(jobsLock);
+		build->priority.store(INT_MAX, std::memory_order_relaxed);
+		buildDone.wait(lock, [build] { return build->state.load() != PROGRAM_PENDING || workerFailed.load(); });
+
+	}
+
+	// A worker that gave up leaves it to be built inline
+	if (mode == MODE_THREAD && workerFailed.load())
+		pollShaderQueue();
+
+	// The link status query waits for a parallel build to finish
+	if (mode != MODE_THREAD && build->state.load() == PROGRAM_PENDING) {
+
+		if (mode == MODE_INLINE)
+			submitBuild(build);
+
+		build->state.store(checkBuild(build) ? PROGRAM_READY : PROGRAM_FAILED);
+
+	}
+
+	pollShaderQueue();
+
+}
+
+int programState(int handle) {
+
+	ShaderBuild *build = builds[handle];
+
+	// Only done once the main thread has seen it finish
+	return build->finished ? build->state.load() : PROGRAM_PENDING;
+
+}
+
+unsigned int queuedProgram(int handle) {
+
+	ShaderBuild *build = builds[handle];
+
+	return build->finished && build->state.load() == PROGRAM_READY ? build->program : 0;
+
+}
+
+unsigned int programOrFallback(int handle) {
+
+	ShaderBuild *build = builds[handle];
+
+	if (build->finished)
+		return build->state.load() == PROGRAM_READY ? build->program : 0;
+
+	build->waiting++;
+	fallbackDraws++;
+
+	return fallback;
+
+}
+
+unsigned int fallbackProgram() {
+
+	return fallback;
+
+}
+
+void releaseQueuedProgram(int handle) {
+
+	ShaderBuild *build = builds[handle];
+
+	for (size_t s = 0; s < build->shaders.size(); s++)
+		releaseShader(build->shaders[s]);
+
+	build->shaders.clear();
+
+	// Nobody asks about it anymore, so the next build can have its handle
+	if (build->finished && !build->released) {
+		build->released = true;
+		freeHandles.push_back(handle);
+	}
+
+}
+
+void stopShaderQueue() {
+
+	if (app == NULL)
+		return;
+
+	stopWorker();
+
+	if (queued > 0) {
+
+		std::cout << "Shader queue (" << MODE_NAMES[mode] << "): " << queued << " programs, "
+			<< fromCache << " from the cache, " << failed << " failed";
+
+		if (busyMilliseconds > 0.0)
+			std::cout << ", " << busyMilliseconds << " ms from queueing until everything was ready";
+
+		if (fallbackDraws > 0)
+			std::cout << ", " << fallbackDraws << " draws with the fallback program";
+
+		std::cout << "\n";
+
+	}
+
+	for (size_t i = 0; i < builds.size(); i++)
+		deleteBuild(builds[i]);
+
+	builds.clear();
+	freeHandles.clear();
+
+	if (fallback != 0) {
+		forgetProgram(fallback);
+		glDeleteProgram(fallback);
+	}
+
+	for (size_t s = 0; s < fallbackShaders.size(); s++)
+		releaseShader(fallbackShaders[s]);
+
+	fallback = 0;
+	fallbackShaders.clear();
+	fallbackTried = false;
+
+	app = NULL;
+
+}
+
+static void submitBuild(ShaderBuild *build) {
+
+	const char *outer = setShaderFamily(build->family);
+
+	build->program = glCreateProgram();
+
+	// Stages another program already compiled come straight back
+	for (size_t i = 0; i < build->stages.size() && !build->spirv; i++) {
+		unsigned int shader = acquireShader(build->stages[i].first, build->stages[i].second.c_str());
+		build->shaders.push_back(shader);
+		glAttachShader(build->program, shader);
+	}
+
+	// Modules are only specialized, nothing to share. A shader deleted
+	// while attached lives as long as the program
+	bool specialized = true;
+
+	for (size_t i = 0; i < build->stages.size() && build->spirv && specialized; i++) {
+
+		unsigned int shader = createSpirvShader(build->stages[i].first, build->stages[i].second);
+		specialized = shader != 0;
+
+		if (specialized) {
+			glAttachShader(build->program, shader);
+			glDeleteShader(shader);
+		}
+
+	}
+
+	build->submitted = std::chrono::steady_clock::now();
+
+	if (!build->spirv)
+		markProgramCacheable(build->program);
+
+	// One the driver rejected has its log printed already. Never linked,
+	// the program reads as done and failed
+	if (specialized)
+		glLinkProgram(build->program);
+
+	setShaderFamily(outer);
+
+}
+
+static bool checkBuild(ShaderBuild *build) {
+
+	int success;
+	glGetProgramiv(build->program, GL_LINK_STATUS, &success);
+
+	if (success) {
+
+		size_t sourceBytes = 0;
+
+		for (size_t i = 0; i < build->stages.size(); i++)
+			sourceBytes += build->stages[i].second.size();
+
+		// In parallel mode this is when a poll saw it finish
+		const char *outer = setShaderFamily(build->family);
+		recordProgramBuild(build->program, sourceBytes, build->submitted, false);
+		setShaderFamily(outer);
+
+		return true;
+
+	}
+
+	char log[512];
+
+	// Say which stage broke, the link log alone often doesn't
+	for (size_t i = 0; i < build->shaders.size(); i++) {
+
+		unsigned int shader = build->shaders[i];
+		glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+
+		if (!success) {
+			glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+			build->log += std::string(stageName(build->stages[i].first)) + " shader: " + log;
+		}
+
+	}
+
+	log[0] = '\0';
+	glGetProgramInfoLog(build->program, sizeof(log), NULL, log);
+
+	// Empty for a program that never got to the link
+	if (log[0] != '\0')
+		build->log += std::string("link: ") + log + "\n";
+
+	return false;
+
+}
+
+static void buildFallback() {
+
+	fallbackTried = true;
+
+	const char *vertexShader = packedShader("Fallback.vert"), *fragmentShader = packedShader("Fallback.frag");
+
+	if (vertexShader == NULL || fragmentShader == NULL)
+		return;
+
+	ShaderStage stages[] = { { GL_VERTEX_SHADER, vertexShader }, { GL_FRAGMENT_SHADER, fragmentShader } };
+	const char *outer = setShaderFamily("fallback");
+
+	fallback = buildLinkedProgram(stages, 2, &fallbackShaders, "the fallback program");
+
+	if (fallback == 0)
+		std::cout << "Nothing draws until its own program is ready!\n";
+
+	setShaderFamily(outer);
+
+}
+
+static ShaderBuild *takeNextJob() {
+
+	std::deque<ShaderBuild*>::iterator next = jobs.begin();
+
+	for (std::deque<ShaderBuild*>::iterator it = jobs.begin(); it != jobs.end(); ++it) {
+		if ((*it)->priority.load(std::memory_order_relaxed) > (*next)->priority.load(std::memory_order_relaxed))
+			next = it;
+	}
+
+	ShaderBuild *build = *next;
+	jobs.erase(next);
+
+	return build;
+
+}
+
+static const char *stageName(unsigned int type) {
+
+	switch (type) {
+	case GL_VERTEX_SHADER: return "vertex";
+	case GL_FRAGMENT_SHADER: return "fragment";
+	case GL_GEOMETRY_SHADER: return "geometry";
+	case GL_TESS_CONTROL_SHADER: return "tessellation control";
+	case GL_TESS_EVALUATION_SHADER: return "tessellation evaluation";
+	case GL_COMPUTE_SHADER: return "compute";
+	}
+
+	return "unknown";
+
+}
+
+static void workerLoop() {
+
+	if (!appMakeSharedContextCurrent(app, &sharedContext)) {
+
+		{
+			std::lock_guard<std::mutex> guard(jobsLock);
+			workerFailed.store(true);
+		}
+
+		buildDone.notify_all();
+		return;
+
+	}
+
+	for (;;) {
+
+		ShaderBuild *build;
+
+		{
+			std::unique_lock<std::mutex> lock(jobsLock);
+
+			jobsReady.wait(lock, [] { return stopping || !jobs.empty(); });
+
+			if (jobs.empty())
+				break;
+
+			build = takeNextJob();
+		}
+
+		// Shared objects only show up finished in this context once the
+		// queueing context's fence has been waited on here
+		if (build->queuedAt != NULL) {
+
+			GLenum waited;
+
+			do
+				waited = glClientWaitSync(build->queuedAt, 0, FENCE_TIMEOUT);
+			while (waited == GL_TIMEOUT_EXPIRED);
+
+			glDeleteSync(build->queuedAt);
+			build->queuedAt = NULL;
+
+		}
+
+		submitBuild(build);
+		bool success = checkBuild(build);
+
+		// Programs are shared, but the main context only sees the finished
+		// result once this context is done with it
+		glFinish();
+
+		// Under the lock, so waitForProgram can't miss the wake up
+		{
+			std::lock_guard<std::mutex> guard(jobsLock);
+			build->state.store(success ? PROGRAM_READY : PROGRAM_FAILED, std::memory_order_release);
+		}
+
+		buildDone.notify_all();
+
+	}
+
+	appMakeSharedContextCurrent(app, NULL);
+
+}
+
+static void stopWorker() {
+
+	if (!worker.joinable())
+		return;
+
+	{
+		std::lock_guard<std::mutex> guard(jobsLock);
+		stopping = true;
+		jobs.clear();
+		jobsReady.notify_one();
+	}
+
+	worker.join();
+	destroyAppSharedContext(app, &sharedContext);
+
+}
+
+static void deleteBuild(ShaderBuild *build) {
+
+	// Left by a job the worker never got to
+	if (build->queuedAt != NULL)
+		glDeleteSync(build->queuedAt);
+
+	for (size_t s = 0; s < build->shaders.size(); s++)
+		releaseShader(build->shaders[s]);
+
+	delete build;
+
+}
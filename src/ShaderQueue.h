@@ -0,0 +1,106 @@
+/*
+* Description: Builds shader programs without stalling the render
+*		loop. Everything queued is submitted to the driver right
+*		away and the render loop polls once per frame to find out
+*		which programs are ready, drawing with the ones that are
+*		and skipping the rest. Compile and link status are only
+*		read once the driver says a program is finished, so no
+*		call ever waits on the compiler.
+*
+*		How programs get built depends on the driver:
+*		  parallel	KHR_parallel_shader_compile, compiles and
+*				links run on the driver's own threads and
+*				GL_COMPLETION_STATUS_KHR says when they're
+*				done
+*		  thread	a worker thread with a context sharing
+*				objects with the app's, which does the
+*				(blocking) building for us
+*		  inline	no way to build in the background (the
+*				null driver), each poll builds one program
+*
+*		Until a program is ready, a scene can draw with the
+*		fallback program instead (programOrFallback): a cheap
+*		one, linked up front, that puts attribute 0 where it is
+*		and fills it flat grey, so the geometry is on screen
+*		from the first frame and nothing waits on the compiler.
+*		Every such draw counts as waiting on its program, and
+*		the worker thread and the inline mode build whatever
+*		the most draws waited on in the last frame first (queue
+*		order between equals). In parallel mode the driver has
+*		everything at once and its threads pick the order.
+*
+*		Programs found in the program cache (ProgramCache.h) are
+*		ready as soon as they are queued, and programs the queue
+*		built are stored there. Stages come from the shader
+*		registry (ShaderRegistry.h) and stay compiled while the
+*		queue holds their programs, so later programs using the
+*		same stages don't compile them again.
+*
+*	Environment variables:
+*		APP_SHADER_QUEUE	parallel, thread or inline, to use
+*					that mode when it's available
+*/
+
+#ifndef SHADER_QUEUE_H
+#define SHADER_QUEUE_H
+
+#include "AppContext.h"
+#include "ProgramCache.h"
+
+#include <string>
+
+enum ProgramState {
+	PROGRAM_PENDING,	// Still compiling or linking
+	PROGRAM_READY,		// Linked, ready to use
+	PROGRAM_FAILED		// Didn't compile or link, the log was printed
+};
+
+void startShaderQueue(AppContext*);
+// Picks the build mode. The worker thread (if any) is only started once
+// it gets something to do
+
+int queueProgram(const ShaderStage*, int);
+// Starts building a program from the given stages and returns its
+// handle. The sources are copied
+
+int queueSpirvModules(const unsigned int*, const std::string*, int);
+// Same for a program from SPIR-V modules (SpirvShader.h), one stage type
+// and module each. These don't go through the program cache or the
+// shader registry
+
+bool pollShaderQueue();
+// Checks on every pending program without waiting on any of them. Call
+// once per frame. Returns true once nothing is pending anymore
+
+void waitForProgram(int);
+// Blocks until the program with the given handle is built and finishes
+// it like a poll would (then polls the rest). The worker thread takes it
+// next and signals when it's done, the other modes build or wait on it
+// right here. For programs needed now, not for the render loop
+
+int programState(int);
+// The ProgramState of the program with the given handle
+
+unsigned int queuedProgram(int);
+// The GL program of the given handle, 0 until it is ready
+
+unsigned int programOrFallback(int);
+// The program to draw with this frame: the queued one once it is ready,
+// the fallback program while it builds, 0 if it failed. Counts a draw
+// waiting on it, for the order things get built in
+
+unsigned int fallbackProgram();
+// The fallback program, built (or loaded from the program cache) the
+// first time something gets built in the background. 0 before that or
+// if it didn't build
+
+void releaseQueuedProgram(int);
+// Lets go of the stages of a finished program the caller has no more
+// use for. Deleting the program itself is up to the caller. The handle
+// goes to the next program queued, so hot reloads don't pile up builds
+
+void stopShaderQueue();
+// Stops the worker thread, deletes the fallback program and prints how
+// long building everything took
+
+#endif
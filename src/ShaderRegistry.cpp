@@ -0,0 +1,222 @@
+#include "ShaderRegistry.h"
+#include "ShaderTelemetry.h"
+#include "ProgramReflection.h"
+#include "Hash.h"
+
+// Including core libraries
+#include <iostream>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <chrono>
+#include <stdint.h>
+
+#include <glad/glad.h>
+
+struct RegisteredShader {
+	uint64_t hash;
+	unsigned int type;
+	std::string source;
+	unsigned int shader;
+	int references;
+};
+
+// Shaders by content hash, several per hash only on a collision
+typedef std::unordered_map<uint64_t, std::vector<RegisteredShader*> > ShadersByHash;
+typedef std::unordered_map<unsigned int, RegisteredShader*> ShadersByName;
+
+// Programs can be built on a worker thread (see ShaderQueue.h)
+static std::mutex registryLock;
+
+static ShadersByHash byHash;
+static ShadersByName byName;
+
+static long long requested, compiled;
+
+static uint64_t stageHash(unsigned int, const char*, size_t);
+// FNV-1a over the stage type and source (see Hash.h)
+
+unsigned int acquireShader(unsigned int type, const char *source) {
+
+	size_t length = strlen(source);
+	uint64_t hash = stageHash(type, source, length);
+
+	std::lock_guard<std::mutex> guard(registryLock);
+
+	requested++;
+
+	std::vector<RegisteredShader*> &candidates = byHash[hash];
+
+	for (size_t i = 0; i < candidates.size(); i++) {
+
+		RegisteredShader *entry = candidates[i];
+
+		if (entry->type == type && entry->source.size() == length && memcmp(entry->source.data(), source, length) == 0) {
+			entry->references++;
+			return entry->shader;
+		}
+
+	}
+
+	RegisteredShader *entry = new RegisteredShader();
+	entry->hash = hash;
+	entry->type = type;
+	entry->source.assign(source, length);
+	entry->references = 1;
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	entry->shader = glCreateShader(type);
+	glShaderSource(entry->shader, 1, &source, NULL);
+	glCompileShader(entry->shader);
+
+	recordShaderCompile(length, start);
+
+	candidates.push_back(entry);
+	byName[entry->shader] = entry;
+	compiled++;
+
+	return entry->shader;
+
+}
+
+void releaseShader(unsigned int shader) {
+
+	std::lock_guard<std::mutex> guard(registryLock);
+
+	ShadersByName::iterator it = byName.find(shader);
+
+	if (it == byName.end())
+		return;
+
+	RegisteredShader *entry = it->second;
+
+	if (--entry->references > 0)
+		return;
+
+	glDeleteShader(entry->shader);
+	byName.erase(it);
+
+	std::vector<RegisteredShader*> &candidates = byHash[entry->hash];
+
+	for (size_t i = 0; i < candidates.size(); i++) {
+		if (candidates[i] == entry) {
+			candidates.erase(candidates.begin() + i);
+			break;
+		}
+	}
+
+	if (candidates.empty())
+		byHash.erase(entry->hash);
+
+	delete entry;
+
+}
+
+unsigned int buildLinkedProgram(const ShaderStage *stages, int count, std::vector<unsigned int> *held, const char *label) {
+
+	unsigned int program;
+
+	if (loadCachedProgram(stages, count, &program)) {
+		reflectProgram(program);
+		return program;
+	}
+
+	program = glCreateProgram();
+
+	std::vector<unsigned int> shaders;
+	size_t sourceBytes = 0;
+
+	for (int i = 0; i < count; i++) {
+		shaders.push_back(acquireShader(stages[i].type, stages[i].source));
+		glAttachShader(program, shaders.back());
+		sourceBytes += strlen(stages[i].source);
+	}
+
+	// The registry times the compiles on their own
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	markProgramCacheable(program);
+	glLinkProgram(program);
+
+	int success;
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+	if (!success && label != NULL) {
+
+		char log[512];
+
+		std::cout << "Unable to build " << label << "!\n";
+
+		for (size_t i = 0; i < shaders.size(); i++) {
+
+			int compiled;
+			glGetShaderiv(shaders[i], GL_COMPILE_STATUS, &compiled);
+
+			if (!compiled) {
+				glGetShaderInfoLog(shaders[i], sizeof(log), NULL, log);
+				std::cout << log;
+			}
+
+		}
+
+		log[0] = '\0';
+		glGetProgramInfoLog(program, sizeof(log), NULL, log);
+		std::cout << log << "\n";
+
+	}
+
+	if (held != NULL) {
+		held->insert(held->end(), shaders.begin(), shaders.end());
+	}
+	else {
+		for (size_t i = 0; i < shaders.size(); i++)
+			releaseShader(shaders[i]);
+	}
+
+	if (!success) {
+		glDeleteProgram(program);
+		return 0;
+	}
+
+	recordProgramBuild(program, sourceBytes, start, false);
+
+	storeCachedProgram(stages, count, program);
+	reflectProgram(program);
+
+	return program;
+
+}
+
+void stopShaderRegistry() {
+
+	std::lock_guard<std::mutex> guard(registryLock);
+
+	for (ShadersByName::iterator it = byName.begin(); it != byName.end(); ++it) {
+		glDeleteShader(it->second->shader);
+		delete it->second;
+	}
+
+	byName.clear();
+	byHash.clear();
+
+	// Single program demos share nothing, no point in saying so
+	if (requested > compiled) {
+		std::cout << "Shader registry: " << requested << " stages requested, " << compiled << " compiled, "
+			<< (100 * (requested - compiled) / requested) << "% shared\n";
+	}
+
+	requested = compiled = 0;
+
+}
+
+static uint64_t stageHash(unsigned int type, const char *source, size_t length) {
+
+	uint32_t bits = type;
+	uint64_t hash = fnv1a64(FNV1A64_OFFSET, &bits, sizeof(bits));
+
+	return fnv1a64(hash, source, length);
+
+}
@@ -0,0 +1,46 @@
+/*
+* Description: Compiles every distinct shader stage once per run. Stages
+*		are looked up by a hash of their type and source (and the
+*		full source, so a collision can never hand out the wrong
+*		shader), and every program that uses a stage holds a
+*		reference to the one shader object. The object is deleted
+*		when the last reference goes. With thousands of materials
+*		built from a few dozen stages, this saves most of the
+*		compiles.
+*
+*		Callers still check GL_COMPILE_STATUS on what they get
+*		back; a stage that failed to compile stays failed for
+*		everyone sharing it.
+*
+*		buildLinkedProgram is the whole way from stages to a
+*		program for code that builds on the spot: the program
+*		cache, the registry's stages, the link, the logs, build
+*		telemetry and reflection.
+*/
+
+#ifndef SHADER_REGISTRY_H
+#define SHADER_REGISTRY_H
+
+#include "ProgramCache.h"
+
+#include <vector>
+
+unsigned int acquireShader(unsigned int, const char*);
+// Returns the shader object for this stage type and source, compiling it
+// if nobody holds it yet. The compile may still be running on return
+
+void releaseShader(unsigned int);
+// Drops one reference, the shader is deleted with the last one
+
+unsigned int buildLinkedProgram(const ShaderStage*, int, std::vector<unsigned int>*, const char*);
+// Loads the program of these stages from the program cache, or compiles
+// the stages through the registry and links them (waiting for it),
+// stores the binary and reflects it. The stages are added to the given
+// list, to release once nothing else needs them compiled (NULL releases
+// them right away). On failure prints "Unable to build <label>!" and the
+// logs, unless the label is NULL, and returns 0
+
+void stopShaderRegistry();
+// Deletes whatever is still held and prints how often stages were shared
+
+#endif
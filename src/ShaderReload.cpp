@@ -0,0 +1,341 @@
+#include "ShaderReload.h"
+#include "ShaderQueue.h"
+#include "ProgramReflection.h"
+
+// Including core libraries
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <map>
+#include <utility>
+#include <chrono>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/inotify.h>
+#endif
+
+#include <glad/glad.h>
+
+// How often modification times get checked without inotify
+const int POLL_MILLISECONDS = 250;
+
+struct WatchedProgram {
+	std::vector<std::pair<unsigned int, std::string> > files;
+	std::vector<time_t> modified;	// For checking without inotify
+	int current;			// Queue handle being drawn with, -1 before the first build
+	int pending;			// Queue handle still building, -1 if none
+	bool changed;			// A file changed since pending was queued
+	unsigned int program;
+};
+
+static std::vector<WatchedProgram> programs;
+
+#ifdef __linux__
+static int notifyFd = -1;
+static std::map<int, std::string> watchedDirectories;
+#endif
+
+static std::chrono::steady_clock::time_point lastCheck;
+
+static time_t modifiedTime(const std::string&);
+// When the file was last written, 0 if it's missing
+
+static bool queueWatched(WatchedProgram*);
+// Reads the current files and queues a build of them
+
+static std::string programName(const WatchedProgram&);
+// Its files, for messages
+
+static void watchDirectory(const std::string&);
+// Adds an inotify watch for the directory holding the given file
+
+static void detectChanges();
+// Marks every program with a changed file
+
+const char *shaderDirectory() {
+
+	const char *directory = getenv("APP_SHADER_DIR");
+
+	return directory != NULL && *directory != '\0' ? directory : "shaders";
+
+}
+
+bool readShaderFile(const std::string &path, std::string *contents) {
+
+	std::ifstream file(path.c_str(), std::ios::binary);
+
+	if (!file)
+		return false;
+
+	std::ostringstream stream;
+	stream << file.rdbuf();
+	*contents = stream.str();
+
+	return true;
+
+}
+
+int watchProgram(const ShaderFile *files, int count) {
+
+	WatchedProgram watched;
+	watched.current = watched.pending = -1;
+	watched.changed = false;
+	watched.program = 0;
+
+	for (int i = 0; i < count; i++) {
+		watched.files.push_back(std::make_pair(files[i].type, std::string(files[i].path)));
+		watched.modified.push_back(modifiedTime(files[i].path));
+	}
+
+	if (!queueWatched(&watched))
+		return -1;
+
+#ifdef __linux__
+	if (notifyFd < 0)
+		notifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+
+	for (int i = 0; i < count; i++)
+		watchDirectory(files[i].path);
+
+	lastCheck = std::chrono::steady_clock::now();
+
+	programs.push_back(watched);
+
+	return (int) programs.size() - 1;
+
+}
+
+void pollShaderReload() {
+
+	detectChanges();
+
+	for (size_t i = 0; i < programs.size(); i++) {
+
+		WatchedProgram &watched = programs[i];
+
+		if (watched.pending >= 0) {
+
+			int state = programState(watched.pending);
+
+			if (state == PROGRAM_PENDING)
+				continue;
+
+			if (state == PROGRAM_READY) {
+
+				// Swapped between frames, nothing ever draws with half of it
+				if (watched.current >= 0) {
+					forgetProgram(watched.program);
+					glDeleteProgram(watched.program);
+					releaseQueuedProgram(watched.current);
+					std::cout << "Reloaded " << programName(watched) << "\n";
+				}
+
+				watched.program = queuedProgram(watched.pending);
+				watched.current = watched.pending;
+
+			}
+			else {
+
+				// The queue printed why
+				if (watched.current >= 0)
+					std::cout << "Keeping the previous version of " << programName(watched) << "\n";
+
+				releaseQueuedProgram(watched.pending);
+
+			}
+
+			watched.pending = -1;
+
+		}
+
+		// Editors can leave a file missing for a moment while saving,
+		// the next poll tries again
+		if (watched.changed && queueWatched(&watched))
+			watched.changed = false;
+
+	}
+
+}
+
+unsigned int watchedProgram(int handle) {
+
+	return programs[handle].program;
+
+}
+
+unsigned int watchedProgramOrFallback(int handle) {
+
+	const WatchedProgram &watched = programs[handle];
+
+	// A reload keeps drawing with the version before it
+	if (watched.program != 0 || watched.pending < 0)
+		return watched.program;
+
+	return programOrFallback(watched.pending);
+
+}
+
+void stopShaderReload() {
+
+	for (size_t i = 0; i < programs.size(); i++) {
+
+		if (programs[i].current >= 0) {
+			forgetProgram(programs[i].program);
+			glDeleteProgram(programs[i].program);
+			releaseQueuedProgram(programs[i].current);
+		}
+
+	}
+
+	programs.clear();
+
+#ifdef __linux__
+	if (notifyFd >= 0) {
+		close(notifyFd);
+		notifyFd = -1;
+	}
+
+	watchedDirectories.clear();
+#endif
+
+}
+
+static time_t modifiedTime(const std::string &path) {
+
+	struct stat info;
+
+	return stat(path.c_str(), &info) == 0 ? info.st_mtime : 0;
+
+}
+
+static bool queueWatched(WatchedProgram *watched) {
+
+	// Still building the last change, queue this one once that's done
+	if (watched->pending >= 0) {
+		watched->changed = true;
+		return false;
+	}
+
+	std::vector<std::string> sources(watched->files.size());
+	std::vector<ShaderStage> stages(watched->files.size());
+
+	for (size_t i = 0; i < watched->files.size(); i++) {
+
+		if (!readShaderFile(watched->files[i].second, &sources[i])) {
+
+			// Only worth a message before there's anything to fall back on
+			if (watched->current < 0 && watched->pending < 0)
+				std::cout << "Unable to read " << watched->files[i].second << "!\n";
+
+			return false;
+
+		}
+
+		stages[i].type = watched->files[i].first;
+		stages[i].source = sources[i].c_str();
+
+	}
+
+	watched->pending = queueProgram(&stages[0], (int) stages.size());
+
+	return true;
+
+}
+
+static std::string programName(const WatchedProgram &watched) {
+
+	std::string name;
+
+	for (size_t i = 0; i < watched.files.size(); i++)
+		name += (i > 0 ? " + " : "") + watched.files[i].second;
+
+	return name;
+
+}
+
+static void watchDirectory(const std::string &path) {
+
+#ifdef __linux__
+	if (notifyFd < 0)
+		return;
+
+	size_t slash = path.find_last_of('/');
+	std::string directory = slash == std::string::npos ? "." : path.substr(0, slash);
+
+	// Watching the directory sees files being replaced, not just written
+	int watch = inotify_add_watch(notifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+
+	if (watch >= 0)
+		watchedDirectories[watch] = directory;
+#endif
+
+}
+
+static void detectChanges() {
+
+#ifdef __linux__
+	if (notifyFd >= 0) {
+
+		// Aligned the way the kernel writes the events
+		char buffer[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+		ssize_t length;
+
+		while ((length = read(notifyFd, buffer, sizeof(buffer))) > 0) {
+
+			for (char *at = buffer; at < buffer + length; ) {
+
+				const struct inotify_event *event = (const struct inotify_event*) at;
+				at += sizeof(struct inotify_event) + event->len;
+
+				if (event->len == 0)
+					continue;
+
+				std::string path = watchedDirectories[event->wd] + "/" + event->name;
+
+				for (size_t i = 0; i < programs.size(); i++) {
+					for (size_t f = 0; f < programs[i].files.size(); f++) {
+
+						const std::string &file = programs[i].files[f].second;
+
+						if (file == path || (file.find('/') == std::string::npos && "./" + file == path))
+							programs[i].changed = true;
+
+					}
+				}
+
+			}
+
+		}
+
+		return;
+
+	}
+#endif
+
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+	if (now - lastCheck < std::chrono::milliseconds(POLL_MILLISECONDS))
+		return;
+
+	lastCheck = now;
+
+	for (size_t i = 0; i < programs.size(); i++) {
+		for (size_t f = 0; f < programs[i].files.size(); f++) {
+
+			time_t modified = modifiedTime(programs[i].files[f].second);
+
+			if (modified != programs[i].modified[f]) {
+				programs[i].modified[f] = modified;
+				programs[i].changed = true;
+			}
+
+		}
+	}
+
+}
@@ -0,0 +1,59 @@
+/*
+* Description: Shader programs built from files on disk that rebuild
+*		themselves when a file changes. Changes are picked up
+*		with inotify on Linux (by watching the directories, so
+*		editors that save by renaming a new file over the old
+*		one work too) and by checking modification times a few
+*		times a second elsewhere. The rebuild goes through the
+*		shader queue (ShaderQueue.h), so it happens in the
+*		background, and the new program only replaces the old
+*		one between two frames once it linked. When it doesn't,
+*		the log is printed and the old program stays in use, so
+*		a typo never takes anything off the screen.
+*
+*		Typical use, once per frame:
+*			pollShaderQueue();
+*			pollShaderReload();
+*			glUseProgram(watchedProgram(handle));
+*
+*	Environment variables:
+*		APP_SHADER_DIR	where the demos look for their shader
+*				files (shaders by default)
+*/
+
+#ifndef SHADER_RELOAD_H
+#define SHADER_RELOAD_H
+
+#include <string>
+
+struct ShaderFile {
+	unsigned int type;		// GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, ...
+	const char *path;
+};
+
+const char *shaderDirectory();
+// APP_SHADER_DIR, or "shaders"
+
+bool readShaderFile(const std::string&, std::string*);
+// Reads a whole shader file, false if it can't be opened
+
+int watchProgram(const ShaderFile*, int);
+// Reads the files, queues the program and starts watching the files.
+// Returns the handle, or -1 if a file couldn't be read
+
+void pollShaderReload();
+// Requeues programs whose files changed and swaps in the ones that
+// finished building. Never waits, call once per frame after
+// pollShaderQueue
+
+unsigned int watchedProgram(int);
+// The program to draw with, 0 until the first build is ready
+
+unsigned int watchedProgramOrFallback(int);
+// Same, but the shader queue's fallback program while the first build
+// runs (see programOrFallback in ShaderQueue.h)
+
+void stopShaderReload();
+// Stops watching and deletes the programs
+
+#endif
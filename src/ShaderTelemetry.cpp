@@ -0,0 +1,513 @@
+#include "ShaderTelemetry.h"
+#include "GLIntercept.h"
+#include "StartupTimeline.h"
+
+// Including core libraries
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <cstdlib>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+// What gets timed, one row per family and step in the report
+enum TelemetryStep {
+	STEP_COMPILE,
+	STEP_LINK,
+	STEP_CACHE_LOAD,
+	STEP_FIRST_DRAW,
+	STEP_COUNT
+};
+
+static const char *STEP_NAMES[] = { "compile", "link", "cache load", "first draw" };
+
+// Prometheus metric of each step
+static const char *STEP_METRICS[] = {
+	"app_shader_compile_milliseconds",
+	"app_shader_link_milliseconds",
+	"app_shader_cache_load_milliseconds",
+	"app_shader_first_draw_milliseconds"
+};
+
+// Family of anything built without one, past the module defaults
+static const char *const UNNAMED_FAMILY = "unnamed";
+
+// Shader stages a pipeline can hold, one GL_*_SHADER_BIT each
+const int PIPELINE_STAGES = 6;
+
+struct ProgramRecord {
+	unsigned int program;
+	std::string family;
+	size_t sourceBytes;
+	double buildMilliseconds;	// Link or cache load
+	bool cached;
+	double firstDrawMilliseconds;	// Negative until drawn
+};
+
+struct FamilyRecord {
+	std::vector<double> samples[STEP_COUNT];
+	size_t sourceBytes;		// Of the compiled stages
+};
+
+static bool recording;
+static std::string reportPath, countersPath;
+
+static std::mutex recordsLock;
+static std::map<std::string, FamilyRecord> families;
+static std::vector<ProgramRecord> programs;
+
+// Programs still waiting for their first draw, to their record. Checked
+// on every draw, so the count spares the lock once all of them are in
+static std::unordered_map<unsigned int, size_t> undrawn;
+static std::atomic<size_t> undrawnCount;
+
+// Stage programs of every pipeline, as the app set them
+static std::unordered_map<unsigned int, std::vector<unsigned int> > pipelineStages;
+
+// What draws use on the calling thread's context
+static thread_local const char *currentFamily;
+static thread_local unsigned int boundProgram, boundPipeline;
+
+static void bind(int, GLuint);
+// Follows glUseProgram and glBindProgramPipeline
+
+static void bind(int, GLuint, GLbitfield, GLuint);
+// Follows glUseProgramStages
+
+template <typename... A>
+static void bind(int, A...) {}
+
+static bool firstDraw();
+// Whether the next draw is the first with any program it uses
+
+static void recordFirstDraw(std::chrono::steady_clock::time_point);
+// Times the draw for every program it used that hadn't drawn yet
+
+static double percentile(std::vector<double>&, double);
+// Nearest rank, sorts the samples
+
+static void writeReport();
+// The per family table and every program, to reportPath
+
+static void writeCounters();
+// A summary per family and step, to countersPath
+
+static std::string label(const std::string&);
+// The family as a Prometheus label value, quoted and escaped
+
+struct TelemetryHook {
+
+	// Zero when the call isn't a first draw
+	typedef std::chrono::steady_clock::time_point Call;
+
+	template <typename... A>
+	static Call before(int op, A... args) {
+
+		if (!recording)
+			return Call();
+
+		if (op == GL_OP_UseProgram || op == GL_OP_BindProgramPipeline || op == GL_OP_UseProgramStages) {
+			bind(op, args...);
+			return Call();
+		}
+
+		return firstDraw() ? std::chrono::steady_clock::now() : Call();
+
+	}
+
+	template <typename R, typename... A>
+	static void after(Call &start, int, R*, A...) {
+		if (start != Call())
+			recordFirstDraw(start);
+	}
+
+};
+
+// Everything a program gets bound or drawn with
+#define TELEMETRY_HOOKS(HOOK) \
+	HOOK(UseProgram, PFNGLUSEPROGRAMPROC) \
+	HOOK(BindProgramPipeline, PFNGLBINDPROGRAMPIPELINEPROC) \
+	HOOK(UseProgramStages, PFNGLUSEPROGRAMSTAGESPROC) \
+	HOOK(DrawArrays, PFNGLDRAWARRAYSPROC) \
+	HOOK(DrawElements, PFNGLDRAWELEMENTSPROC) \
+	HOOK(DrawRangeElements, PFNGLDRAWRANGEELEMENTSPROC) \
+	HOOK(MultiDrawArrays, PFNGLMULTIDRAWARRAYSPROC) \
+	HOOK(MultiDrawElements, PFNGLMULTIDRAWELEMENTSPROC) \
+	HOOK(DrawArraysInstanced, PFNGLDRAWARRAYSINSTANCEDPROC) \
+	HOOK(DrawElementsInstanced, PFNGLDRAWELEMENTSINSTANCEDPROC) \
+	HOOK(DrawElementsBaseVertex, PFNGLDRAWELEMENTSBASEVERTEXPROC) \
+	HOOK(DrawRangeElementsBaseVertex, PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) \
+	HOOK(DrawElementsInstancedBaseVertex, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) \
+	HOOK(MultiDrawElementsBaseVertex, PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) \
+	HOOK(DrawArraysIndirect, PFNGLDRAWARRAYSINDIRECTPROC) \
+	HOOK(DrawElementsIndirect, PFNGLDRAWELEMENTSINDIRECTPROC) \
+	HOOK(DrawArraysInstancedBaseInstance, PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC) \
+	HOOK(DrawElementsInstancedBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC) \
+	HOOK(DrawElementsInstancedBaseVertexBaseInstance, PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC) \
+	HOOK(MultiDrawArraysIndirect, PFNGLMULTIDRAWARRAYSINDIRECTPROC) \
+	HOOK(MultiDrawElementsIndirect, PFNGLMULTIDRAWELEMENTSINDIRECTPROC) \
+	HOOK(MultiDrawArraysIndirectCount, PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC) \
+	HOOK(MultiDrawElementsIndirectCount, PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)
+
+#define INSTALL_HOOK(name, pfn) installGLIntercept<TelemetryHook, GL_OP_##name, pfn>();
+#define REMOVE_HOOK(name, pfn) removeGLIntercept<TelemetryHook, GL_OP_##name, pfn>();
+
+void startShaderTelemetry() {
+
+	const char *report = getenv("APP_SHADER_TELEMETRY");
+	const char *counters = getenv("APP_SHADER_COUNTERS");
+
+	reportPath = report != NULL ? report : "";
+	countersPath = counters != NULL ? counters : "";
+
+	if (reportPath.empty() && countersPath.empty())
+		return;
+
+	recording = true;
+	undrawnCount.store(0);
+
+	TELEMETRY_HOOKS(INSTALL_HOOK)
+
+}
+
+const char *setShaderFamily(const char *family) {
+
+	const char *previous = currentFamily;
+	currentFamily = family;
+
+	return previous;
+
+}
+
+const char *shaderFamily(const char *fallback) {
+
+	return currentFamily != NULL ? currentFamily : fallback;
+
+}
+
+void recordShaderCompile(size_t sourceBytes, std::chrono::steady_clock::time_point start) {
+
+	if (!recording)
+		return;
+
+	double milliseconds = millisecondsSince(start);
+
+	std::lock_guard<std::mutex> guard(recordsLock);
+
+	FamilyRecord &family = families[shaderFamily(UNNAMED_FAMILY)];
+	family.samples[STEP_COMPILE].push_back(milliseconds);
+	family.sourceBytes += sourceBytes;
+
+}
+
+void recordProgramBuild(unsigned int program, size_t sourceBytes, std::chrono::steady_clock::time_point start, bool cached) {
+
+	if (!recording)
+		return;
+
+	ProgramRecord record;
+	record.program = program;
+	record.family = shaderFamily(UNNAMED_FAMILY);
+	record.sourceBytes = sourceBytes;
+	record.buildMilliseconds = millisecondsSince(start);
+	record.cached = cached;
+	record.firstDrawMilliseconds = -1.0;
+
+	std::lock_guard<std::mutex> guard(recordsLock);
+
+	families[record.family].samples[cached ? STEP_CACHE_LOAD : STEP_LINK].push_back(record.buildMilliseconds);
+
+	// A rebuilt program (hot reload, or a reused name) starts over
+	undrawn[program] = programs.size();
+	undrawnCount.store(undrawn.size());
+
+	programs.push_back(record);
+
+}
+
+void stopShaderTelemetry() {
+
+	if (!recording)
+		return;
+
+	TELEMETRY_HOOKS(REMOVE_HOOK)
+
+	std::lock_guard<std::mutex> guard(recordsLock);
+
+	// Wrappers another hook still calls into see this
+	recording = false;
+
+	if (!reportPath.empty())
+		writeReport();
+
+	if (!countersPath.empty())
+		writeCounters();
+
+	size_t compiles = 0, cached = 0;
+	const ProgramRecord *slowest = NULL;
+
+	for (std::map<std::string, FamilyRecord>::iterator it = families.begin(); it != families.end(); ++it)
+		compiles += it->second.samples[STEP_COMPILE].size();
+
+	for (size_t i = 0; i < programs.size(); i++) {
+
+		if (programs[i].cached)
+			cached++;
+
+		if (slowest == NULL || programs[i].firstDrawMilliseconds > slowest->firstDrawMilliseconds)
+			slowest = &programs[i];
+
+	}
+
+	std::cout << "Shader telemetry: " << compiles << " compiles, " << programs.size() << " programs ("
+		<< cached << " from the cache)";
+
+	if (slowest != NULL && slowest->firstDrawMilliseconds >= 0.0)
+		std::cout << ", slowest first draw " << slowest->firstDrawMilliseconds << " ms (" << slowest->family << ")";
+
+	std::cout << "\n";
+
+	families.clear();
+	programs.clear();
+	undrawn.clear();
+	undrawnCount.store(0);
+	pipelineStages.clear();
+
+}
+
+static void bind(int op, GLuint name) {
+
+	if (op == GL_OP_UseProgram)
+		boundProgram = name;
+	else if (op == GL_OP_BindProgramPipeline)
+		boundPipeline = name;
+
+}
+
+static void bind(int op, GLuint pipeline, GLbitfield stages, GLuint program) {
+
+	if (op != GL_OP_UseProgramStages)
+		return;
+
+	std::lock_guard<std::mutex> guard(recordsLock);
+
+	std::vector<unsigned int> &stagePrograms = pipelineStages[pipeline];
+	stagePrograms.resize(PIPELINE_STAGES, 0);
+
+	for (int i = 0; i < PIPELINE_STAGES; i++) {
+		if (stages & (1u << i))
+			stagePrograms[i] = program;
+	}
+
+}
+
+static bool firstDraw() {
+
+	if (undrawnCount.load(std::memory_order_relaxed) == 0)
+		return false;
+
+	std::lock_guard<std::mutex> guard(recordsLock);
+
+	// A bound program wins over a bound pipeline
+	if (boundProgram != 0)
+		return undrawn.count(boundProgram) > 0;
+
+	std::unordered_map<unsigned int, std::vector<unsigned int> >::iterator stages = pipelineStages.find(boundPipeline);
+
+	if (boundPipeline == 0 || stages == pipelineStages.end())
+		return false;
+
+	for (size_t i = 0; i < stages->second.size(); i++) {
+		if (undrawn.count(stages->second[i]) > 0)
+			return true;
+	}
+
+	return false;
+
+}
+
+static void recordFirstDraw(std::chrono::steady_clock::time_point start) {
+
+	double milliseconds = millisecondsSince(start);
+
+	std::lock_guard<std::mutex> guard(recordsLock);
+
+	std::vector<unsigned int> used;
+
+	if (boundProgram != 0)
+		used.push_back(boundProgram);
+	else if (pipelineStages.count(boundPipeline) > 0)
+		used = pipelineStages[boundPipeline];
+
+	// Each stage program of a pipeline gets the whole draw, there is
+	// no telling which of them the driver spent it on
+	for (size_t i = 0; i < used.size(); i++) {
+
+		std::unordered_map<unsigned int, size_t>::iterator found = undrawn.find(used[i]);
+
+		if (found == undrawn.end())
+			continue;
+
+		ProgramRecord &record = programs[found->second];
+		record.firstDrawMilliseconds = milliseconds;
+		families[record.family].samples[STEP_FIRST_DRAW].push_back(milliseconds);
+
+		undrawn.erase(found);
+
+	}
+
+	undrawnCount.store(undrawn.size());
+
+}
+
+static double percentile(std::vector<double> &samples, double fraction) {
+
+	if (samples.empty())
+		return 0.0;
+
+	std::sort(samples.begin(), samples.end());
+
+	size_t rank = (size_t) std::ceil(fraction * samples.size());
+
+	return samples[rank > 0 ? rank - 1 : 0];
+
+}
+
+static void writeReport() {
+
+	std::ofstream report(reportPath.c_str());
+
+	if (!report) {
+		std::cout << "Unable to create " << reportPath << "!\n";
+		return;
+	}
+
+	report << std::fixed << std::setprecision(3);
+
+	report << "Shader build times per family (ms)\n";
+	report << std::left << std::setw(24) << "family" << std::setw(12) << "step" << std::right
+		<< std::setw(8) << "count" << std::setw(10) << "p50" << std::setw(10) << "p99"
+		<< std::setw(10) << "max" << std::setw(12) << "total" << "\n";
+
+	for (std::map<std::string, FamilyRecord>::iterator it = families.begin(); it != families.end(); ++it) {
+
+		for (int step = 0; step < STEP_COUNT; step++) {
+
+			std::vector<double> &samples = it->second.samples[step];
+
+			if (samples.empty())
+				continue;
+
+			double total = 0.0;
+
+			for (size_t i = 0; i < samples.size(); i++)
+				total += samples[i];
+
+			double median = percentile(samples, 0.5);
+			double tail = percentile(samples, 0.99);
+
+			report << std::left << std::setw(24) << it->first << std::setw(12) << STEP_NAMES[step] << std::right
+				<< std::setw(8) << samples.size() << std::setw(10) << median << std::setw(10) << tail
+				<< std::setw(10) << samples.back() << std::setw(12) << total << "\n";
+
+		}
+
+	}
+
+	// In build order, so a first draw that hitched is easy to place
+	report << "\nPrograms (ms, source in bytes)\n";
+	report << std::right << std::setw(8) << "program" << "  " << std::left << std::setw(24) << "family"
+		<< std::setw(12) << "built by" << std::right << std::setw(10) << "source"
+		<< std::setw(10) << "build" << std::setw(12) << "first draw" << "\n";
+
+	for (size_t i = 0; i < programs.size(); i++) {
+
+		const ProgramRecord &record = programs[i];
+
+		report << std::right << std::setw(8) << record.program << "  " << std::left << std::setw(24) << record.family
+			<< std::setw(12) << (record.cached ? "cache" : "link") << std::right
+			<< std::setw(10) << record.sourceBytes << std::setw(10) << record.buildMilliseconds;
+
+		if (record.firstDrawMilliseconds >= 0.0)
+			report << std::setw(12) << record.firstDrawMilliseconds << "\n";
+		else
+			report << std::setw(12) << "never" << "\n";
+
+	}
+
+}
+
+static void writeCounters() {
+
+	std::ofstream counters(countersPath.c_str());
+
+	if (!counters) {
+		std::cout << "Unable to create " << countersPath << "!\n";
+		return;
+	}
+
+	for (int step = 0; step < STEP_COUNT; step++) {
+
+		const char *metric = STEP_METRICS[step];
+
+		counters << "# HELP " << metric << " Shader " << STEP_NAMES[step] << " time per family\n";
+		counters << "# TYPE " << metric << " summary\n";
+
+		for (std::map<std::string, FamilyRecord>::iterator it = families.begin(); it != families.end(); ++it) {
+
+			std::vector<double> &samples = it->second.samples[step];
+
+			if (samples.empty())
+				continue;
+
+			std::string family = label(it->first);
+			double total = 0.0;
+
+			for (size_t i = 0; i < samples.size(); i++)
+				total += samples[i];
+
+			double median = percentile(samples, 0.5);
+			double tail = percentile(samples, 0.99);
+
+			counters << metric << "{family=" << family << ",quantile=\"0.5\"} " << median << "\n";
+			counters << metric << "{family=" << family << ",quantile=\"0.99\"} " << tail << "\n";
+			counters << metric << "_sum{family=" << family << "} " << total << "\n";
+			counters << metric << "_count{family=" << family << "} " << samples.size() << "\n";
+
+		}
+
+	}
+
+	counters << "# HELP app_shader_source_bytes_total Shader source compiled per family\n";
+	counters << "# TYPE app_shader_source_bytes_total counter\n";
+
+	for (std::map<std::string, FamilyRecord>::iterator it = families.begin(); it != families.end(); ++it)
+		counters << "app_shader_source_bytes_total{family=" << label(it->first) << "} " << it->second.sourceBytes << "\n";
+
+}
+
+static std::string label(const std::string &family) {
+
+	std::string value = "\"";
+
+	for (size_t i = 0; i < family.size(); i++) {
+
+		if (family[i] == '\\' || family[i] == '"')
+			value += '\\';
+
+		if (family[i] == '\n')
+			value += "\\n";
+		else
+			value += family[i];
+
+	}
+
+	return value + "\"";
+
+}
@@ -0,0 +1,65 @@
+/*
+* Description: Where shader build time goes, per program and per shader
+*		family. Every stage compile, every program link (or load
+*		from the program cache) and the first draw with every
+*		program get timed, along with how much source went in.
+*		On exit the numbers are written as a report, p50 and p99
+*		per family and every program on its own line, and as
+*		counters in the Prometheus text format, for a scraper
+*		(node_exporter's textfile collector, say) to pick up.
+*
+*		A family is a name for a set of related shaders, Basic or
+*		DifferentShaders say. setShaderFamily names the family of
+*		whatever the calling thread builds, queues or declares
+*		next; the modules that build later (the shader queue,
+*		permutations, materials) remember the family they were
+*		handed the work under. Anything built without one counts
+*		under the module that built it.
+*
+*		Compiles and links are wall time on the thread that runs
+*		them. In the shader queue's parallel mode the compile calls
+*		return at once, so its link times run from submitting the
+*		program to the poll that saw it done and hold the compiles.
+*		First draws are the CPU time of the draw call, which is
+*		where drivers that compile the final code late do it; only
+*		the draw entry points and the program and pipeline binds
+*		are wrapped for that (see GLIntercept.h).
+*
+*	Environment variables:
+*		APP_SHADER_TELEMETRY	write the report to this file on
+*					exit
+*		APP_SHADER_COUNTERS	write the counters to this file
+*					on exit, e.g. shaders.prom
+*/
+
+#ifndef SHADER_TELEMETRY_H
+#define SHADER_TELEMETRY_H
+
+#include <cstddef>
+#include <chrono>
+
+void startShaderTelemetry();
+// Reads the environment and, if either file was asked for, starts
+// recording. GL has to be loaded already
+
+const char *setShaderFamily(const char*);
+// Names the family of what this thread builds from here on and returns
+// the one before, so a module can put it back. NULL goes back to none.
+// The name has to stay valid
+
+const char *shaderFamily(const char*);
+// This thread's current family, or the given one if there is none
+
+void recordShaderCompile(size_t, std::chrono::steady_clock::time_point);
+// A stage of this source size compiled, starting at the given time and
+// finished now, under the current family
+
+void recordProgramBuild(unsigned int, size_t, std::chrono::steady_clock::time_point, bool);
+// The program was linked (or loaded from the cache, when the flag is
+// set) from this much source, starting at the given time and finished
+// now, under the current family. Its first draw gets timed after this
+
+void stopShaderTelemetry();
+// Writes the report and the counters and stops recording
+
+#endif
@@ -0,0 +1,340 @@
+/*
+* Description: Benchmark for SPIR-V shaders. Builds the basic shader
+*		Main draws with over and over: from GLSL source, the way
+*		generateShaders() does it when the program cache has
+*		nothing, from the program cache, and from the SPIR-V
+*		version in shaders/ (see SpirvShader.h). Measures the
+*		time to a linked program and to the end of the first
+*		draw with it, since some drivers leave part of the work
+*		for then.
+*
+*	Every build is made new to the driver (a different comment in
+*	the GLSL, a different generator word in the SPIR-V), so the
+*	front end can't answer from an earlier run. A driver cache of
+*	the generated code can still recognise the SPIR-V, which makes
+*	its first draws look cheap; turn that off for cold numbers
+*	(MESA_SHADER_CACHE_DISABLE=true on Mesa, which also turns off
+*	program binaries). Needs GL 4.6 or ARB_gl_spirv.
+*/
+
+// Including core libraries
+#include <iostream>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+
+// Including openGL dependencies
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// Shared window/context setup
+#include "AppContext.h"
+#include "ProgramCache.h"
+#include "ProgramReflection.h"
+#include "ShaderRegistry.h"
+#include "SpirvShader.h"
+#include "BasicShader.h"
+#include "StartupTimeline.h"
+
+const int WIDTH = 800,
+	HEIGHT = 600;
+
+const char *WINDOW_NAME = "SPIR-V Benchmark";
+
+// Programs built each way
+const int RUNS = 50;
+
+// Word of the SPIR-V header tools put their id in, nothing reads it
+const int SPIRV_GENERATOR_WORD = 2;
+
+struct BuildTime {
+	double link;		// Time until the link status is in (ms)
+	double draw;		// Same, plus one draw with it finished (ms)
+};
+
+unsigned int buildGLSL(int);
+// Compiles and links the basic shader from source, made unique with the
+// run number
+
+void fillProgramCache(const ShaderStage*);
+// Builds the basic shader once and stores it, unless the cache has it
+// already (or is turned off)
+
+unsigned int buildCached(const ShaderStage*);
+// Loads the basic shader from the program cache, 0 if it isn't there
+
+unsigned int buildSpirv(const std::string&, const std::string&, int);
+// Specializes and links the SPIR-V version, made unique with the run
+// number
+
+void drawOnce(unsigned int, BuildTime*, std::chrono::steady_clock::time_point);
+// Draws the triangle with the program and waits for it
+
+void printResults(const char*, std::vector<BuildTime>&);
+// Prints the first and the median time of each step
+
+int main() {
+
+	AppContext app;
+
+	if (!createAppContext(&app, WIDTH, HEIGHT, WINDOW_NAME))
+		return -1;
+
+	if (!app.caps.spirv) {
+		std::cout << "SPIR-V shaders aren't available, nothing to compare!\n";
+		destroyAppContext(&app);
+		return -1;
+	}
+
+	std::string directory = shaderDirectory();
+	std::string vertexModule, fragmentModule;
+
+	if (!readShaderFile(directory + "/Basic.vert.spv", &vertexModule) || !readShaderFile(directory + "/Basic.frag.spv", &fragmentModule)) {
+		std::cout << "Unable to read the SPIR-V modules in " << directory << ", run tools/compile_spirv.py!\n";
+		destroyAppContext(&app);
+		return -1;
+	}
+
+	// What every program draws: one triangle, with the colors in binding 0
+	float vertices[] = {
+		-0.5f, -0.5f, 0.0f,
+		0.5f, -0.5f, 0.0f,
+		0.0f,  0.5f, 0.0f
+	};
+
+	unsigned int VAO, VBO, colors;
+	glGenVertexArrays(1, &VAO);
+	glGenBuffers(1, &VBO);
+
+	glBindVertexArray(VAO);
+	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+	glEnableVertexAttribArray(0);
+
+	glGenBuffers(1, &colors);
+	glBindBuffer(GL_UNIFORM_BUFFER, colors);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(BASIC_COLORS), &BASIC_COLORS, GL_STATIC_DRAW);
+	glBindBufferBase(GL_UNIFORM_BUFFER, 0, colors);
+
+	glViewport(0, 0, WIDTH, HEIGHT);
+
+	std::vector<BuildTime> glslTimes, cachedTimes, spirvTimes;
+	bool built = true;
+
+	// The same stages generateShaders() asks the cache for
+	const char *vertexShader = basicVertexShader(), *fragmentShader = basicFragmentShader();
+
+	if (vertexShader == NULL || fragmentShader == NULL) {
+		destroyAppContext(&app);
+		return -1;
+	}
+
+	ShaderStage stages[] = { { GL_VERTEX_SHADER, vertexShader }, { GL_FRAGMENT_SHADER, fragmentShader } };
+
+	if (app.caps.programBinary)
+		fillProgramCache(stages);
+
+	// One of each per run, so none of them gets all the warm caches
+	for (int run = 0; run < RUNS && built; run++) {
+
+		BuildTime time;
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		unsigned int program = buildGLSL(run);
+		time.link = millisecondsSince(start);
+
+		built = program != 0;
+
+		if (built) {
+			drawOnce(program, &time, start);
+			glslTimes.push_back(time);
+			glDeleteProgram(program);
+		}
+
+		start = std::chrono::steady_clock::now();
+		program = buildSpirv(vertexModule, fragmentModule, run);
+		time.link = millisecondsSince(start);
+
+		built = built && program != 0;
+
+		if (program != 0) {
+			drawOnce(program, &time, start);
+			spirvTimes.push_back(time);
+			glDeleteProgram(program);
+		}
+
+		if (!app.caps.programBinary)
+			continue;
+
+		start = std::chrono::steady_clock::now();
+		program = buildCached(stages);
+		time.link = millisecondsSince(start);
+
+		if (program != 0) {
+			drawOnce(program, &time, start);
+			cachedTimes.push_back(time);
+			glDeleteProgram(program);
+		}
+
+	}
+
+	if (!built) {
+		std::cout << "There was an error building the shaders!\n";
+		destroyAppContext(&app);
+		return -1;
+	}
+
+	std::cout << RUNS << " builds of the basic shader each way\n";
+
+	printResults("GLSL", glslTimes);
+	printResults("program cache", cachedTimes);
+	printResults("SPIR-V", spirvTimes);
+
+	glDeleteVertexArrays(1, &VAO);
+	glDeleteBuffers(1, &VBO);
+	glDeleteBuffers(1, &colors);
+
+	destroyAppContext(&app);
+
+	return 0;
+
+}
+
+unsigned int buildGLSL(int run) {
+
+	// A comment of its own, so it's a source the driver hasn't seen
+	std::string unique = "// run " + std::to_string(run) + "\n";
+	std::string fragmentShader = basicFragmentShader() + unique;
+	std::string vertexShader = basicVertexShader() + unique;
+
+	const char *sources[] = { vertexShader.c_str(), fragmentShader.c_str() };
+	unsigned int types[] = { GL_VERTEX_SHADER, GL_FRAGMENT_SHADER };
+
+	unsigned int program = glCreateProgram();
+
+	for (int i = 0; i < 2; i++) {
+		unsigned int shader = glCreateShader(types[i]);
+		glShaderSource(shader, 1, &sources[i], NULL);
+		glCompileShader(shader);
+		glAttachShader(program, shader);
+		glDeleteShader(shader);
+	}
+
+	glLinkProgram(program);
+
+	int success;
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+	if (!success) {
+		glDeleteProgram(program);
+		return 0;
+	}
+
+	return program;
+
+}
+
+void fillProgramCache(const ShaderStage *stages) {
+
+	unsigned int program = buildLinkedProgram(stages, 2, NULL, "the GLSL program");
+
+	if (program != 0) {
+		forgetProgram(program);
+		glDeleteProgram(program);
+	}
+
+}
+
+unsigned int buildCached(const ShaderStage *stages) {
+
+	unsigned int program;
+
+	return loadCachedProgram(stages, 2, &program) ? program : 0;
+
+}
+
+unsigned int buildSpirv(const std::string &vertexModule, const std::string &fragmentModule, int run) {
+
+	std::string modules[] = { vertexModule, fragmentModule };
+	unsigned int types[] = { GL_VERTEX_SHADER, GL_FRAGMENT_SHADER };
+
+	unsigned int program = glCreateProgram();
+	bool specialized = true;
+
+	for (int i = 0; i < 2; i++) {
+
+		// A module the driver hasn't seen, without changing what it does
+		unsigned int generator = 0xBE00 + run;
+		memcpy(&modules[i][SPIRV_GENERATOR_WORD * 4], &generator, sizeof(generator));
+
+		unsigned int shader = createSpirvShader(types[i], modules[i]);
+
+		if (shader == 0) {
+			specialized = false;
+			break;
+		}
+
+		glAttachShader(program, shader);
+		glDeleteShader(shader);
+
+	}
+
+	int success = GL_FALSE;
+
+	if (specialized) {
+		glLinkProgram(program);
+		glGetProgramiv(program, GL_LINK_STATUS, &success);
+	}
+
+	if (!success) {
+		glDeleteProgram(program);
+		return 0;
+	}
+
+	return program;
+
+}
+
+void drawOnce(unsigned int program, BuildTime *time, std::chrono::steady_clock::time_point start) {
+
+	glClear(GL_COLOR_BUFFER_BIT);
+
+	glUseProgram(program);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+	glUseProgram(0);
+
+	glFinish();
+	time->draw = millisecondsSince(start);
+
+}
+
+void printResults(const char *mode, std::vector<BuildTime> &times) {
+
+	// The program cache can be turned off
+	if (times.empty()) {
+		std::cout << mode << ": nothing loaded\n";
+		return;
+	}
+
+	std::vector<double> link, draw;
+
+	for (size_t i = 0; i < times.size(); i++) {
+		link.push_back(times[i].link);
+		draw.push_back(times[i].draw);
+	}
+
+	std::cout << mode << ":\n"
+		<< "  linked      first " << link[0] << " ms";
+
+	std::sort(link.begin(), link.end());
+	std::cout << ", median " << link[link.size() / 2] << " ms\n";
+
+	std::cout << "  first draw  first " << draw[0] << " ms";
+
+	std::sort(draw.begin(), draw.end());
+	std::cout << ", median " << draw[draw.size() / 2] << " ms\n";
+
+}
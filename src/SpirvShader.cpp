@@ -0,0 +1,197 @@
+#include "SpirvShader.h"
+#include "ProgramReflection.h"
+#include "ShaderTelemetry.h"
+#include "ShaderQueue.h"
+
+// Including core libraries
+#include <iostream>
+#include <cstring>
+#include <vector>
+#include <chrono>
+
+#include <glad/glad.h>
+
+// First word of every SPIR-V module
+const unsigned int SPIRV_MAGIC = 0x07230203;
+
+// Magic, version, generator, id bound and a reserved word
+const size_t SPIRV_HEADER_WORDS = 5;
+
+static bool wellFormed(const std::string&);
+// Whether it starts like a SPIR-V module and its instructions add up to
+// exactly its size. Drivers don't all survive a truncated module
+
+unsigned int createSpirvShader(unsigned int type, const std::string &binary) {
+
+	// Also catches handing it a GLSL file by mistake
+	if (!wellFormed(binary)) {
+		std::cout << "Not a SPIR-V module, or a damaged one!\n";
+		return 0;
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	unsigned int shader = glCreateShader(type);
+
+	glShaderBinary(1, &shader, GL_SHADER_BINARY_FORMAT_SPIR_V, binary.data(), (GLsizei) binary.size());
+
+	// The whole "compile": pick the entry point, keep every
+	// specialization constant at its default
+	if (GLAD_GL_VERSION_4_6)
+		glSpecializeShader(shader, "main", 0, NULL, NULL);
+	else
+		glSpecializeShaderARB(shader, "main", 0, NULL, NULL);
+
+	int success;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+
+	if (!success) {
+
+		char log[512];
+		glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+
+		std::cout << "Unable to specialize SPIR-V shader!\n" << log << "\n";
+
+		glDeleteShader(shader);
+
+		return 0;
+
+	}
+
+	recordShaderCompile(binary.size(), start);
+
+	return shader;
+
+}
+
+unsigned int buildSpirvProgram(const ShaderFile *files, int count) {
+
+	std::vector<std::string> binaries(count);
+
+	// All or nothing, a program half from SPIR-V and half from GLSL
+	// would need both versions to agree on every location anyway
+	for (int i = 0; i < count; i++) {
+		if (!readShaderFile(files[i].path, &binaries[i]))
+			return 0;
+	}
+
+	const char *outer = setShaderFamily(shaderFamily("spirv"));
+
+	unsigned int program = glCreateProgram();
+	std::vector<unsigned int> shaders;
+	bool specialized = true;
+
+	for (int i = 0; i < count; i++) {
+
+		unsigned int shader = createSpirvShader(files[i].type, binaries[i]);
+
+		if (shader == 0) {
+			specialized = false;
+			break;
+		}
+
+		glAttachShader(program, shader);
+		shaders.push_back(shader);
+
+	}
+
+	int success = GL_FALSE;
+
+	if (specialized) {
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+		glLinkProgram(program);
+		glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+		if (success) {
+
+			// The modules stand in for the source
+			size_t moduleBytes = 0;
+
+			for (int i = 0; i < count; i++)
+				moduleBytes += binaries[i].size();
+
+			recordProgramBuild(program, moduleBytes, start, false);
+
+		}
+		else {
+
+			char log[512];
+			glGetProgramInfoLog(program, sizeof(log), NULL, log);
+
+			std::cout << "Unable to link SPIR-V program!\n" << log << "\n";
+
+		}
+
+	}
+
+	// Linked programs keep what they need, the shaders can go
+	for (size_t i = 0; i < shaders.size(); i++) {
+		glDetachShader(program, shaders[i]);
+		glDeleteShader(shaders[i]);
+	}
+
+	setShaderFamily(outer);
+
+	if (!success) {
+		glDeleteProgram(program);
+		return 0;
+	}
+
+	reflectProgram(program);
+
+	return program;
+
+}
+
+int queueSpirvProgram(const ShaderFile *files, int count) {
+
+	std::vector<std::string> binaries(count);
+	std::vector<unsigned int> types(count);
+
+	for (int i = 0; i < count; i++) {
+
+		if (!readShaderFile(files[i].path, &binaries[i]))
+			return -1;
+
+		types[i] = files[i].type;
+
+	}
+
+	const char *outer = setShaderFamily(shaderFamily("spirv"));
+	int handle = queueSpirvModules(&types[0], &binaries[0], count);
+	setShaderFamily(outer);
+
+	return handle;
+
+}
+
+static bool wellFormed(const std::string &binary) {
+
+	if (binary.size() < SPIRV_HEADER_WORDS * 4 || binary.size() % 4 != 0)
+		return false;
+
+	std::vector<unsigned int> words(binary.size() / 4);
+	memcpy(&words[0], binary.data(), binary.size());
+
+	if (words[0] != SPIRV_MAGIC)
+		return false;
+
+	// Every instruction starts with its length in words in the high half
+	size_t at = SPIRV_HEADER_WORDS;
+
+	while (at < words.size()) {
+
+		size_t length = words[at] >> 16;
+
+		if (length == 0 || at + length > words.size())
+			return false;
+
+		at += length;
+
+	}
+
+	return true;
+
+}
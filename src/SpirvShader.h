@@ -0,0 +1,53 @@
+/*
+* Description: Shader stages loaded from SPIR-V (ARB_gl_spirv, core in
+*		4.6) instead of compiled from GLSL. The GLSL is compiled
+*		to SPIR-V offline (tools/compile_spirv.py), so at
+*		run time the driver gets a module it only has to
+*		specialize and link: glShaderBinary with
+*		GL_SHADER_BINARY_FORMAT_SPIR_V, then glSpecializeShader
+*		on main. No preprocessing or parsing of source text.
+*
+*		Only available when app.caps.spirv is set. Modules built
+*		for GL need explicit locations on every input and output
+*		and explicit bindings on blocks and samplers, since GL
+*		can't match SPIR-V by name; uniforms outside of blocks
+*		are found by location too. A program built here can be
+*		missing its names (ProgramReflection.h finds nothing), so
+*		set everything up by location and binding.
+*
+*		Typical use:
+*			unsigned int program = 0;
+*			if (app.caps.spirv)
+*				program = buildSpirvProgram(files, 2);
+*			if (program == 0)
+*				... build the GLSL version ...
+*
+*		A render loop that mustn't stall queues it instead
+*		(queueSpirvProgram) and falls back to the GLSL version
+*		if the queue reports it failed.
+*/
+
+#ifndef SPIRV_SHADER_H
+#define SPIRV_SHADER_H
+
+#include "ShaderReload.h"
+
+#include <string>
+
+unsigned int createSpirvShader(unsigned int, const std::string&);
+// Creates a shader of the given type from a SPIR-V module and
+// specializes its main. Prints the log and returns 0 if the driver
+// rejects it
+
+unsigned int buildSpirvProgram(const ShaderFile*, int);
+// Links a program from the SPIR-V files (one .spv path per stage).
+// Returns 0 without a word if a file can't be read, so the caller can
+// quietly fall back to GLSL, and 0 with the log printed if it didn't
+// build
+
+int queueSpirvProgram(const ShaderFile*, int);
+// Same, but built in the background by the shader queue (ShaderQueue.h),
+// which draws its fallback program until it's ready. Returns the queue
+// handle, or -1 without a word if a file can't be read
+
+#endif
@@ -0,0 +1,191 @@
+#include "StartupTimeline.h"
+
+// Including core libraries
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+
+#include <glad/glad.h>
+
+// More phases than any demo has, the rest get ignored
+const int MAX_PHASES = 64;
+
+// How deep phases can nest
+const int MAX_DEPTH = 16;
+
+struct StartupPhase {
+	const char *name;
+	double start, duration;		// Microseconds since startup
+	int depth;
+};
+
+// Taken during static initialisation, as close to process start as we get
+static const std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+
+static StartupPhase phases[MAX_PHASES];
+static int phaseCount;
+
+// Indices into phases of the phases still running, innermost last
+static int open[MAX_DEPTH];
+static int openCount;
+
+static bool cold;
+static bool finished;
+
+static double microsecondsSinceStart();
+// Now, on the timeline's clock
+
+static void setDriverVariable(const char*, const char*);
+// Sets an environment variable the GL driver reads when it loads
+
+static void writeTimeline(const char*, double);
+// Writes everything recorded so far as Chrome trace JSON
+
+static void writeString(std::ostream&, const char*);
+// Writes a quoted and escaped JSON string
+
+void startStartupTimeline() {
+
+	const char *mode = getenv("APP_STARTUP_MODE");
+
+	cold = mode != NULL && strcmp(mode, "cold") == 0;
+
+	if (cold) {
+		// Mesa (older releases use the GLSL name) and NVIDIA
+		setDriverVariable("MESA_SHADER_CACHE_DISABLE", "true");
+		setDriverVariable("MESA_GLSL_CACHE_DISABLE", "true");
+		setDriverVariable("__GL_SHADER_DISK_CACHE", "0");
+	}
+
+}
+
+void beginStartupPhase(const char *name) {
+
+	if (finished || phaseCount == MAX_PHASES || openCount == MAX_DEPTH)
+		return;
+
+	StartupPhase &phase = phases[phaseCount];
+	phase.name = name;
+	phase.start = microsecondsSinceStart();
+	phase.duration = 0.0;
+	phase.depth = openCount;
+
+	open[openCount++] = phaseCount++;
+
+}
+
+void endStartupPhase() {
+
+	if (finished || openCount == 0)
+		return;
+
+	StartupPhase &phase = phases[open[--openCount]];
+	phase.duration = microsecondsSinceStart() - phase.start;
+
+}
+
+void finishStartupTimeline() {
+
+	if (finished)
+		return;
+
+	double firstFrame = microsecondsSinceStart();
+
+	// Anything still open ends with the first frame
+	while (openCount > 0)
+		endStartupPhase();
+
+	finished = true;
+
+	const char *path = getenv("APP_STARTUP_TRACE");
+
+	if (path == NULL || *path == '\0')
+		return;
+
+	writeTimeline(path, firstFrame);
+
+	std::cout << "First frame " << firstFrame / 1000.0 << " ms after startup ("
+		<< (cold ? "cold" : "warm") << "), timeline written to " << path << "\n";
+
+}
+
+static double microsecondsSinceStart() {
+
+	return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - origin).count();
+
+}
+
+static void setDriverVariable(const char *name, const char *value) {
+
+#ifdef _WIN32
+	_putenv_s(name, value);
+#else
+	setenv(name, value, 1);
+#endif
+
+}
+
+static void writeTimeline(const char *path, double firstFrame) {
+
+	std::ofstream file(path);
+
+	if (!file) {
+		std::cout << "Unable to create " << path << "!\n";
+		return;
+	}
+
+	file.precision(3);
+	file << std::fixed;
+
+	file << "{\"traceEvents\":[\n";
+
+	// Everything from startup to the first frame, the number to track
+	file << "{\"name\":\"startup\",\"cat\":\"startup\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":0.000,\"dur\":"
+		<< firstFrame << "}";
+
+	for (int i = 0; i < phaseCount; i++) {
+
+		file << ",\n{\"name\":";
+		writeString(file, phases[i].name);
+		file << ",\"cat\":\"startup\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << phases[i].start
+			<< ",\"dur\":" << phases[i].duration << ",\"args\":{\"depth\":" << phases[i].depth << "}}";
+
+	}
+
+	file << ",\n{\"name\":\"first frame\",\"cat\":\"startup\",\"ph\":\"i\",\"s\":\"p\",\"pid\":1,\"tid\":1,\"ts\":"
+		<< firstFrame << "}";
+
+	file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"main\"}}";
+
+	// Which setup this was measured on, so only like gets compared with like
+	const char *renderer = glGetString != NULL ? (const char*) glGetString(GL_RENDERER) : NULL;
+	const char *version = glGetString != NULL ? (const char*) glGetString(GL_VERSION) : NULL;
+
+	file << "\n],\n\"displayTimeUnit\":\"ms\",\n\"otherData\":{\"mode\":\"" << (cold ? "cold" : "warm") << "\",\"renderer\":";
+	writeString(file, renderer != NULL ? renderer : "unknown");
+	file << ",\"version\":";
+	writeString(file, version != NULL ? version : "unknown");
+	file << "}}\n";
+
+}
+
+static void writeString(std::ostream &out, const char *text) {
+
+	out << '"';
+
+	for (const char *c = text; *c != '\0'; c++) {
+
+		if (*c == '"' || *c == '\\')
+			out << '\\' << *c;
+		else if ((unsigned char) *c < 0x20)
+			out << ' ';
+		else
+			out << *c;
+
+	}
+
+	out << '"';
+
+}
@@ -0,0 +1,49 @@
+/*
+* Description: Times the startup phases of a demo (GLFW/EGL setup,
+*		context creation, loading GL, compiling shaders, building
+*		VAOs, ...) up to the first presented frame, and writes
+*		them as a Chrome trace (open it in chrome://tracing or
+*		ui.perfetto.dev). Timestamps are monotonic and count from
+*		when the program started up, before main.
+*
+*		In cold mode the driver's on-disk shader caches are
+*		turned off, so every startup pays for real compiles, the
+*		way a first run after installing (or a driver update)
+*		does. Warm mode leaves them on; run the program once
+*		before measuring so they are filled in. Comparing the
+*		same mode across builds is what catches regressions.
+*
+*	Environment variables:
+*		APP_STARTUP_TRACE	write the timeline to this .json
+*					file after the first frame
+*		APP_STARTUP_MODE	cold or warm (the default)
+*/
+
+#ifndef STARTUP_TIMELINE_H
+#define STARTUP_TIMELINE_H
+
+#include <chrono>
+
+void startStartupTimeline();
+// Reads the environment and, in cold mode, turns off the driver shader
+// caches. Has to run before the GL driver gets loaded
+
+void beginStartupPhase(const char*);
+// Starts timing a phase. Phases can nest, the name has to stay valid
+
+void endStartupPhase();
+// Ends the innermost phase still running
+
+void finishStartupTimeline();
+// Marks the first frame as presented and writes the timeline. Only the
+// first call does anything
+
+// Elapsed milliseconds since the given time, for everything that times
+// itself
+inline double millisecondsSince(std::chrono::steady_clock::time_point start) {
+
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+}
+
+#endif
@@ -0,0 +1,696 @@
+/*
+* Description: Plays back a trace recorded with APP_TRACE (see
+*		GLTrace.h) as fast as the driver allows and reports how
+*		long it took. The trace is memory mapped and the calls
+*		are dispatched straight from it, so the replay itself adds
+*		very little on top of the GL calls. Useful for comparing
+*		drivers or the loader without the app's own CPU work in
+*		the way.
+*
+*	Usage: TraceReplay <trace file> [width height]
+*
+*	Object names are assumed to come out the same as when recording
+*	(true for the same driver replaying from a fresh context).
+*	Replay warns if glGen* or glCreate* return something different.
+*/
+
+// Including built-in libraries
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <iostream>
+#include <chrono>
+#include <type_traits>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// Including other libraries
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// Shared window/context setup
+#include "AppContext.h"
+#include "GLIntercept.h"
+#include "GLTrace.h"
+#include "StartupTimeline.h"
+
+const int HEIGHT = 600,
+	WIDTH = 800;
+
+const char WINDOW_NAME[] = "Trace Replay";
+
+// Enough for any argument count GL has
+const int MAX_ARGS = 16;
+
+// Memory handed to calls whose pointer arguments weren't captured
+// (glGet* results, info logs, ...), one buffer per argument. Each is at
+// least this big and grows to what the recorded arguments ask for
+const size_t SCRATCH_SLOT = 64 * 1024;
+
+// More than that is taken to be a broken record and the call is skipped
+const size_t MAX_SCRATCH = 256 * 1024 * 1024;
+
+// Smaller pointer values are buffer offsets rather than client memory
+const uint64_t MAX_OFFSET = 64 * 1024;
+
+struct ReplayCall {
+	int op;
+	const TraceRecord *record;
+	const uint64_t *args;
+	const unsigned char *data[MAX_ARGS];	// Captured memory per argument, or NULL
+	bool output[MAX_ARGS];
+	uint32_t size[MAX_ARGS];
+};
+
+typedef uint64_t (*ReplayFunction)(void*, const ReplayCall&);
+
+static std::vector<unsigned char> scratch[MAX_ARGS];
+
+// Entry points already warned about for reading memory the trace has no copy of
+static bool uncaptured[GL_OP_COUNT];
+
+// Recorded GLsync values to the ones this run created
+static std::unordered_map<uint64_t, GLsync> syncs;
+
+// Function prototypes
+const unsigned char *mapTrace(const char*, size_t&);
+// Maps the whole trace file read-only. Returns NULL on failure
+
+void unmapTrace(const unsigned char*, size_t);
+
+bool readOpNames(const unsigned char*, size_t, std::vector<int>&, size_t&);
+// Checks the header and matches the recorded entry point names to
+// our opcodes (-1 for ones this build doesn't have). Also returns
+// where the first record starts
+
+size_t outputSize(int, const ReplayCall&, int);
+// How many bytes the call may write through the given pointer argument,
+// going by its recorded arguments. 0 for the ones this doesn't know
+
+size_t pixelBytes(GLsizei, GLsizei, GLsizei);
+// The most glReadPixels or glGetTexImage can write for that many pixels
+// with the current pack state
+
+uint64_t replayShaderSource(int, const ReplayCall&);
+// glShaderSource and glCreateShaderProgramv, with their strings rebuilt
+// from the payload
+
+double percentile(std::vector<double>, double);
+
+void warnUncaptured(const ReplayCall&, int);
+// Says (once per entry point) that the call gets scratch memory instead
+// of input the recording didn't capture, so it may draw the wrong thing
+
+// Argument decoding, the opposite of encodeArg in GLTrace.cpp
+template <typename T, bool IsFloat = std::is_floating_point<T>::value>
+struct ArgDecoder {
+	static T decode(const ReplayCall &call, int index) {
+		return (T) (int64_t) call.args[index];
+	}
+};
+
+template <typename T>
+struct ArgDecoder<T, true> {
+	static T decode(const ReplayCall &call, int index) {
+		if (sizeof(T) == sizeof(float)) {
+			uint32_t bits = (uint32_t) call.args[index];
+			float value;
+			memcpy(&value, &bits, sizeof(value));
+			return (T) value;
+		}
+		double value;
+		memcpy(&value, &call.args[index], sizeof(value));
+		return (T) value;
+	}
+};
+
+template <typename T>
+struct ArgDecoder<T*, false> {
+	static T *decode(const ReplayCall &call, int index) {
+
+		// Captured input memory is used right from the trace
+		if (call.data[index] != NULL && !call.output[index])
+			return (T*) call.data[index];
+
+		uint64_t value = call.args[index];
+
+		// NULL and buffer offsets go through untouched
+		if (value < MAX_OFFSET && (std::is_const<T>::value || value == 0))
+			return (T*) (uintptr_t) value;
+
+		// Anything else the call writes to or reads garbage from
+		if (std::is_const<T>::value)
+			warnUncaptured(call, index);
+
+		return (T*) scratch[index].data();
+
+	}
+};
+
+template <>
+struct ArgDecoder<GLsync, false> {
+	static GLsync decode(const ReplayCall &call, int index) {
+		std::unordered_map<uint64_t, GLsync>::iterator it = syncs.find(call.args[index]);
+		return it != syncs.end() ? it->second : (GLsync) 0;
+	}
+};
+
+// Results, for checking names and remapping syncs
+template <typename R>
+static uint64_t encodeResult(R value) {
+	return (uint64_t) (int64_t) value;
+}
+
+template <typename R>
+static uint64_t encodeResult(R *value) {
+	return (uint64_t) (uintptr_t) value;
+}
+
+template <int... I>
+struct Indices {};
+
+template <int N, int... I>
+struct MakeIndices : MakeIndices<N - 1, N - 1, I...> {};
+
+template <int... I>
+struct MakeIndices<0, I...> {
+	typedef Indices<I...> type;
+};
+
+template <typename PFN>
+struct Invoker;
+
+template <typename R, typename... A>
+struct Invoker<R (APIENTRYP)(A...)> {
+
+	static uint64_t run(void *proc, const ReplayCall &call) {
+		return invoke(proc, call, typename MakeIndices<sizeof...(A)>::type());
+	}
+
+	template <int... I>
+	static uint64_t invoke(void *proc, const ReplayCall &call, Indices<I...>) {
+		R (APIENTRYP function)(A...) = (R (APIENTRYP)(A...)) proc;
+		return encodeResult(function(ArgDecoder<A>::decode(call, I)...));
+	}
+
+};
+
+template <typename... A>
+struct Invoker<void (APIENTRYP)(A...)> {
+
+	static uint64_t run(void *proc, const ReplayCall &call) {
+		return invoke(proc, call, typename MakeIndices<sizeof...(A)>::type());
+	}
+
+	template <int... I>
+	static uint64_t invoke(void *proc, const ReplayCall &call, Indices<I...>) {
+		void (APIENTRYP function)(A...) = (void (APIENTRYP)(A...)) proc;
+		function(ArgDecoder<A>::decode(call, I)...);
+		return 0;
+	}
+
+};
+
+// One decoder per opcode
+static const ReplayFunction REPLAY_FUNCTIONS[] = {
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) &Invoker<pfn>::run,
+#define GLAD_PROC(ret, name, pfn, params, args, feature) GLAD_PROC_VOID(name, pfn, params, args, feature)
+#include <glad/glad_procs.h>
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+};
+
+int main(int argc, char **argv) {
+
+	if (argc != 2 && argc != 4) {
+		std::cout << "Usage: " << argv[0] << " <trace file> [width height]\n";
+		return -1;
+	}
+
+	size_t traceSize = 0;
+	const unsigned char *traceData = mapTrace(argv[1], traceSize);
+
+	if (traceData == NULL) {
+		std::cout << "Unable to open the trace " << argv[1] << "!\n";
+		return -1;
+	}
+
+	std::vector<int> ops;
+	size_t offset = 0;
+
+	if (!readOpNames(traceData, traceSize, ops, offset)) {
+		std::cout << argv[1] << " isn't a trace this build can read!\n";
+		unmapTrace(traceData, traceSize);
+		return -1;
+	}
+
+	int width = argc == 4 ? atoi(argv[2]) : WIDTH;
+	int height = argc == 4 ? atoi(argv[3]) : HEIGHT;
+
+	AppContext app;
+
+	if (!createAppContext(&app, width, height, WINDOW_NAME)) {
+		unmapTrace(traceData, traceSize);
+		return -1;
+	}
+
+	// Play the whole trace unless told otherwise
+	if (getenv("APP_FRAMES") == NULL)
+		app.frameLimit = 0;
+
+	// The loaded entry points, looked up once instead of per call
+	void *procs[GL_OP_COUNT];
+
+	for (int op = 0; op < GL_OP_COUNT; op++) {
+		void **slot = gladGetProcSlot(op);
+		procs[op] = slot != NULL ? *slot : NULL;
+	}
+
+	long long calls = 0, skipped = 0, broken = 0, mismatches = 0;
+	uint64_t firstTime = 0, lastTime = 0;
+	std::vector<double> frameTimes;
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::chrono::steady_clock::time_point frameStart = start;
+
+	while (offset + sizeof(TraceRecord) <= traceSize && !appShouldClose(&app)) {
+
+		const TraceRecord *record = (const TraceRecord*) (traceData + offset);
+
+		if (record->size < sizeof(TraceRecord) || offset + record->size > traceSize) {
+			std::cout << "The trace is cut off at byte " << offset << ", stopping\n";
+			break;
+		}
+
+		offset += record->size;
+
+		if (calls == 0)
+			firstTime = record->time;
+
+		lastTime = record->time;
+
+		if (record->op == TRACE_OP_FRAME) {
+
+			appSwapBuffers(&app);
+
+			std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+			frameTimes.push_back(std::chrono::duration<double, std::milli>(now - frameStart).count());
+			frameStart = now;
+
+			continue;
+
+		}
+
+		if (record->op == TRACE_OP_DROPPED) {
+			broken++;
+			continue;
+		}
+
+		int op = record->op < ops.size() ? ops[record->op] : -1;
+
+		if (op < 0 || procs[op] == NULL || record->argCount > MAX_ARGS) {
+			skipped++;
+			continue;
+		}
+
+		ReplayCall call;
+		call.op = op;
+		call.record = record;
+		call.args = (const uint64_t*) (record + 1);
+
+		for (int i = 0; i < record->argCount; i++) {
+			call.data[i] = NULL;
+			call.output[i] = false;
+			call.size[i] = 0;
+		}
+
+		const unsigned char *recordEnd = (const unsigned char*) record + record->size;
+		const unsigned char *payloadData = (const unsigned char*) (call.args + record->argCount);
+		bool valid = payloadData <= recordEnd;
+
+		for (int i = 0; i < record->payloadCount && valid; i++) {
+
+			const TracePayload *payload = (const TracePayload*) payloadData;
+			payloadData += sizeof(TracePayload);
+
+			// Payloads have to stay inside their record
+			if (payloadData > recordEnd || payload->size > (size_t) (recordEnd - payloadData)) {
+				valid = false;
+				break;
+			}
+
+			if (payload->arg < record->argCount) {
+				call.data[payload->arg] = payloadData;
+				call.output[payload->arg] = payload->output != 0;
+				call.size[payload->arg] = payload->size;
+			}
+
+			payloadData += ((size_t) payload->size + 7) & ~(size_t) 7;
+
+		}
+
+		// Room for whatever the call writes where nothing was captured
+		for (int i = 0; i < record->argCount && valid; i++) {
+
+			size_t bytes = std::max(outputSize(op, call, i), SCRATCH_SLOT);
+
+			if (bytes > MAX_SCRATCH)
+				valid = false;
+			else if (scratch[i].size() < bytes)
+				scratch[i].resize(bytes);
+
+		}
+
+		if (!valid) {
+			broken++;
+			continue;
+		}
+
+		uint64_t result = 0;
+
+		if (op == GL_OP_ShaderSource || op == GL_OP_CreateShaderProgramv)
+			result = replayShaderSource(op, call);
+		else
+			result = REPLAY_FUNCTIONS[op](procs[op], call);
+
+		calls++;
+
+		// Keep track of objects the rest of the trace refers to
+		switch (op) {
+
+		case GL_OP_FenceSync:
+			syncs[record->result] = (GLsync) (uintptr_t) result;
+			break;
+
+		case GL_OP_DeleteSync:
+			syncs.erase(call.args[0]);
+			break;
+
+		case GL_OP_CreateShader:
+		case GL_OP_CreateProgram:
+		case GL_OP_CreateShaderProgramv:
+			if (result != record->result)
+				mismatches++;
+			break;
+
+		default:
+			for (int i = 0; i < record->argCount; i++) {
+				if (call.output[i] && call.size[i] <= scratch[i].size()
+					&& memcmp(scratch[i].data(), call.data[i], call.size[i]) != 0)
+					mismatches++;
+			}
+			break;
+
+		}
+
+	}
+
+	// Wait for the GPU, so the time covers all of the work
+	if (app.platform != GLAD_PLATFORM_NULL)
+		glFinish();
+
+	double replayMs = millisecondsSince(start);
+	double recordedMs = (lastTime - firstTime) / 1e6;
+
+	std::cout << "Replayed " << calls << " calls in " << frameTimes.size() << " frames in "
+		<< replayMs << " ms (recorded run took " << recordedMs << " ms)\n";
+
+	if (!frameTimes.empty()) {
+		std::cout << "Frame time: min " << percentile(frameTimes, 0.0)
+			<< " ms, median " << percentile(frameTimes, 0.5)
+			<< " ms, 99th " << percentile(frameTimes, 0.99)
+			<< " ms, max " << percentile(frameTimes, 1.0) << " ms\n";
+	}
+
+	if (skipped > 0)
+		std::cout << skipped << " calls skipped (entry points this build can't load)\n";
+
+	if (broken > 0)
+		std::cout << broken << " calls skipped (too big to record, damaged, or asking for over "
+			<< MAX_SCRATCH / (1024 * 1024) << " MB of output)\n";
+
+	if (mismatches > 0)
+		std::cout << "Warning: " << mismatches << " object names differ from the recording, the replay may be wrong\n";
+
+	destroyAppContext(&app);
+
+	unmapTrace(traceData, traceSize);
+
+	return 0;
+
+}
+
+bool readOpNames(const unsigned char *data, size_t size, std::vector<int> &ops, size_t &offset) {
+
+	if (size < sizeof(TraceHeader))
+		return false;
+
+	const TraceHeader *header = (const TraceHeader*) data;
+
+	if (header->magic != TRACE_MAGIC || header->version != TRACE_VERSION)
+		return false;
+
+	std::unordered_map<std::string, int> local;
+
+	for (int op = 0; op < GL_OP_COUNT; op++)
+		local[glOpName(op)] = op;
+
+	offset = sizeof(TraceHeader);
+	ops.assign(header->opCount, -1);
+
+	for (uint32_t i = 0; i < header->opCount; i++) {
+
+		uint16_t length;
+
+		if (offset + sizeof(length) > size)
+			return false;
+
+		memcpy(&length, data + offset, sizeof(length));
+		offset += sizeof(length);
+
+		if (offset + length > size)
+			return false;
+
+		std::unordered_map<std::string, int>::iterator it = local.find(std::string((const char*) data + offset, length));
+
+		if (it != local.end())
+			ops[i] = it->second;
+
+		offset += length;
+
+	}
+
+	offset = (offset + 7) & ~(size_t) 7;
+
+	return true;
+
+}
+
+size_t outputSize(int op, const ReplayCall &call, int index) {
+
+	const uint64_t *args = call.args;
+
+	// Negative sizes are the call's error to report, not ours
+	#define BYTES(value) ((int64_t) (value) > 0 ? (size_t) (int64_t) (value) : 0)
+
+	switch (op) {
+
+	case GL_OP_GetBufferSubData:
+	case GL_OP_GetNamedBufferSubData:
+		return index == 3 ? BYTES(args[2]) : 0;
+
+	case GL_OP_GetProgramBinary:
+		return index == 4 ? BYTES(args[1]) : 0;
+
+	case GL_OP_GetShaderInfoLog:
+	case GL_OP_GetProgramInfoLog:
+	case GL_OP_GetProgramPipelineInfoLog:
+	case GL_OP_GetShaderSource:
+		return index == 3 ? BYTES(args[1]) : 0;
+
+	case GL_OP_ReadnPixels:
+		return index == 7 ? BYTES(args[6]) : 0;
+
+	case GL_OP_GetnTexImage:
+		return index == 5 ? BYTES(args[4]) : 0;
+
+	case GL_OP_ReadPixels:
+		return index == 6 ? pixelBytes((GLsizei) args[2], (GLsizei) args[3], 1) : 0;
+
+	case GL_OP_GetTexImage:
+		if (index == 4) {
+
+			GLint width = 0, height = 0, depth = 0;
+			glGetTexLevelParameteriv((GLenum) args[0], (GLint) args[1], GL_TEXTURE_WIDTH, &width);
+			glGetTexLevelParameteriv((GLenum) args[0], (GLint) args[1], GL_TEXTURE_HEIGHT, &height);
+			glGetTexLevelParameteriv((GLenum) args[0], (GLint) args[1], GL_TEXTURE_DEPTH, &depth);
+
+			return pixelBytes(width, height, depth);
+
+		}
+		return 0;
+
+	}
+
+	#undef BYTES
+
+	return 0;
+
+}
+
+size_t pixelBytes(GLsizei width, GLsizei height, GLsizei depth) {
+
+	if (width <= 0 || height <= 0 || depth <= 0)
+		return 0;
+
+	GLint rowLength = 0, skipRows = 0, skipPixels = 0, alignment = 4;
+	glGetIntegerv(GL_PACK_ROW_LENGTH, &rowLength);
+	glGetIntegerv(GL_PACK_SKIP_ROWS, &skipRows);
+	glGetIntegerv(GL_PACK_SKIP_PIXELS, &skipPixels);
+	glGetIntegerv(GL_PACK_ALIGNMENT, &alignment);
+
+	if (alignment <= 0)
+		alignment = 1;
+
+	// Four 32-bit channels is the most any format/type pair takes
+	size_t pixels = (size_t) std::max(rowLength, (GLint) width) + std::max(skipPixels, 0);
+	size_t row = (pixels * 16 + alignment - 1) / alignment * alignment;
+
+	return row * ((size_t) height + std::max(skipRows, 0)) * (size_t) depth;
+
+}
+
+uint64_t replayShaderSource(int op, const ReplayCall &call) {
+
+	GLsizei count = (GLsizei) call.args[1];
+
+	std::vector<const GLchar*> strings(count);
+	std::vector<GLint> lengths(count);
+
+	const unsigned char *data = call.data[2];
+
+	for (GLsizei i = 0; i < count && data != NULL; i++) {
+
+		uint32_t length;
+		memcpy(&length, data, sizeof(length));
+
+		strings[i] = (const GLchar*) data + sizeof(length);
+		lengths[i] = (GLint) length;
+
+		data += sizeof(length) + length;
+
+	}
+
+	if (op == GL_OP_ShaderSource) {
+		glShaderSource((GLuint) call.args[0], count, strings.data(), lengths.data());
+		return 0;
+	}
+
+	// No lengths to pass here, so each string needs its terminator back
+	std::vector<std::string> terminated(count);
+	std::vector<const GLchar*> pointers(count);
+
+	for (GLsizei i = 0; i < count; i++) {
+		terminated[i].assign(strings[i], lengths[i]);
+		pointers[i] = terminated[i].c_str();
+	}
+
+	return glCreateShaderProgramv((GLenum) call.args[0], count, pointers.data());
+
+}
+
+double percentile(std::vector<double> values, double fraction) {
+
+	std::sort(values.begin(), values.end());
+
+	return values[(size_t) (fraction * (values.size() - 1))];
+
+}
+
+void warnUncaptured(const ReplayCall &call, int index) {
+
+	if (uncaptured[call.op])
+		return;
+
+	uncaptured[call.op] = true;
+
+	std::cout << "Warning: " << glOpName(call.op) << " reads memory through argument " << index
+		<< " that the trace has no copy of, the replay may be wrong\n";
+
+}
+
+#ifdef _WIN32
+
+const unsigned char *mapTrace(const char *path, size_t &size) {
+
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+	if (file == INVALID_HANDLE_VALUE)
+		return NULL;
+
+	LARGE_INTEGER fileSize;
+	GetFileSizeEx(file, &fileSize);
+	size = (size_t) fileSize.QuadPart;
+
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+
+	if (mapping == NULL)
+		return NULL;
+
+	// The view keeps the mapping alive
+	const unsigned char *data = (const unsigned char*) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mapping);
+
+	return data;
+
+}
+
+void unmapTrace(const unsigned char *data, size_t) {
+
+	UnmapViewOfFile(data);
+
+}
+
+#else
+
+const unsigned char *mapTrace(const char *path, size_t &size) {
+
+	int fd = open(path, O_RDONLY);
+
+	if (fd < 0)
+		return NULL;
+
+	struct stat info;
+
+	if (fstat(fd, &info) != 0 || info.st_size == 0) {
+		close(fd);
+		return NULL;
+	}
+
+	size = (size_t) info.st_size;
+
+	void *data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	return data != MAP_FAILED ? (const unsigned char*) data : NULL;
+
+}
+
+void unmapTrace(const unsigned char *data, size_t size) {
+
+	munmap((void*) data, size);
+
+}
+
+#endif
@@ -1,30 +1,82 @@
 /*
 
-    OpenGL loader generated by glad 0.1.15a0 on Wed Nov 15 00:44:43 2017.
-
-    Language/Generator: C/C++
-    Specification: gl
-    APIs: gl=3.3
-    Profile: compatibility
-    Extensions:
-        
-    Loader: True
-    Local files: False
-    Omit khrplatform: False
-
-    Commandline:
-        --profile="compatibility" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
-    Online:
-        http://glad.dav1d.de/#profile=compatibility&language=c&specification=gl&loader=on&api=gl%3D3.3
+    OpenGL loader for gl=4.6, compatibility profile, with the extensions
+    GL_ARB_buffer_storage, GL_ARB_direct_state_access,
+    GL_ARB_get_program_binary, GL_ARB_gl_spirv, GL_ARB_multi_draw_indirect,
+    GL_ARB_separate_shader_objects, GL_KHR_debug and
+    GL_KHR_parallel_shader_compile.
+
+    Started as glad 0.1.15a0 output for gl=3.3. The GL 4.0-4.6 and
+    extension blocks were added by hand from the Khronos glcorearb.h,
+    following glad 0.1's layout, and the loader now also carries the
+    extension registry, lazy trampolines, per-context dispatch (GLAD_GL_MX),
+    the egl/osmesa/null platforms and trimmed loading (GLAD_TRIMMED).
+
+    Do not regenerate this file with upstream glad, all of the above would
+    be lost. Edit glad.h and glad.c by hand instead, then rebuild the entry
+    point list from them:
+
+        python3 tools/glad_procs.py include/glad/glad.h src/glad.c > include/glad/glad_procs.h
+
 */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <glad/glad.h>
+#include "Hash.h"
+
+/* GLAD_TRIMMED names an entry point list written by tools/glad_trim.py,
+   e.g. -DGLAD_TRIMMED='"Main_procs.h"'. Only those entry points are then
+   defined and loaded. Everything that walks the entry points includes
+   GLAD_PROCS rather than glad_procs.h, so it follows the list too. */
+#ifdef GLAD_TRIMMED
+#define GLAD_PROCS GLAD_TRIMMED
+#else
+#define GLAD_PROCS <glad/glad_procs.h>
+#endif
 
 static void* get_proc(const char *namez);
 
+/*
+ * Platform selection. gladLoadGL() normally goes through the windowing
+ * system's library (WGL, CGL or GLX). On Linux it can instead load through
+ * EGL or OSMesa, which need no X server. The platform is picked by
+ * gladSetPlatform(), else by the GLAD_PLATFORM environment variable
+ * ("native", "glx", "egl", "osmesa" or "null"), else automatically: native when a
+ * display is available, EGL otherwise.
+ */
+static int requested_platform = GLAD_PLATFORM_AUTO;
+
+void gladSetPlatform(int platform) {
+    requested_platform = platform;
+}
+
+int gladGetPlatform(void) {
+    const char *env;
+
+    if(requested_platform != GLAD_PLATFORM_AUTO) {
+        return requested_platform;
+    }
+
+    env = getenv("GLAD_PLATFORM");
+    if(env != NULL) {
+        if(strcmp(env, "native") == 0 || strcmp(env, "glx") == 0) return GLAD_PLATFORM_NATIVE;
+        if(strcmp(env, "egl") == 0) return GLAD_PLATFORM_EGL;
+        if(strcmp(env, "osmesa") == 0) return GLAD_PLATFORM_OSMESA;
+        if(strcmp(env, "null") == 0) return GLAD_PLATFORM_NULL;
+    }
+
+#if defined(_WIN32) || defined(__APPLE__)
+    return GLAD_PLATFORM_NATIVE;
+#else
+    if(getenv("DISPLAY") != NULL || getenv("WAYLAND_DISPLAY") != NULL) {
+        return GLAD_PLATFORM_NATIVE;
+    }
+    return GLAD_PLATFORM_EGL;
+#endif
+}
+
 #ifdef _WIN32
 #include <windows.h>
 static HMODULE libGL;
@@ -34,6 +86,8 @@ static PFNWGLGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
 
 static
 int open_gl(void) {
+    if(gladGetPlatform() != GLAD_PLATFORM_NATIVE) return 0;
+
     libGL = LoadLibraryW(L"opengl32.dll");
     if(libGL != NULL) {
         gladGetProcAddressPtr = (PFNWGLGETPROCADDRESSPROC_PRIVATE)GetProcAddress(
@@ -58,6 +112,25 @@ static void* libGL;
 #ifndef __APPLE__
 typedef void* (APIENTRYP PFNGLXGETPROCADDRESSPROC_PRIVATE)(const char*);
 static PFNGLXGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
+
+/* libEGL only exports EGL itself, core GL symbols live in libOpenGL */
+static void* libGLcore;
+
+struct platform_lib {
+    int platform;
+    const char *name;
+    const char *get_proc_name;
+};
+
+static const struct platform_lib PLATFORM_LIBS[] = {
+    {GLAD_PLATFORM_NATIVE, "libGL.so.1", "glXGetProcAddressARB"},
+    {GLAD_PLATFORM_NATIVE, "libGL.so", "glXGetProcAddressARB"},
+    {GLAD_PLATFORM_EGL, "libEGL.so.1", "eglGetProcAddress"},
+    {GLAD_PLATFORM_EGL, "libEGL.so", "eglGetProcAddress"},
+    {GLAD_PLATFORM_OSMESA, "libOSMesa.so.8", "OSMesaGetProcAddress"},
+    {GLAD_PLATFORM_OSMESA, "libOSMesa.so.6", "OSMesaGetProcAddress"},
+    {GLAD_PLATFORM_OSMESA, "libOSMesa.so", "OSMesaGetProcAddress"}
+};
 #endif
 
 static
@@ -69,30 +142,48 @@ int open_gl(void) {
         "/System/Library/Frameworks/OpenGL.framework/OpenGL",
         "/System/Library/Frameworks/OpenGL.framework/Versions/Current/OpenGL"
     };
-#else
-    static const char *NAMES[] = {"libGL.so.1", "libGL.so"};
-#endif
 
     unsigned int index = 0;
+    if(gladGetPlatform() != GLAD_PLATFORM_NATIVE) return 0;
+
     for(index = 0; index < (sizeof(NAMES) / sizeof(NAMES[0])); index++) {
         libGL = dlopen(NAMES[index], RTLD_NOW | RTLD_GLOBAL);
 
         if(libGL != NULL) {
-#ifdef __APPLE__
             return 1;
+        }
+    }
 #else
+    int platform = gladGetPlatform();
+    unsigned int index = 0;
+
+    for(index = 0; index < (sizeof(PLATFORM_LIBS) / sizeof(PLATFORM_LIBS[0])); index++) {
+        if(PLATFORM_LIBS[index].platform != platform) continue;
+
+        libGL = dlopen(PLATFORM_LIBS[index].name, RTLD_NOW | RTLD_GLOBAL);
+
+        if(libGL != NULL) {
             gladGetProcAddressPtr = (PFNGLXGETPROCADDRESSPROC_PRIVATE)dlsym(libGL,
-                "glXGetProcAddressARB");
+                PLATFORM_LIBS[index].get_proc_name);
+            if(platform == GLAD_PLATFORM_EGL) {
+                libGLcore = dlopen("libOpenGL.so.0", RTLD_NOW | RTLD_GLOBAL);
+            }
             return gladGetProcAddressPtr != NULL;
-#endif
         }
     }
+#endif
 
     return 0;
 }
 
 static
 void close_gl() {
+#ifndef __APPLE__
+    if(libGLcore != NULL) {
+        dlclose(libGLcore);
+        libGLcore = NULL;
+    }
+#endif
     if(libGL != NULL) {
         dlclose(libGL);
         libGL = NULL;
@@ -117,6 +208,11 @@ void* get_proc(const char *namez) {
         result = dlsym(libGL, namez);
 #endif
     }
+#if !defined(_WIN32) && !defined(__APPLE__)
+    if(result == NULL && libGLcore != NULL) {
+        result = dlsym(libGLcore, namez);
+    }
+#endif
 
     return result;
 }
@@ -124,853 +220,1308 @@ void* get_proc(const char *namez) {
 int gladLoadGL(void) {
     int status = 0;
 
-    if(open_gl()) {
+#ifndef GLAD_NO_NULL_DRIVER
+    if(gladGetPlatform() == GLAD_PLATFORM_NULL) {
+        return gladLoadGLLoader(&gladNullProc);
+    }
+#endif
+
+    /* The loaded entry points live in the library, so it stays open
+       (and is reused by later loads) until gladUnloadGL() */
+    if(libGL != NULL || open_gl()) {
         status = gladLoadGLLoader(&get_proc);
-        close_gl();
     }
 
     return status;
 }
 
-struct gladGLversionStruct GLVersion;
+void gladUnloadGL(void) {
+    close_gl();
+}
+
+GLAD_THREAD_LOCAL struct gladGLversionStruct GLVersion;
 
 #if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
 #define _GLAD_IS_SOME_NEW_VERSION 1
 #endif
 
-static int max_loaded_major;
-static int max_loaded_minor;
+static GLAD_THREAD_LOCAL int max_loaded_major;
+static GLAD_THREAD_LOCAL int max_loaded_minor;
+
+/*
+ * Extension registry.
+ *
+ * Every extension name reported by the driver is copied once into a single
+ * arena allocation, which also holds the name index and an open-addressing
+ * hash table (FNV-1a, linear probing, load factor <= 0.5). The registry is
+ * kept alive after gladLoadGLLoader() returns so that gladHasExtension() can
+ * be used from hot paths, and is rebuilt on the next load. Registries
+ * loaded through gladLoadGLContext() are owned by their context.
+ *
+ * Arena layout:
+ *   [const char *names[count]] [struct ext_slot slots[mask + 1]] [chars]
+ */
+struct ext_slot {
+    unsigned int hash;
+    int index;          /* index into names, -1 when the slot is empty */
+};
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static const char **exts_i = NULL;
+struct ext_registry {
+    void *arena;
+    const char **names;
+    struct ext_slot *slots;
+    unsigned int mask;
+    int count;
+};
+
+/* The registry gladLoadGLLoader() fills, and the one queries go to */
+static GLAD_THREAD_LOCAL struct ext_registry exts_loaded;
+static GLAD_THREAD_LOCAL struct ext_registry *exts = NULL;
+
+static unsigned int ext_hash(const char *s, size_t len) {
+    return fnv1a32(FNV1A32_OFFSET, s, len);
+}
+
+static void free_exts(struct ext_registry *reg) {
+    if (reg->arena != NULL) {
+        free(reg->arena);
+    }
+    memset(reg, 0, sizeof(*reg));
+}
+
+/* Allocates the arena for count names totalling chars bytes (without
+   terminators) and returns the start of the character area. */
+static char *alloc_exts(struct ext_registry *reg, int count, size_t chars) {
+    unsigned int slots = 8;
+    size_t names_size, slots_size;
+    int index;
+
+    while(slots < (unsigned int)count * 2) {
+        slots <<= 1;
+    }
+
+    names_size = (size_t)count * sizeof(*reg->names);
+    slots_size = (size_t)slots * sizeof(*reg->slots);
+
+    reg->arena = malloc(names_size + slots_size + chars + (size_t)count);
+    if (reg->arena == NULL) {
+        return NULL;
+    }
+
+    reg->names = (const char **)reg->arena;
+    reg->slots = (struct ext_slot *)((char *)reg->arena + names_size);
+    reg->mask = slots - 1;
+    reg->count = 0;
+    for(index = 0; index <= (int)reg->mask; index++) {
+        reg->slots[index].hash = 0;
+        reg->slots[index].index = -1;
+    }
+
+    return (char *)reg->slots + slots_size;
+}
+
+/* Copies one name into the arena at *cursor and indexes it. */
+static void add_ext(struct ext_registry *reg, char **cursor, const char *name, size_t len) {
+    unsigned int hash = ext_hash(name, len);
+    unsigned int slot = hash & reg->mask;
+    char *dst = *cursor;
+
+    memcpy(dst, name, len);
+    dst[len] = '\0';
+    *cursor = dst + len + 1;
+
+    while(reg->slots[slot].index >= 0) {
+        /* Drivers occasionally report duplicates, keep the first one */
+        if (reg->slots[slot].hash == hash && strcmp(reg->names[reg->slots[slot].index], dst) == 0) {
+            return;
+        }
+        slot = (slot + 1) & reg->mask;
+    }
+
+    reg->slots[slot].hash = hash;
+    reg->slots[slot].index = reg->count;
+    reg->names[reg->count++] = dst;
+}
 
 static int get_exts(void) {
+    struct ext_registry *reg = &exts_loaded;
+    char *cursor;
+
+    free_exts(reg);
+    exts = reg;
+
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     if(max_loaded_major < 3) {
 #endif
-        exts = (const char *)glGetString(GL_EXTENSIONS);
+        const char *ext_str = (const char *)glGetString(GL_EXTENSIONS);
+        const char *p;
+        int count = 0;
+
+        if (ext_str == NULL) {
+            return 0;
+        }
+
+        /* Count the names first, so the arena is a single allocation */
+        for(p = ext_str; *p != '\0'; ) {
+            size_t len = strcspn(p, " ");
+            if (len > 0) count++;
+            p += len;
+            while(*p == ' ') p++;
+        }
+
+        cursor = alloc_exts(reg, count, strlen(ext_str));
+        if (cursor == NULL) {
+            return 0;
+        }
+
+        for(p = ext_str; *p != '\0'; ) {
+            size_t len = strcspn(p, " ");
+            if (len > 0) add_ext(reg, &cursor, p, len);
+            p += len;
+            while(*p == ' ') p++;
+        }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
         unsigned int index;
+        int num_exts_i = 0;
+        size_t chars = 0;
 
-        num_exts_i = 0;
         glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (const char **)realloc((void *)exts_i, (size_t)num_exts_i * (sizeof *exts_i));
+        if (num_exts_i < 0) {
+            num_exts_i = 0;
+        }
+
+        /* glGetStringi returns driver-owned strings, so query them twice
+           (size, then copy) rather than allocating a temporary list */
+        for(index = 0; index < (unsigned)num_exts_i; index++) {
+            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
+            if (gl_str_tmp != NULL) chars += strlen(gl_str_tmp);
         }
 
-        if (exts_i == NULL) {
+        cursor = alloc_exts(reg, num_exts_i, chars);
+        if (cursor == NULL) {
             return 0;
         }
 
         for(index = 0; index < (unsigned)num_exts_i; index++) {
             const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
-
-            char *local_str = (char*)malloc((len+1) * sizeof(*exts_i));
-            if(local_str != NULL) {
-#if _MSC_VER >= 1400
-                strncpy_s(local_str, len+1, gl_str_tmp, len);
-#else
-                strncpy(local_str, gl_str_tmp, len+1);
-#endif
-            }
-            exts_i[index] = local_str;
+            if (gl_str_tmp != NULL) add_ext(reg, &cursor, gl_str_tmp, strlen(gl_str_tmp));
         }
     }
 #endif
     return 1;
 }
 
-static void free_exts(void) {
-    if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
-        free((void *)exts_i);
-        exts_i = NULL;
-    }
-}
-
 static int has_ext(const char *ext) {
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    if(max_loaded_major < 3) {
-#endif
-        const char *extensions;
-        const char *loc;
-        const char *terminator;
-        extensions = exts;
-        if(extensions == NULL || ext == NULL) {
-            return 0;
-        }
+    unsigned int hash, slot;
+    size_t len;
 
-        while(1) {
-            loc = strstr(extensions, ext);
-            if(loc == NULL) {
-                return 0;
-            }
+    if (exts == NULL || exts->slots == NULL || ext == NULL) {
+        return 0;
+    }
 
-            terminator = loc + strlen(ext);
-            if((loc == extensions || *(loc - 1) == ' ') &&
-                (*terminator == ' ' || *terminator == '\0')) {
-                return 1;
-            }
-            extensions = terminator;
-        }
-#ifdef _GLAD_IS_SOME_NEW_VERSION
-    } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
+    len = strlen(ext);
+    hash = ext_hash(ext, len);
+    slot = hash & exts->mask;
 
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
-            }
+    while(exts->slots[slot].index >= 0) {
+        if (exts->slots[slot].hash == hash && strcmp(exts->names[exts->slots[slot].index], ext) == 0) {
+            return 1;
         }
+        slot = (slot + 1) & exts->mask;
     }
-#endif
 
     return 0;
 }
-int GLAD_GL_VERSION_1_0;
-int GLAD_GL_VERSION_1_1;
-int GLAD_GL_VERSION_1_2;
-int GLAD_GL_VERSION_1_3;
-int GLAD_GL_VERSION_1_4;
-int GLAD_GL_VERSION_1_5;
-int GLAD_GL_VERSION_2_0;
-int GLAD_GL_VERSION_2_1;
-int GLAD_GL_VERSION_3_0;
-int GLAD_GL_VERSION_3_1;
-int GLAD_GL_VERSION_3_2;
-int GLAD_GL_VERSION_3_3;
-PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D;
-PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui;
-PFNGLWINDOWPOS2SPROC glad_glWindowPos2s;
-PFNGLWINDOWPOS2IPROC glad_glWindowPos2i;
-PFNGLWINDOWPOS2FPROC glad_glWindowPos2f;
-PFNGLWINDOWPOS2DPROC glad_glWindowPos2d;
-PFNGLVERTEX2FVPROC glad_glVertex2fv;
-PFNGLINDEXIPROC glad_glIndexi;
-PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer;
-PFNGLRECTDVPROC glad_glRectdv;
-PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D;
-PFNGLEVALCOORD2DPROC glad_glEvalCoord2d;
-PFNGLEVALCOORD2FPROC glad_glEvalCoord2f;
-PFNGLINDEXDPROC glad_glIndexd;
-PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv;
-PFNGLINDEXFPROC glad_glIndexf;
-PFNGLBINDSAMPLERPROC glad_glBindSampler;
-PFNGLLINEWIDTHPROC glad_glLineWidth;
-PFNGLCOLORP3UIVPROC glad_glColorP3uiv;
-PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v;
-PFNGLGETMAPFVPROC glad_glGetMapfv;
-PFNGLINDEXSPROC glad_glIndexs;
-PFNGLCOMPILESHADERPROC glad_glCompileShader;
-PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying;
-PFNGLWINDOWPOS2IVPROC glad_glWindowPos2iv;
-PFNGLINDEXFVPROC glad_glIndexfv;
-PFNGLFOGIVPROC glad_glFogiv;
-PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate;
-PFNGLRASTERPOS2FVPROC glad_glRasterPos2fv;
-PFNGLLIGHTMODELIVPROC glad_glLightModeliv;
-PFNGLCOLOR4UIPROC glad_glColor4ui;
-PFNGLSECONDARYCOLOR3FVPROC glad_glSecondaryColor3fv;
-PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui;
-PFNGLFOGFVPROC glad_glFogfv;
-PFNGLVERTEXP4UIPROC glad_glVertexP4ui;
-PFNGLENABLEIPROC glad_glEnablei;
-PFNGLVERTEX4IVPROC glad_glVertex4iv;
-PFNGLEVALCOORD1FVPROC glad_glEvalCoord1fv;
-PFNGLWINDOWPOS2SVPROC glad_glWindowPos2sv;
-PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui;
-PFNGLCREATESHADERPROC glad_glCreateShader;
-PFNGLISBUFFERPROC glad_glIsBuffer;
-PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv;
-PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers;
-PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D;
-PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D;
-PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f;
-PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate;
-PFNGLVERTEX4FVPROC glad_glVertex4fv;
-PFNGLBINDTEXTUREPROC glad_glBindTexture;
-PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s;
-PFNGLTEXCOORD2FVPROC glad_glTexCoord2fv;
-PFNGLSAMPLEMASKIPROC glad_glSampleMaski;
-PFNGLVERTEXP2UIPROC glad_glVertexP2ui;
-PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex;
-PFNGLTEXCOORD4FVPROC glad_glTexCoord4fv;
-PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv;
-PFNGLPOINTSIZEPROC glad_glPointSize;
-PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv;
-PFNGLDELETEPROGRAMPROC glad_glDeleteProgram;
-PFNGLCOLOR4BVPROC glad_glColor4bv;
-PFNGLRASTERPOS2FPROC glad_glRasterPos2f;
-PFNGLRASTERPOS2DPROC glad_glRasterPos2d;
-PFNGLLOADIDENTITYPROC glad_glLoadIdentity;
-PFNGLRASTERPOS2IPROC glad_glRasterPos2i;
-PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage;
-PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv;
-PFNGLCOLOR3BPROC glad_glColor3b;
-PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv;
-PFNGLEDGEFLAGPROC glad_glEdgeFlag;
-PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers;
-PFNGLVERTEX3DPROC glad_glVertex3d;
-PFNGLVERTEX3FPROC glad_glVertex3f;
-PFNGLVERTEX3IPROC glad_glVertex3i;
-PFNGLCOLOR3IPROC glad_glColor3i;
-PFNGLUNIFORM3FPROC glad_glUniform3f;
-PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv;
-PFNGLCOLOR3SPROC glad_glColor3s;
-PFNGLVERTEX3SPROC glad_glVertex3s;
-PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui;
-PFNGLCOLORMASKIPROC glad_glColorMaski;
-PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi;
-PFNGLTEXCOORD1IVPROC glad_glTexCoord1iv;
-PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer;
-PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui;
-PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv;
-PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex;
-PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f;
-PFNGLVERTEX2IVPROC glad_glVertex2iv;
-PFNGLCOLOR3SVPROC glad_glColor3sv;
-PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv;
-PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv;
-PFNGLNORMALPOINTERPROC glad_glNormalPointer;
-PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv;
-PFNGLVERTEX4SVPROC glad_glVertex4sv;
-PFNGLPASSTHROUGHPROC glad_glPassThrough;
-PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui;
-PFNGLFOGIPROC glad_glFogi;
-PFNGLBEGINPROC glad_glBegin;
-PFNGLEVALCOORD2DVPROC glad_glEvalCoord2dv;
-PFNGLCOLOR3UBVPROC glad_glColor3ubv;
-PFNGLVERTEXPOINTERPROC glad_glVertexPointer;
-PFNGLSECONDARYCOLOR3UIVPROC glad_glSecondaryColor3uiv;
-PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers;
-PFNGLDRAWARRAYSPROC glad_glDrawArrays;
-PFNGLUNIFORM1UIPROC glad_glUniform1ui;
-PFNGLMULTITEXCOORD1DPROC glad_glMultiTexCoord1d;
-PFNGLMULTITEXCOORD1FPROC glad_glMultiTexCoord1f;
-PFNGLLIGHTFVPROC glad_glLightfv;
-PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui;
-PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d;
-PFNGLCLEARPROC glad_glClear;
-PFNGLMULTITEXCOORD1IPROC glad_glMultiTexCoord1i;
-PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName;
-PFNGLMULTITEXCOORD1SPROC glad_glMultiTexCoord1s;
-PFNGLISENABLEDPROC glad_glIsEnabled;
-PFNGLSTENCILOPPROC glad_glStencilOp;
-PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv;
-PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D;
-PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv;
-PFNGLTRANSLATEFPROC glad_glTranslatef;
-PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub;
-PFNGLTRANSLATEDPROC glad_glTranslated;
-PFNGLTEXCOORD3SVPROC glad_glTexCoord3sv;
-PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation;
-PFNGLTEXIMAGE1DPROC glad_glTexImage1D;
-PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv;
-PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv;
-PFNGLSECONDARYCOLOR3BVPROC glad_glSecondaryColor3bv;
-PFNGLGETMATERIALFVPROC glad_glGetMaterialfv;
-PFNGLGETTEXIMAGEPROC glad_glGetTexImage;
-PFNGLFOGCOORDFVPROC glad_glFogCoordfv;
-PFNGLPIXELMAPUIVPROC glad_glPixelMapuiv;
-PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog;
-PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v;
-PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers;
-PFNGLINDEXSVPROC glad_glIndexsv;
-PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders;
-PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer;
-PFNGLVERTEX3IVPROC glad_glVertex3iv;
-PFNGLBITMAPPROC glad_glBitmap;
-PFNGLMATERIALIPROC glad_glMateriali;
-PFNGLISVERTEXARRAYPROC glad_glIsVertexArray;
-PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray;
-PFNGLGETQUERYIVPROC glad_glGetQueryiv;
-PFNGLTEXCOORD4FPROC glad_glTexCoord4f;
-PFNGLTEXCOORD4DPROC glad_glTexCoord4d;
-PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv;
-PFNGLTEXCOORD4IPROC glad_glTexCoord4i;
-PFNGLMATERIALFPROC glad_glMaterialf;
-PFNGLTEXCOORD4SPROC glad_glTexCoord4s;
-PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices;
-PFNGLISSHADERPROC glad_glIsShader;
-PFNGLMULTITEXCOORD2SPROC glad_glMultiTexCoord2s;
-PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv;
-PFNGLVERTEX3DVPROC glad_glVertex3dv;
-PFNGLGETINTEGER64VPROC glad_glGetInteger64v;
-PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv;
-PFNGLENABLEPROC glad_glEnable;
-PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv;
-PFNGLCOLOR4FVPROC glad_glColor4fv;
-PFNGLTEXCOORD1FVPROC glad_glTexCoord1fv;
-PFNGLTEXCOORD2SVPROC glad_glTexCoord2sv;
-PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv;
-PFNGLMULTITEXCOORD1DVPROC glad_glMultiTexCoord1dv;
-PFNGLMULTITEXCOORD2IPROC glad_glMultiTexCoord2i;
-PFNGLTEXCOORD3FVPROC glad_glTexCoord3fv;
-PFNGLSECONDARYCOLOR3USVPROC glad_glSecondaryColor3usv;
-PFNGLTEXGENFPROC glad_glTexGenf;
-PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv;
-PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui;
-PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui;
-PFNGLGETPOINTERVPROC glad_glGetPointerv;
-PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset;
-PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv;
-PFNGLNORMAL3FVPROC glad_glNormal3fv;
-PFNGLSECONDARYCOLOR3SPROC glad_glSecondaryColor3s;
-PFNGLDEPTHRANGEPROC glad_glDepthRange;
-PFNGLFRUSTUMPROC glad_glFrustum;
-PFNGLMULTITEXCOORD4SVPROC glad_glMultiTexCoord4sv;
-PFNGLDRAWBUFFERPROC glad_glDrawBuffer;
-PFNGLPUSHMATRIXPROC glad_glPushMatrix;
-PFNGLRASTERPOS3FVPROC glad_glRasterPos3fv;
-PFNGLORTHOPROC glad_glOrtho;
-PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced;
-PFNGLWINDOWPOS3SVPROC glad_glWindowPos3sv;
-PFNGLCLEARINDEXPROC glad_glClearIndex;
-PFNGLMAP1DPROC glad_glMap1d;
-PFNGLMAP1FPROC glad_glMap1f;
-PFNGLFLUSHPROC glad_glFlush;
-PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv;
-PFNGLINDEXIVPROC glad_glIndexiv;
-PFNGLRASTERPOS3SVPROC glad_glRasterPos3sv;
-PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv;
-PFNGLPIXELZOOMPROC glad_glPixelZoom;
-PFNGLFENCESYNCPROC glad_glFenceSync;
-PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays;
-PFNGLCOLORP3UIPROC glad_glColorP3ui;
-PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv;
-PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender;
-PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex;
-PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv;
-PFNGLLIGHTIPROC glad_glLighti;
-PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv;
-PFNGLLIGHTFPROC glad_glLightf;
-PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation;
-PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate;
-PFNGLGENSAMPLERSPROC glad_glGenSamplers;
-PFNGLCLAMPCOLORPROC glad_glClampColor;
-PFNGLUNIFORM4IVPROC glad_glUniform4iv;
-PFNGLCLEARSTENCILPROC glad_glClearStencil;
-PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv;
-PFNGLMULTITEXCOORD3FVPROC glad_glMultiTexCoord3fv;
-PFNGLGETPIXELMAPUIVPROC glad_glGetPixelMapuiv;
-PFNGLGENTEXTURESPROC glad_glGenTextures;
-PFNGLTEXCOORD4IVPROC glad_glTexCoord4iv;
-PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv;
-PFNGLINDEXPOINTERPROC glad_glIndexPointer;
-PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv;
-PFNGLISSYNCPROC glad_glIsSync;
-PFNGLVERTEX2FPROC glad_glVertex2f;
-PFNGLVERTEX2DPROC glad_glVertex2d;
-PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers;
-PFNGLUNIFORM2IPROC glad_glUniform2i;
-PFNGLMAPGRID2DPROC glad_glMapGrid2d;
-PFNGLMAPGRID2FPROC glad_glMapGrid2f;
-PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui;
-PFNGLVERTEX2IPROC glad_glVertex2i;
-PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer;
-PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer;
-PFNGLVERTEX2SPROC glad_glVertex2s;
-PFNGLNORMAL3BVPROC glad_glNormal3bv;
-PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv;
-PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange;
-PFNGLSECONDARYCOLOR3SVPROC glad_glSecondaryColor3sv;
-PFNGLVERTEX3SVPROC glad_glVertex3sv;
-PFNGLGENQUERIESPROC glad_glGenQueries;
-PFNGLGETPIXELMAPFVPROC glad_glGetPixelMapfv;
-PFNGLTEXENVFPROC glad_glTexEnvf;
-PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui;
-PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D;
-PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v;
-PFNGLFOGCOORDDPROC glad_glFogCoordd;
-PFNGLFOGCOORDFPROC glad_glFogCoordf;
-PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D;
-PFNGLTEXENVIPROC glad_glTexEnvi;
-PFNGLMULTITEXCOORD1IVPROC glad_glMultiTexCoord1iv;
-PFNGLISENABLEDIPROC glad_glIsEnabledi;
-PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui;
-PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i;
-PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed;
-PFNGLMULTITEXCOORD2DVPROC glad_glMultiTexCoord2dv;
-PFNGLUNIFORM2IVPROC glad_glUniform2iv;
-PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv;
-PFNGLUNIFORM4UIVPROC glad_glUniform4uiv;
-PFNGLMATRIXMODEPROC glad_glMatrixMode;
-PFNGLFEEDBACKBUFFERPROC glad_glFeedbackBuffer;
-PFNGLGETMAPIVPROC glad_glGetMapiv;
-PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D;
-PFNGLGETSHADERIVPROC glad_glGetShaderiv;
-PFNGLMULTITEXCOORD2DPROC glad_glMultiTexCoord2d;
-PFNGLMULTITEXCOORD2FPROC glad_glMultiTexCoord2f;
-PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation;
-PFNGLPRIORITIZETEXTURESPROC glad_glPrioritizeTextures;
-PFNGLCALLLISTPROC glad_glCallList;
-PFNGLSECONDARYCOLOR3UBVPROC glad_glSecondaryColor3ubv;
-PFNGLGETDOUBLEVPROC glad_glGetDoublev;
-PFNGLMULTITEXCOORD3IVPROC glad_glMultiTexCoord3iv;
-PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d;
-PFNGLLIGHTMODELFPROC glad_glLightModelf;
-PFNGLGETUNIFORMIVPROC glad_glGetUniformiv;
-PFNGLVERTEX2SVPROC glad_glVertex2sv;
-PFNGLLIGHTMODELIPROC glad_glLightModeli;
-PFNGLWINDOWPOS3IVPROC glad_glWindowPos3iv;
-PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv;
-PFNGLUNIFORM3FVPROC glad_glUniform3fv;
-PFNGLPIXELSTOREIPROC glad_glPixelStorei;
-PFNGLCALLLISTSPROC glad_glCallLists;
-PFNGLMAPBUFFERPROC glad_glMapBuffer;
-PFNGLSECONDARYCOLOR3DPROC glad_glSecondaryColor3d;
-PFNGLTEXCOORD3IPROC glad_glTexCoord3i;
-PFNGLMULTITEXCOORD4FVPROC glad_glMultiTexCoord4fv;
-PFNGLRASTERPOS3IPROC glad_glRasterPos3i;
-PFNGLSECONDARYCOLOR3BPROC glad_glSecondaryColor3b;
-PFNGLRASTERPOS3DPROC glad_glRasterPos3d;
-PFNGLRASTERPOS3FPROC glad_glRasterPos3f;
-PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D;
-PFNGLTEXCOORD3FPROC glad_glTexCoord3f;
-PFNGLDELETESYNCPROC glad_glDeleteSync;
-PFNGLTEXCOORD3DPROC glad_glTexCoord3d;
-PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample;
-PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv;
-PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements;
-PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv;
-PFNGLTEXCOORD3SPROC glad_glTexCoord3s;
-PFNGLUNIFORM3IVPROC glad_glUniform3iv;
-PFNGLRASTERPOS3SPROC glad_glRasterPos3s;
-PFNGLPOLYGONMODEPROC glad_glPolygonMode;
-PFNGLDRAWBUFFERSPROC glad_glDrawBuffers;
-PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv;
-PFNGLARETEXTURESRESIDENTPROC glad_glAreTexturesResident;
-PFNGLISLISTPROC glad_glIsList;
-PFNGLRASTERPOS2SVPROC glad_glRasterPos2sv;
-PFNGLRASTERPOS4SVPROC glad_glRasterPos4sv;
-PFNGLCOLOR4SPROC glad_glColor4s;
-PFNGLUSEPROGRAMPROC glad_glUseProgram;
-PFNGLLINESTIPPLEPROC glad_glLineStipple;
-PFNGLMULTITEXCOORD1SVPROC glad_glMultiTexCoord1sv;
-PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog;
-PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv;
-PFNGLMULTITEXCOORD2IVPROC glad_glMultiTexCoord2iv;
-PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv;
-PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray;
-PFNGLCOLOR4BPROC glad_glColor4b;
-PFNGLSECONDARYCOLOR3FPROC glad_glSecondaryColor3f;
-PFNGLCOLOR4FPROC glad_glColor4f;
-PFNGLCOLOR4DPROC glad_glColor4d;
-PFNGLCOLOR4IPROC glad_glColor4i;
-PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv;
-PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex;
-PFNGLRASTERPOS3IVPROC glad_glRasterPos3iv;
-PFNGLVERTEX2DVPROC glad_glVertex2dv;
-PFNGLTEXCOORD4SVPROC glad_glTexCoord4sv;
-PFNGLUNIFORM2UIVPROC glad_glUniform2uiv;
-PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D;
-PFNGLFINISHPROC glad_glFinish;
-PFNGLGETBOOLEANVPROC glad_glGetBooleanv;
-PFNGLDELETESHADERPROC glad_glDeleteShader;
-PFNGLDRAWELEMENTSPROC glad_glDrawElements;
-PFNGLRASTERPOS2SPROC glad_glRasterPos2s;
-PFNGLGETMAPDVPROC glad_glGetMapdv;
-PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv;
-PFNGLMATERIALFVPROC glad_glMaterialfv;
-PFNGLVIEWPORTPROC glad_glViewport;
-PFNGLUNIFORM1UIVPROC glad_glUniform1uiv;
-PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings;
-PFNGLINDEXDVPROC glad_glIndexdv;
-PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D;
-PFNGLTEXCOORD3IVPROC glad_glTexCoord3iv;
-PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i;
-PFNGLCLEARDEPTHPROC glad_glClearDepth;
-PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv;
-PFNGLTEXPARAMETERFPROC glad_glTexParameterf;
-PFNGLTEXPARAMETERIPROC glad_glTexParameteri;
-PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource;
-PFNGLTEXBUFFERPROC glad_glTexBuffer;
-PFNGLPOPNAMEPROC glad_glPopName;
-PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram;
-PFNGLPIXELSTOREFPROC glad_glPixelStoref;
-PFNGLUNIFORM3UIVPROC glad_glUniform3uiv;
-PFNGLRASTERPOS4FVPROC glad_glRasterPos4fv;
-PFNGLEVALCOORD1DVPROC glad_glEvalCoord1dv;
-PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv;
-PFNGLRECTIPROC glad_glRecti;
-PFNGLCOLOR4UBPROC glad_glColor4ub;
-PFNGLMULTTRANSPOSEMATRIXFPROC glad_glMultTransposeMatrixf;
-PFNGLRECTFPROC glad_glRectf;
-PFNGLRECTDPROC glad_glRectd;
-PFNGLNORMAL3SVPROC glad_glNormal3sv;
-PFNGLNEWLISTPROC glad_glNewList;
-PFNGLCOLOR4USPROC glad_glColor4us;
-PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv;
-PFNGLLINKPROGRAMPROC glad_glLinkProgram;
-PFNGLHINTPROC glad_glHint;
-PFNGLRECTSPROC glad_glRects;
-PFNGLTEXCOORD2DVPROC glad_glTexCoord2dv;
-PFNGLRASTERPOS4IVPROC glad_glRasterPos4iv;
-PFNGLGETSTRINGPROC glad_glGetString;
-PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv;
-PFNGLEDGEFLAGVPROC glad_glEdgeFlagv;
-PFNGLDETACHSHADERPROC glad_glDetachShader;
-PFNGLSCALEFPROC glad_glScalef;
-PFNGLENDQUERYPROC glad_glEndQuery;
-PFNGLSCALEDPROC glad_glScaled;
-PFNGLEDGEFLAGPOINTERPROC glad_glEdgeFlagPointer;
-PFNGLCOPYPIXELSPROC glad_glCopyPixels;
-PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui;
-PFNGLPOPATTRIBPROC glad_glPopAttrib;
-PFNGLDELETETEXTURESPROC glad_glDeleteTextures;
-PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate;
-PFNGLDELETEQUERIESPROC glad_glDeleteQueries;
-PFNGLNORMALP3UIVPROC glad_glNormalP3uiv;
-PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f;
-PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d;
-PFNGLINITNAMESPROC glad_glInitNames;
-PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v;
-PFNGLCOLOR3DVPROC glad_glColor3dv;
-PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i;
-PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv;
-PFNGLWAITSYNCPROC glad_glWaitSync;
-PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s;
-PFNGLCOLORMATERIALPROC glad_glColorMaterial;
-PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage;
-PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri;
-PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf;
-PFNGLUNIFORM1FPROC glad_glUniform1f;
-PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv;
-PFNGLRENDERMODEPROC glad_glRenderMode;
-PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage;
-PFNGLWINDOWPOS2DVPROC glad_glWindowPos2dv;
-PFNGLUNIFORM1IPROC glad_glUniform1i;
-PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib;
-PFNGLUNIFORM3IPROC glad_glUniform3i;
-PFNGLPIXELTRANSFERIPROC glad_glPixelTransferi;
-PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D;
-PFNGLDISABLEPROC glad_glDisable;
-PFNGLLOGICOPPROC glad_glLogicOp;
-PFNGLEVALPOINT2PROC glad_glEvalPoint2;
-PFNGLPIXELTRANSFERFPROC glad_glPixelTransferf;
-PFNGLSECONDARYCOLOR3IPROC glad_glSecondaryColor3i;
-PFNGLUNIFORM4UIPROC glad_glUniform4ui;
-PFNGLCOLOR3FPROC glad_glColor3f;
-PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer;
-PFNGLGETTEXENVFVPROC glad_glGetTexEnvfv;
-PFNGLRECTFVPROC glad_glRectfv;
-PFNGLCULLFACEPROC glad_glCullFace;
-PFNGLGETLIGHTFVPROC glad_glGetLightfv;
-PFNGLCOLOR3DPROC glad_glColor3d;
-PFNGLTEXGENDPROC glad_glTexGend;
-PFNGLTEXGENIPROC glad_glTexGeni;
-PFNGLMULTITEXCOORD3SPROC glad_glMultiTexCoord3s;
-PFNGLGETSTRINGIPROC glad_glGetStringi;
-PFNGLMULTITEXCOORD3IPROC glad_glMultiTexCoord3i;
-PFNGLMULTITEXCOORD3FPROC glad_glMultiTexCoord3f;
-PFNGLMULTITEXCOORD3DPROC glad_glMultiTexCoord3d;
-PFNGLATTACHSHADERPROC glad_glAttachShader;
-PFNGLFOGCOORDDVPROC glad_glFogCoorddv;
-PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv;
-PFNGLGETTEXGENFVPROC glad_glGetTexGenfv;
-PFNGLQUERYCOUNTERPROC glad_glQueryCounter;
-PFNGLFOGCOORDPOINTERPROC glad_glFogCoordPointer;
-PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex;
-PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D;
-PFNGLTEXGENIVPROC glad_glTexGeniv;
-PFNGLRASTERPOS2DVPROC glad_glRasterPos2dv;
-PFNGLSECONDARYCOLOR3DVPROC glad_glSecondaryColor3dv;
-PFNGLCLIENTACTIVETEXTUREPROC glad_glClientActiveTexture;
-PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv;
-PFNGLSECONDARYCOLOR3USPROC glad_glSecondaryColor3us;
-PFNGLNORMALP3UIPROC glad_glNormalP3ui;
-PFNGLTEXENVFVPROC glad_glTexEnvfv;
-PFNGLREADBUFFERPROC glad_glReadBuffer;
-PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv;
-PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced;
-PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap;
-PFNGLWINDOWPOS3FVPROC glad_glWindowPos3fv;
-PFNGLLIGHTMODELFVPROC glad_glLightModelfv;
-PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv;
-PFNGLDELETELISTSPROC glad_glDeleteLists;
-PFNGLGETCLIPPLANEPROC glad_glGetClipPlane;
-PFNGLVERTEX4DVPROC glad_glVertex4dv;
-PFNGLTEXCOORD2DPROC glad_glTexCoord2d;
-PFNGLPOPMATRIXPROC glad_glPopMatrix;
-PFNGLTEXCOORD2FPROC glad_glTexCoord2f;
-PFNGLCOLOR4IVPROC glad_glColor4iv;
-PFNGLINDEXUBVPROC glad_glIndexubv;
-PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer;
-PFNGLTEXCOORD2IPROC glad_glTexCoord2i;
-PFNGLRASTERPOS4DPROC glad_glRasterPos4d;
-PFNGLRASTERPOS4FPROC glad_glRasterPos4f;
-PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s;
-PFNGLTEXCOORD2SPROC glad_glTexCoord2s;
-PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer;
-PFNGLVERTEX3FVPROC glad_glVertex3fv;
-PFNGLTEXCOORD4DVPROC glad_glTexCoord4dv;
-PFNGLMATERIALIVPROC glad_glMaterialiv;
-PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv;
-PFNGLISPROGRAMPROC glad_glIsProgram;
-PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv;
-PFNGLVERTEX4SPROC glad_glVertex4s;
-PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv;
-PFNGLNORMAL3DVPROC glad_glNormal3dv;
-PFNGLUNIFORM4IPROC glad_glUniform4i;
-PFNGLACTIVETEXTUREPROC glad_glActiveTexture;
-PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray;
-PFNGLROTATEDPROC glad_glRotated;
-PFNGLROTATEFPROC glad_glRotatef;
-PFNGLVERTEX4IPROC glad_glVertex4i;
-PFNGLREADPIXELSPROC glad_glReadPixels;
-PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv;
-PFNGLLOADNAMEPROC glad_glLoadName;
-PFNGLUNIFORM4FPROC glad_glUniform4f;
-PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample;
-PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays;
-PFNGLSHADEMODELPROC glad_glShadeModel;
-PFNGLMAPGRID1DPROC glad_glMapGrid1d;
-PFNGLGETUNIFORMFVPROC glad_glGetUniformfv;
-PFNGLMAPGRID1FPROC glad_glMapGrid1f;
-PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv;
-PFNGLDISABLECLIENTSTATEPROC glad_glDisableClientState;
-PFNGLMULTITEXCOORD3SVPROC glad_glMultiTexCoord3sv;
-PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex;
-PFNGLSECONDARYCOLORPOINTERPROC glad_glSecondaryColorPointer;
-PFNGLALPHAFUNCPROC glad_glAlphaFunc;
-PFNGLUNIFORM1IVPROC glad_glUniform1iv;
-PFNGLMULTITEXCOORD4IVPROC glad_glMultiTexCoord4iv;
-PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv;
-PFNGLSTENCILFUNCPROC glad_glStencilFunc;
-PFNGLMULTITEXCOORD1FVPROC glad_glMultiTexCoord1fv;
-PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding;
-PFNGLCOLOR4UIVPROC glad_glColor4uiv;
-PFNGLRECTIVPROC glad_glRectiv;
-PFNGLCOLORP4UIPROC glad_glColorP4ui;
-PFNGLRASTERPOS3DVPROC glad_glRasterPos3dv;
-PFNGLEVALMESH2PROC glad_glEvalMesh2;
-PFNGLEVALMESH1PROC glad_glEvalMesh1;
-PFNGLTEXCOORDPOINTERPROC glad_glTexCoordPointer;
-PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv;
-PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv;
-PFNGLEVALCOORD2FVPROC glad_glEvalCoord2fv;
-PFNGLCOLOR4UBVPROC glad_glColor4ubv;
-PFNGLLOADTRANSPOSEMATRIXDPROC glad_glLoadTransposeMatrixd;
-PFNGLLOADTRANSPOSEMATRIXFPROC glad_glLoadTransposeMatrixf;
-PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i;
-PFNGLRASTERPOS2IVPROC glad_glRasterPos2iv;
-PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData;
-PFNGLTEXENVIVPROC glad_glTexEnviv;
-PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate;
-PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui;
-PFNGLGENBUFFERSPROC glad_glGenBuffers;
-PFNGLSELECTBUFFERPROC glad_glSelectBuffer;
-PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv;
-PFNGLPUSHATTRIBPROC glad_glPushAttrib;
-PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer;
-PFNGLBLENDFUNCPROC glad_glBlendFunc;
-PFNGLCREATEPROGRAMPROC glad_glCreateProgram;
-PFNGLTEXIMAGE3DPROC glad_glTexImage3D;
-PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer;
-PFNGLLIGHTIVPROC glad_glLightiv;
-PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex;
-PFNGLTEXGENFVPROC glad_glTexGenfv;
-PFNGLENDPROC glad_glEnd;
-PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers;
-PFNGLSCISSORPROC glad_glScissor;
-PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv;
-PFNGLCLIPPLANEPROC glad_glClipPlane;
-PFNGLPUSHNAMEPROC glad_glPushName;
-PFNGLTEXGENDVPROC glad_glTexGendv;
-PFNGLINDEXUBPROC glad_glIndexub;
-PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv;
-PFNGLSECONDARYCOLOR3IVPROC glad_glSecondaryColor3iv;
-PFNGLRASTERPOS4IPROC glad_glRasterPos4i;
-PFNGLMULTTRANSPOSEMATRIXDPROC glad_glMultTransposeMatrixd;
-PFNGLCLEARCOLORPROC glad_glClearColor;
-PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv;
-PFNGLNORMAL3SPROC glad_glNormal3s;
-PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv;
-PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv;
-PFNGLPOINTPARAMETERIPROC glad_glPointParameteri;
-PFNGLCOLORP4UIVPROC glad_glColorP4uiv;
-PFNGLBLENDCOLORPROC glad_glBlendColor;
-PFNGLWINDOWPOS3DPROC glad_glWindowPos3d;
-PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv;
-PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv;
-PFNGLUNIFORM3UIPROC glad_glUniform3ui;
-PFNGLCOLOR4DVPROC glad_glColor4dv;
-PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv;
-PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv;
-PFNGLUNIFORM2FVPROC glad_glUniform2fv;
-PFNGLSECONDARYCOLOR3UBPROC glad_glSecondaryColor3ub;
-PFNGLSECONDARYCOLOR3UIPROC glad_glSecondaryColor3ui;
-PFNGLTEXCOORD3DVPROC glad_glTexCoord3dv;
-PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv;
-PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange;
-PFNGLNORMAL3IVPROC glad_glNormal3iv;
-PFNGLWINDOWPOS3SPROC glad_glWindowPos3s;
-PFNGLPOINTPARAMETERFPROC glad_glPointParameterf;
-PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv;
-PFNGLWINDOWPOS3IPROC glad_glWindowPos3i;
-PFNGLMULTITEXCOORD4SPROC glad_glMultiTexCoord4s;
-PFNGLWINDOWPOS3FPROC glad_glWindowPos3f;
-PFNGLCOLOR3USPROC glad_glColor3us;
-PFNGLCOLOR3UIVPROC glad_glColor3uiv;
-PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv;
-PFNGLGETLIGHTIVPROC glad_glGetLightiv;
-PFNGLDEPTHFUNCPROC glad_glDepthFunc;
-PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D;
-PFNGLLISTBASEPROC glad_glListBase;
-PFNGLMULTITEXCOORD4FPROC glad_glMultiTexCoord4f;
-PFNGLCOLOR3UBPROC glad_glColor3ub;
-PFNGLMULTITEXCOORD4DPROC glad_glMultiTexCoord4d;
-PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv;
-PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv;
-PFNGLCOLOR3UIPROC glad_glColor3ui;
-PFNGLMULTITEXCOORD4IPROC glad_glMultiTexCoord4i;
-PFNGLGETPOLYGONSTIPPLEPROC glad_glGetPolygonStipple;
-PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync;
-PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui;
-PFNGLMULTITEXCOORD4DVPROC glad_glMultiTexCoord4dv;
-PFNGLCOLORMASKPROC glad_glColorMask;
-PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv;
-PFNGLBLENDEQUATIONPROC glad_glBlendEquation;
-PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation;
-PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv;
-PFNGLRASTERPOS4SPROC glad_glRasterPos4s;
-PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback;
-PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv;
-PFNGLMULTITEXCOORD3DVPROC glad_glMultiTexCoord3dv;
-PFNGLCOLOR4SVPROC glad_glColor4sv;
-PFNGLPOPCLIENTATTRIBPROC glad_glPopClientAttrib;
-PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback;
-PFNGLFOGFPROC glad_glFogf;
-PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv;
-PFNGLISSAMPLERPROC glad_glIsSampler;
-PFNGLVERTEXP3UIPROC glad_glVertexP3ui;
-PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor;
-PFNGLCOLOR3IVPROC glad_glColor3iv;
-PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D;
-PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D;
-PFNGLTEXCOORD1IPROC glad_glTexCoord1i;
-PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus;
-PFNGLTEXCOORD1DPROC glad_glTexCoord1d;
-PFNGLTEXCOORD1FPROC glad_glTexCoord1f;
-PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender;
-PFNGLENABLECLIENTSTATEPROC glad_glEnableClientState;
-PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation;
-PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv;
-PFNGLMULTITEXCOORD2SVPROC glad_glMultiTexCoord2sv;
-PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv;
-PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements;
-PFNGLTEXCOORD1SPROC glad_glTexCoord1s;
-PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase;
-PFNGLBUFFERSUBDATAPROC glad_glBufferSubData;
-PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv;
-PFNGLGENLISTSPROC glad_glGenLists;
-PFNGLCOLOR3BVPROC glad_glColor3bv;
-PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange;
-PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture;
-PFNGLGETTEXGENDVPROC glad_glGetTexGendv;
-PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays;
-PFNGLENDLISTPROC glad_glEndList;
-PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv;
-PFNGLUNIFORM2UIPROC glad_glUniform2ui;
-PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv;
-PFNGLCOLOR3USVPROC glad_glColor3usv;
-PFNGLWINDOWPOS2FVPROC glad_glWindowPos2fv;
-PFNGLDISABLEIPROC glad_glDisablei;
-PFNGLINDEXMASKPROC glad_glIndexMask;
-PFNGLPUSHCLIENTATTRIBPROC glad_glPushClientAttrib;
-PFNGLSHADERSOURCEPROC glad_glShaderSource;
-PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName;
-PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv;
-PFNGLCLEARACCUMPROC glad_glClearAccum;
-PFNGLGETSYNCIVPROC glad_glGetSynciv;
-PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv;
-PFNGLUNIFORM2FPROC glad_glUniform2f;
-PFNGLBEGINQUERYPROC glad_glBeginQuery;
-PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex;
-PFNGLBINDBUFFERPROC glad_glBindBuffer;
-PFNGLMAP2DPROC glad_glMap2d;
-PFNGLMAP2FPROC glad_glMap2f;
-PFNGLVERTEX4DPROC glad_glVertex4d;
-PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv;
-PFNGLTEXCOORD1SVPROC glad_glTexCoord1sv;
-PFNGLBUFFERDATAPROC glad_glBufferData;
-PFNGLEVALPOINT1PROC glad_glEvalPoint1;
-PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv;
-PFNGLTEXCOORD1DVPROC glad_glTexCoord1dv;
-PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui;
-PFNGLGETERRORPROC glad_glGetError;
-PFNGLGETTEXENVIVPROC glad_glGetTexEnviv;
-PFNGLGETPROGRAMIVPROC glad_glGetProgramiv;
-PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui;
-PFNGLGETFLOATVPROC glad_glGetFloatv;
-PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D;
-PFNGLMULTITEXCOORD2FVPROC glad_glMultiTexCoord2fv;
-PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv;
-PFNGLEVALCOORD1DPROC glad_glEvalCoord1d;
-PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv;
-PFNGLEVALCOORD1FPROC glad_glEvalCoord1f;
-PFNGLPIXELMAPFVPROC glad_glPixelMapfv;
-PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv;
-PFNGLGETPIXELMAPUSVPROC glad_glGetPixelMapusv;
-PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv;
-PFNGLGETINTEGERVPROC glad_glGetIntegerv;
-PFNGLACCUMPROC glad_glAccum;
-PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv;
-PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv;
-PFNGLRASTERPOS4DVPROC glad_glRasterPos4dv;
-PFNGLTEXCOORD2IVPROC glad_glTexCoord2iv;
-PFNGLISQUERYPROC glad_glIsQuery;
-PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv;
-PFNGLWINDOWPOS3DVPROC glad_glWindowPos3dv;
-PFNGLTEXIMAGE2DPROC glad_glTexImage2D;
-PFNGLSTENCILMASKPROC glad_glStencilMask;
-PFNGLDRAWPIXELSPROC glad_glDrawPixels;
-PFNGLMULTMATRIXDPROC glad_glMultMatrixd;
-PFNGLMULTMATRIXFPROC glad_glMultMatrixf;
-PFNGLISTEXTUREPROC glad_glIsTexture;
-PFNGLGETMATERIALIVPROC glad_glGetMaterialiv;
-PFNGLUNIFORM1FVPROC glad_glUniform1fv;
-PFNGLLOADMATRIXFPROC glad_glLoadMatrixf;
-PFNGLLOADMATRIXDPROC glad_glLoadMatrixd;
-PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv;
-PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv;
-PFNGLVERTEX4FPROC glad_glVertex4f;
-PFNGLRECTSVPROC glad_glRectsv;
-PFNGLCOLOR4USVPROC glad_glColor4usv;
-PFNGLPOLYGONSTIPPLEPROC glad_glPolygonStipple;
-PFNGLINTERLEAVEDARRAYSPROC glad_glInterleavedArrays;
-PFNGLNORMAL3IPROC glad_glNormal3i;
-PFNGLNORMAL3FPROC glad_glNormal3f;
-PFNGLNORMAL3DPROC glad_glNormal3d;
-PFNGLNORMAL3BPROC glad_glNormal3b;
-PFNGLPIXELMAPUSVPROC glad_glPixelMapusv;
-PFNGLGETTEXGENIVPROC glad_glGetTexGeniv;
-PFNGLARRAYELEMENTPROC glad_glArrayElement;
-PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData;
-PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv;
-PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d;
-PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f;
-PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv;
-PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v;
-PFNGLDEPTHMASKPROC glad_glDepthMask;
-PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s;
-PFNGLCOLOR3FVPROC glad_glColor3fv;
-PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample;
-PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv;
-PFNGLUNIFORM4FVPROC glad_glUniform4fv;
-PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform;
-PFNGLCOLORPOINTERPROC glad_glColorPointer;
-PFNGLFRONTFACEPROC glad_glFrontFace;
-PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v;
-PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv;
+
+int gladHasExtension(const char *ext) {
+    return has_ext(ext);
+}
+
+int gladGetExtensionCount(void) {
+    return exts != NULL ? exts->count : 0;
+}
+
+const char *gladGetExtension(int index) {
+    if (exts == NULL || index < 0 || index >= exts->count) {
+        return NULL;
+    }
+    return exts->names[index];
+}
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_1_0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_1_1;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_1_2;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_1_3;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_1_4;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_1_5;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_2_0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_2_1;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_3_0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_3_1;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_3_2;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_3_3;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_4_0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_4_1;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_4_2;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_4_3;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_4_4;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_4_5;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_4_6;
+GLAD_THREAD_LOCAL int GLAD_GL_ARB_buffer_storage;
+GLAD_THREAD_LOCAL int GLAD_GL_ARB_direct_state_access;
+GLAD_THREAD_LOCAL int GLAD_GL_ARB_get_program_binary;
+GLAD_THREAD_LOCAL int GLAD_GL_ARB_gl_spirv;
+GLAD_THREAD_LOCAL int GLAD_GL_ARB_multi_draw_indirect;
+GLAD_THREAD_LOCAL int GLAD_GL_ARB_separate_shader_objects;
+GLAD_THREAD_LOCAL int GLAD_GL_KHR_debug;
+GLAD_THREAD_LOCAL int GLAD_GL_KHR_parallel_shader_compile;
+#ifndef GLAD_TRIMMED
+GLAD_THREAD_LOCAL PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS2SPROC glad_glWindowPos2s;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS2IPROC glad_glWindowPos2i;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS2FPROC glad_glWindowPos2f;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS2DPROC glad_glWindowPos2d;
+GLAD_THREAD_LOCAL PFNGLVERTEX2FVPROC glad_glVertex2fv;
+GLAD_THREAD_LOCAL PFNGLINDEXIPROC glad_glIndexi;
+GLAD_THREAD_LOCAL PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer;
+GLAD_THREAD_LOCAL PFNGLRECTDVPROC glad_glRectdv;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D;
+GLAD_THREAD_LOCAL PFNGLEVALCOORD2DPROC glad_glEvalCoord2d;
+GLAD_THREAD_LOCAL PFNGLEVALCOORD2FPROC glad_glEvalCoord2f;
+GLAD_THREAD_LOCAL PFNGLINDEXDPROC glad_glIndexd;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv;
+GLAD_THREAD_LOCAL PFNGLINDEXFPROC glad_glIndexf;
+GLAD_THREAD_LOCAL PFNGLBINDSAMPLERPROC glad_glBindSampler;
+GLAD_THREAD_LOCAL PFNGLLINEWIDTHPROC glad_glLineWidth;
+GLAD_THREAD_LOCAL PFNGLCOLORP3UIVPROC glad_glColorP3uiv;
+GLAD_THREAD_LOCAL PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v;
+GLAD_THREAD_LOCAL PFNGLGETMAPFVPROC glad_glGetMapfv;
+GLAD_THREAD_LOCAL PFNGLINDEXSPROC glad_glIndexs;
+GLAD_THREAD_LOCAL PFNGLCOMPILESHADERPROC glad_glCompileShader;
+GLAD_THREAD_LOCAL PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS2IVPROC glad_glWindowPos2iv;
+GLAD_THREAD_LOCAL PFNGLINDEXFVPROC glad_glIndexfv;
+GLAD_THREAD_LOCAL PFNGLFOGIVPROC glad_glFogiv;
+GLAD_THREAD_LOCAL PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS2FVPROC glad_glRasterPos2fv;
+GLAD_THREAD_LOCAL PFNGLLIGHTMODELIVPROC glad_glLightModeliv;
+GLAD_THREAD_LOCAL PFNGLCOLOR4UIPROC glad_glColor4ui;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3FVPROC glad_glSecondaryColor3fv;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui;
+GLAD_THREAD_LOCAL PFNGLFOGFVPROC glad_glFogfv;
+GLAD_THREAD_LOCAL PFNGLVERTEXP4UIPROC glad_glVertexP4ui;
+GLAD_THREAD_LOCAL PFNGLENABLEIPROC glad_glEnablei;
+GLAD_THREAD_LOCAL PFNGLVERTEX4IVPROC glad_glVertex4iv;
+GLAD_THREAD_LOCAL PFNGLEVALCOORD1FVPROC glad_glEvalCoord1fv;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS2SVPROC glad_glWindowPos2sv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui;
+GLAD_THREAD_LOCAL PFNGLCREATESHADERPROC glad_glCreateShader;
+GLAD_THREAD_LOCAL PFNGLISBUFFERPROC glad_glIsBuffer;
+GLAD_THREAD_LOCAL PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv;
+GLAD_THREAD_LOCAL PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers;
+GLAD_THREAD_LOCAL PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f;
+GLAD_THREAD_LOCAL PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate;
+GLAD_THREAD_LOCAL PFNGLVERTEX4FVPROC glad_glVertex4fv;
+GLAD_THREAD_LOCAL PFNGLBINDTEXTUREPROC glad_glBindTexture;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD2FVPROC glad_glTexCoord2fv;
+GLAD_THREAD_LOCAL PFNGLSAMPLEMASKIPROC glad_glSampleMaski;
+GLAD_THREAD_LOCAL PFNGLVERTEXP2UIPROC glad_glVertexP2ui;
+GLAD_THREAD_LOCAL PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD4FVPROC glad_glTexCoord4fv;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv;
+GLAD_THREAD_LOCAL PFNGLPOINTSIZEPROC glad_glPointSize;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv;
+GLAD_THREAD_LOCAL PFNGLDELETEPROGRAMPROC glad_glDeleteProgram;
+GLAD_THREAD_LOCAL PFNGLCOLOR4BVPROC glad_glColor4bv;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS2FPROC glad_glRasterPos2f;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS2DPROC glad_glRasterPos2d;
+GLAD_THREAD_LOCAL PFNGLLOADIDENTITYPROC glad_glLoadIdentity;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS2IPROC glad_glRasterPos2i;
+GLAD_THREAD_LOCAL PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv;
+GLAD_THREAD_LOCAL PFNGLCOLOR3BPROC glad_glColor3b;
+GLAD_THREAD_LOCAL PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv;
+GLAD_THREAD_LOCAL PFNGLEDGEFLAGPROC glad_glEdgeFlag;
+GLAD_THREAD_LOCAL PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers;
+GLAD_THREAD_LOCAL PFNGLVERTEX3DPROC glad_glVertex3d;
+GLAD_THREAD_LOCAL PFNGLVERTEX3FPROC glad_glVertex3f;
+GLAD_THREAD_LOCAL PFNGLVERTEX3IPROC glad_glVertex3i;
+GLAD_THREAD_LOCAL PFNGLCOLOR3IPROC glad_glColor3i;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3FPROC glad_glUniform3f;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv;
+GLAD_THREAD_LOCAL PFNGLCOLOR3SPROC glad_glColor3s;
+GLAD_THREAD_LOCAL PFNGLVERTEX3SPROC glad_glVertex3s;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui;
+GLAD_THREAD_LOCAL PFNGLCOLORMASKIPROC glad_glColorMaski;
+GLAD_THREAD_LOCAL PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD1IVPROC glad_glTexCoord1iv;
+GLAD_THREAD_LOCAL PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui;
+GLAD_THREAD_LOCAL PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv;
+GLAD_THREAD_LOCAL PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f;
+GLAD_THREAD_LOCAL PFNGLVERTEX2IVPROC glad_glVertex2iv;
+GLAD_THREAD_LOCAL PFNGLCOLOR3SVPROC glad_glColor3sv;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv;
+GLAD_THREAD_LOCAL PFNGLNORMALPOINTERPROC glad_glNormalPointer;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv;
+GLAD_THREAD_LOCAL PFNGLVERTEX4SVPROC glad_glVertex4sv;
+GLAD_THREAD_LOCAL PFNGLPASSTHROUGHPROC glad_glPassThrough;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui;
+GLAD_THREAD_LOCAL PFNGLFOGIPROC glad_glFogi;
+GLAD_THREAD_LOCAL PFNGLBEGINPROC glad_glBegin;
+GLAD_THREAD_LOCAL PFNGLEVALCOORD2DVPROC glad_glEvalCoord2dv;
+GLAD_THREAD_LOCAL PFNGLCOLOR3UBVPROC glad_glColor3ubv;
+GLAD_THREAD_LOCAL PFNGLVERTEXPOINTERPROC glad_glVertexPointer;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3UIVPROC glad_glSecondaryColor3uiv;
+GLAD_THREAD_LOCAL PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers;
+GLAD_THREAD_LOCAL PFNGLDRAWARRAYSPROC glad_glDrawArrays;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1UIPROC glad_glUniform1ui;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD1DPROC glad_glMultiTexCoord1d;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD1FPROC glad_glMultiTexCoord1f;
+GLAD_THREAD_LOCAL PFNGLLIGHTFVPROC glad_glLightfv;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d;
+GLAD_THREAD_LOCAL PFNGLCLEARPROC glad_glClear;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD1IPROC glad_glMultiTexCoord1i;
+GLAD_THREAD_LOCAL PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD1SPROC glad_glMultiTexCoord1s;
+GLAD_THREAD_LOCAL PFNGLISENABLEDPROC glad_glIsEnabled;
+GLAD_THREAD_LOCAL PFNGLSTENCILOPPROC glad_glStencilOp;
+GLAD_THREAD_LOCAL PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv;
+GLAD_THREAD_LOCAL PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D;
+GLAD_THREAD_LOCAL PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv;
+GLAD_THREAD_LOCAL PFNGLTRANSLATEFPROC glad_glTranslatef;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub;
+GLAD_THREAD_LOCAL PFNGLTRANSLATEDPROC glad_glTranslated;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD3SVPROC glad_glTexCoord3sv;
+GLAD_THREAD_LOCAL PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation;
+GLAD_THREAD_LOCAL PFNGLTEXIMAGE1DPROC glad_glTexImage1D;
+GLAD_THREAD_LOCAL PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv;
+GLAD_THREAD_LOCAL PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3BVPROC glad_glSecondaryColor3bv;
+GLAD_THREAD_LOCAL PFNGLGETMATERIALFVPROC glad_glGetMaterialfv;
+GLAD_THREAD_LOCAL PFNGLGETTEXIMAGEPROC glad_glGetTexImage;
+GLAD_THREAD_LOCAL PFNGLFOGCOORDFVPROC glad_glFogCoordfv;
+GLAD_THREAD_LOCAL PFNGLPIXELMAPUIVPROC glad_glPixelMapuiv;
+GLAD_THREAD_LOCAL PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog;
+GLAD_THREAD_LOCAL PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v;
+GLAD_THREAD_LOCAL PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers;
+GLAD_THREAD_LOCAL PFNGLINDEXSVPROC glad_glIndexsv;
+GLAD_THREAD_LOCAL PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders;
+GLAD_THREAD_LOCAL PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer;
+GLAD_THREAD_LOCAL PFNGLVERTEX3IVPROC glad_glVertex3iv;
+GLAD_THREAD_LOCAL PFNGLBITMAPPROC glad_glBitmap;
+GLAD_THREAD_LOCAL PFNGLMATERIALIPROC glad_glMateriali;
+GLAD_THREAD_LOCAL PFNGLISVERTEXARRAYPROC glad_glIsVertexArray;
+GLAD_THREAD_LOCAL PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray;
+GLAD_THREAD_LOCAL PFNGLGETQUERYIVPROC glad_glGetQueryiv;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD4FPROC glad_glTexCoord4f;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD4DPROC glad_glTexCoord4d;
+GLAD_THREAD_LOCAL PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD4IPROC glad_glTexCoord4i;
+GLAD_THREAD_LOCAL PFNGLMATERIALFPROC glad_glMaterialf;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD4SPROC glad_glTexCoord4s;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices;
+GLAD_THREAD_LOCAL PFNGLISSHADERPROC glad_glIsShader;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD2SPROC glad_glMultiTexCoord2s;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv;
+GLAD_THREAD_LOCAL PFNGLVERTEX3DVPROC glad_glVertex3dv;
+GLAD_THREAD_LOCAL PFNGLGETINTEGER64VPROC glad_glGetInteger64v;
+GLAD_THREAD_LOCAL PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv;
+GLAD_THREAD_LOCAL PFNGLENABLEPROC glad_glEnable;
+GLAD_THREAD_LOCAL PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv;
+GLAD_THREAD_LOCAL PFNGLCOLOR4FVPROC glad_glColor4fv;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD1FVPROC glad_glTexCoord1fv;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD2SVPROC glad_glTexCoord2sv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD1DVPROC glad_glMultiTexCoord1dv;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD2IPROC glad_glMultiTexCoord2i;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD3FVPROC glad_glTexCoord3fv;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3USVPROC glad_glSecondaryColor3usv;
+GLAD_THREAD_LOCAL PFNGLTEXGENFPROC glad_glTexGenf;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui;
+GLAD_THREAD_LOCAL PFNGLGETPOINTERVPROC glad_glGetPointerv;
+GLAD_THREAD_LOCAL PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv;
+GLAD_THREAD_LOCAL PFNGLNORMAL3FVPROC glad_glNormal3fv;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3SPROC glad_glSecondaryColor3s;
+GLAD_THREAD_LOCAL PFNGLDEPTHRANGEPROC glad_glDepthRange;
+GLAD_THREAD_LOCAL PFNGLFRUSTUMPROC glad_glFrustum;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD4SVPROC glad_glMultiTexCoord4sv;
+GLAD_THREAD_LOCAL PFNGLDRAWBUFFERPROC glad_glDrawBuffer;
+GLAD_THREAD_LOCAL PFNGLPUSHMATRIXPROC glad_glPushMatrix;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS3FVPROC glad_glRasterPos3fv;
+GLAD_THREAD_LOCAL PFNGLORTHOPROC glad_glOrtho;
+GLAD_THREAD_LOCAL PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS3SVPROC glad_glWindowPos3sv;
+GLAD_THREAD_LOCAL PFNGLCLEARINDEXPROC glad_glClearIndex;
+GLAD_THREAD_LOCAL PFNGLMAP1DPROC glad_glMap1d;
+GLAD_THREAD_LOCAL PFNGLMAP1FPROC glad_glMap1f;
+GLAD_THREAD_LOCAL PFNGLFLUSHPROC glad_glFlush;
+GLAD_THREAD_LOCAL PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv;
+GLAD_THREAD_LOCAL PFNGLINDEXIVPROC glad_glIndexiv;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS3SVPROC glad_glRasterPos3sv;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv;
+GLAD_THREAD_LOCAL PFNGLPIXELZOOMPROC glad_glPixelZoom;
+GLAD_THREAD_LOCAL PFNGLFENCESYNCPROC glad_glFenceSync;
+GLAD_THREAD_LOCAL PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays;
+GLAD_THREAD_LOCAL PFNGLCOLORP3UIPROC glad_glColorP3ui;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv;
+GLAD_THREAD_LOCAL PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender;
+GLAD_THREAD_LOCAL PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex;
+GLAD_THREAD_LOCAL PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv;
+GLAD_THREAD_LOCAL PFNGLLIGHTIPROC glad_glLighti;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv;
+GLAD_THREAD_LOCAL PFNGLLIGHTFPROC glad_glLightf;
+GLAD_THREAD_LOCAL PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation;
+GLAD_THREAD_LOCAL PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate;
+GLAD_THREAD_LOCAL PFNGLGENSAMPLERSPROC glad_glGenSamplers;
+GLAD_THREAD_LOCAL PFNGLCLAMPCOLORPROC glad_glClampColor;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4IVPROC glad_glUniform4iv;
+GLAD_THREAD_LOCAL PFNGLCLEARSTENCILPROC glad_glClearStencil;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD3FVPROC glad_glMultiTexCoord3fv;
+GLAD_THREAD_LOCAL PFNGLGETPIXELMAPUIVPROC glad_glGetPixelMapuiv;
+GLAD_THREAD_LOCAL PFNGLGENTEXTURESPROC glad_glGenTextures;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD4IVPROC glad_glTexCoord4iv;
+GLAD_THREAD_LOCAL PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv;
+GLAD_THREAD_LOCAL PFNGLINDEXPOINTERPROC glad_glIndexPointer;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv;
+GLAD_THREAD_LOCAL PFNGLISSYNCPROC glad_glIsSync;
+GLAD_THREAD_LOCAL PFNGLVERTEX2FPROC glad_glVertex2f;
+GLAD_THREAD_LOCAL PFNGLVERTEX2DPROC glad_glVertex2d;
+GLAD_THREAD_LOCAL PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2IPROC glad_glUniform2i;
+GLAD_THREAD_LOCAL PFNGLMAPGRID2DPROC glad_glMapGrid2d;
+GLAD_THREAD_LOCAL PFNGLMAPGRID2FPROC glad_glMapGrid2f;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui;
+GLAD_THREAD_LOCAL PFNGLVERTEX2IPROC glad_glVertex2i;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer;
+GLAD_THREAD_LOCAL PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer;
+GLAD_THREAD_LOCAL PFNGLVERTEX2SPROC glad_glVertex2s;
+GLAD_THREAD_LOCAL PFNGLNORMAL3BVPROC glad_glNormal3bv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv;
+GLAD_THREAD_LOCAL PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3SVPROC glad_glSecondaryColor3sv;
+GLAD_THREAD_LOCAL PFNGLVERTEX3SVPROC glad_glVertex3sv;
+GLAD_THREAD_LOCAL PFNGLGENQUERIESPROC glad_glGenQueries;
+GLAD_THREAD_LOCAL PFNGLGETPIXELMAPFVPROC glad_glGetPixelMapfv;
+GLAD_THREAD_LOCAL PFNGLTEXENVFPROC glad_glTexEnvf;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui;
+GLAD_THREAD_LOCAL PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D;
+GLAD_THREAD_LOCAL PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v;
+GLAD_THREAD_LOCAL PFNGLFOGCOORDDPROC glad_glFogCoordd;
+GLAD_THREAD_LOCAL PFNGLFOGCOORDFPROC glad_glFogCoordf;
+GLAD_THREAD_LOCAL PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D;
+GLAD_THREAD_LOCAL PFNGLTEXENVIPROC glad_glTexEnvi;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD1IVPROC glad_glMultiTexCoord1iv;
+GLAD_THREAD_LOCAL PFNGLISENABLEDIPROC glad_glIsEnabledi;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i;
+GLAD_THREAD_LOCAL PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD2DVPROC glad_glMultiTexCoord2dv;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2IVPROC glad_glUniform2iv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4UIVPROC glad_glUniform4uiv;
+GLAD_THREAD_LOCAL PFNGLMATRIXMODEPROC glad_glMatrixMode;
+GLAD_THREAD_LOCAL PFNGLFEEDBACKBUFFERPROC glad_glFeedbackBuffer;
+GLAD_THREAD_LOCAL PFNGLGETMAPIVPROC glad_glGetMapiv;
+GLAD_THREAD_LOCAL PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D;
+GLAD_THREAD_LOCAL PFNGLGETSHADERIVPROC glad_glGetShaderiv;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD2DPROC glad_glMultiTexCoord2d;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD2FPROC glad_glMultiTexCoord2f;
+GLAD_THREAD_LOCAL PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation;
+GLAD_THREAD_LOCAL PFNGLPRIORITIZETEXTURESPROC glad_glPrioritizeTextures;
+GLAD_THREAD_LOCAL PFNGLCALLLISTPROC glad_glCallList;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3UBVPROC glad_glSecondaryColor3ubv;
+GLAD_THREAD_LOCAL PFNGLGETDOUBLEVPROC glad_glGetDoublev;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD3IVPROC glad_glMultiTexCoord3iv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d;
+GLAD_THREAD_LOCAL PFNGLLIGHTMODELFPROC glad_glLightModelf;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMIVPROC glad_glGetUniformiv;
+GLAD_THREAD_LOCAL PFNGLVERTEX2SVPROC glad_glVertex2sv;
+GLAD_THREAD_LOCAL PFNGLLIGHTMODELIPROC glad_glLightModeli;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS3IVPROC glad_glWindowPos3iv;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3FVPROC glad_glUniform3fv;
+GLAD_THREAD_LOCAL PFNGLPIXELSTOREIPROC glad_glPixelStorei;
+GLAD_THREAD_LOCAL PFNGLCALLLISTSPROC glad_glCallLists;
+GLAD_THREAD_LOCAL PFNGLMAPBUFFERPROC glad_glMapBuffer;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3DPROC glad_glSecondaryColor3d;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD3IPROC glad_glTexCoord3i;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD4FVPROC glad_glMultiTexCoord4fv;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS3IPROC glad_glRasterPos3i;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3BPROC glad_glSecondaryColor3b;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS3DPROC glad_glRasterPos3d;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS3FPROC glad_glRasterPos3f;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD3FPROC glad_glTexCoord3f;
+GLAD_THREAD_LOCAL PFNGLDELETESYNCPROC glad_glDeleteSync;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD3DPROC glad_glTexCoord3d;
+GLAD_THREAD_LOCAL PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv;
+GLAD_THREAD_LOCAL PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD3SPROC glad_glTexCoord3s;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3IVPROC glad_glUniform3iv;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS3SPROC glad_glRasterPos3s;
+GLAD_THREAD_LOCAL PFNGLPOLYGONMODEPROC glad_glPolygonMode;
+GLAD_THREAD_LOCAL PFNGLDRAWBUFFERSPROC glad_glDrawBuffers;
+GLAD_THREAD_LOCAL PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv;
+GLAD_THREAD_LOCAL PFNGLARETEXTURESRESIDENTPROC glad_glAreTexturesResident;
+GLAD_THREAD_LOCAL PFNGLISLISTPROC glad_glIsList;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS2SVPROC glad_glRasterPos2sv;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS4SVPROC glad_glRasterPos4sv;
+GLAD_THREAD_LOCAL PFNGLCOLOR4SPROC glad_glColor4s;
+GLAD_THREAD_LOCAL PFNGLUSEPROGRAMPROC glad_glUseProgram;
+GLAD_THREAD_LOCAL PFNGLLINESTIPPLEPROC glad_glLineStipple;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD1SVPROC glad_glMultiTexCoord1sv;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog;
+GLAD_THREAD_LOCAL PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD2IVPROC glad_glMultiTexCoord2iv;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv;
+GLAD_THREAD_LOCAL PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray;
+GLAD_THREAD_LOCAL PFNGLCOLOR4BPROC glad_glColor4b;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3FPROC glad_glSecondaryColor3f;
+GLAD_THREAD_LOCAL PFNGLCOLOR4FPROC glad_glColor4f;
+GLAD_THREAD_LOCAL PFNGLCOLOR4DPROC glad_glColor4d;
+GLAD_THREAD_LOCAL PFNGLCOLOR4IPROC glad_glColor4i;
+GLAD_THREAD_LOCAL PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv;
+GLAD_THREAD_LOCAL PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS3IVPROC glad_glRasterPos3iv;
+GLAD_THREAD_LOCAL PFNGLVERTEX2DVPROC glad_glVertex2dv;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD4SVPROC glad_glTexCoord4sv;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2UIVPROC glad_glUniform2uiv;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D;
+GLAD_THREAD_LOCAL PFNGLFINISHPROC glad_glFinish;
+GLAD_THREAD_LOCAL PFNGLGETBOOLEANVPROC glad_glGetBooleanv;
+GLAD_THREAD_LOCAL PFNGLDELETESHADERPROC glad_glDeleteShader;
+GLAD_THREAD_LOCAL PFNGLDRAWELEMENTSPROC glad_glDrawElements;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS2SPROC glad_glRasterPos2s;
+GLAD_THREAD_LOCAL PFNGLGETMAPDVPROC glad_glGetMapdv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv;
+GLAD_THREAD_LOCAL PFNGLMATERIALFVPROC glad_glMaterialfv;
+GLAD_THREAD_LOCAL PFNGLVIEWPORTPROC glad_glViewport;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1UIVPROC glad_glUniform1uiv;
+GLAD_THREAD_LOCAL PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings;
+GLAD_THREAD_LOCAL PFNGLINDEXDVPROC glad_glIndexdv;
+GLAD_THREAD_LOCAL PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD3IVPROC glad_glTexCoord3iv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i;
+GLAD_THREAD_LOCAL PFNGLCLEARDEPTHPROC glad_glClearDepth;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv;
+GLAD_THREAD_LOCAL PFNGLTEXPARAMETERFPROC glad_glTexParameterf;
+GLAD_THREAD_LOCAL PFNGLTEXPARAMETERIPROC glad_glTexParameteri;
+GLAD_THREAD_LOCAL PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource;
+GLAD_THREAD_LOCAL PFNGLTEXBUFFERPROC glad_glTexBuffer;
+GLAD_THREAD_LOCAL PFNGLPOPNAMEPROC glad_glPopName;
+GLAD_THREAD_LOCAL PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram;
+GLAD_THREAD_LOCAL PFNGLPIXELSTOREFPROC glad_glPixelStoref;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3UIVPROC glad_glUniform3uiv;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS4FVPROC glad_glRasterPos4fv;
+GLAD_THREAD_LOCAL PFNGLEVALCOORD1DVPROC glad_glEvalCoord1dv;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv;
+GLAD_THREAD_LOCAL PFNGLRECTIPROC glad_glRecti;
+GLAD_THREAD_LOCAL PFNGLCOLOR4UBPROC glad_glColor4ub;
+GLAD_THREAD_LOCAL PFNGLMULTTRANSPOSEMATRIXFPROC glad_glMultTransposeMatrixf;
+GLAD_THREAD_LOCAL PFNGLRECTFPROC glad_glRectf;
+GLAD_THREAD_LOCAL PFNGLRECTDPROC glad_glRectd;
+GLAD_THREAD_LOCAL PFNGLNORMAL3SVPROC glad_glNormal3sv;
+GLAD_THREAD_LOCAL PFNGLNEWLISTPROC glad_glNewList;
+GLAD_THREAD_LOCAL PFNGLCOLOR4USPROC glad_glColor4us;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv;
+GLAD_THREAD_LOCAL PFNGLLINKPROGRAMPROC glad_glLinkProgram;
+GLAD_THREAD_LOCAL PFNGLHINTPROC glad_glHint;
+GLAD_THREAD_LOCAL PFNGLRECTSPROC glad_glRects;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD2DVPROC glad_glTexCoord2dv;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS4IVPROC glad_glRasterPos4iv;
+GLAD_THREAD_LOCAL PFNGLGETSTRINGPROC glad_glGetString;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv;
+GLAD_THREAD_LOCAL PFNGLEDGEFLAGVPROC glad_glEdgeFlagv;
+GLAD_THREAD_LOCAL PFNGLDETACHSHADERPROC glad_glDetachShader;
+GLAD_THREAD_LOCAL PFNGLSCALEFPROC glad_glScalef;
+GLAD_THREAD_LOCAL PFNGLENDQUERYPROC glad_glEndQuery;
+GLAD_THREAD_LOCAL PFNGLSCALEDPROC glad_glScaled;
+GLAD_THREAD_LOCAL PFNGLEDGEFLAGPOINTERPROC glad_glEdgeFlagPointer;
+GLAD_THREAD_LOCAL PFNGLCOPYPIXELSPROC glad_glCopyPixels;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui;
+GLAD_THREAD_LOCAL PFNGLPOPATTRIBPROC glad_glPopAttrib;
+GLAD_THREAD_LOCAL PFNGLDELETETEXTURESPROC glad_glDeleteTextures;
+GLAD_THREAD_LOCAL PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate;
+GLAD_THREAD_LOCAL PFNGLDELETEQUERIESPROC glad_glDeleteQueries;
+GLAD_THREAD_LOCAL PFNGLNORMALP3UIVPROC glad_glNormalP3uiv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d;
+GLAD_THREAD_LOCAL PFNGLINITNAMESPROC glad_glInitNames;
+GLAD_THREAD_LOCAL PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v;
+GLAD_THREAD_LOCAL PFNGLCOLOR3DVPROC glad_glColor3dv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i;
+GLAD_THREAD_LOCAL PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv;
+GLAD_THREAD_LOCAL PFNGLWAITSYNCPROC glad_glWaitSync;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s;
+GLAD_THREAD_LOCAL PFNGLCOLORMATERIALPROC glad_glColorMaterial;
+GLAD_THREAD_LOCAL PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage;
+GLAD_THREAD_LOCAL PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri;
+GLAD_THREAD_LOCAL PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1FPROC glad_glUniform1f;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv;
+GLAD_THREAD_LOCAL PFNGLRENDERMODEPROC glad_glRenderMode;
+GLAD_THREAD_LOCAL PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS2DVPROC glad_glWindowPos2dv;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1IPROC glad_glUniform1i;
+GLAD_THREAD_LOCAL PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3IPROC glad_glUniform3i;
+GLAD_THREAD_LOCAL PFNGLPIXELTRANSFERIPROC glad_glPixelTransferi;
+GLAD_THREAD_LOCAL PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D;
+GLAD_THREAD_LOCAL PFNGLDISABLEPROC glad_glDisable;
+GLAD_THREAD_LOCAL PFNGLLOGICOPPROC glad_glLogicOp;
+GLAD_THREAD_LOCAL PFNGLEVALPOINT2PROC glad_glEvalPoint2;
+GLAD_THREAD_LOCAL PFNGLPIXELTRANSFERFPROC glad_glPixelTransferf;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3IPROC glad_glSecondaryColor3i;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4UIPROC glad_glUniform4ui;
+GLAD_THREAD_LOCAL PFNGLCOLOR3FPROC glad_glColor3f;
+GLAD_THREAD_LOCAL PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer;
+GLAD_THREAD_LOCAL PFNGLGETTEXENVFVPROC glad_glGetTexEnvfv;
+GLAD_THREAD_LOCAL PFNGLRECTFVPROC glad_glRectfv;
+GLAD_THREAD_LOCAL PFNGLCULLFACEPROC glad_glCullFace;
+GLAD_THREAD_LOCAL PFNGLGETLIGHTFVPROC glad_glGetLightfv;
+GLAD_THREAD_LOCAL PFNGLCOLOR3DPROC glad_glColor3d;
+GLAD_THREAD_LOCAL PFNGLTEXGENDPROC glad_glTexGend;
+GLAD_THREAD_LOCAL PFNGLTEXGENIPROC glad_glTexGeni;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD3SPROC glad_glMultiTexCoord3s;
+GLAD_THREAD_LOCAL PFNGLGETSTRINGIPROC glad_glGetStringi;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD3IPROC glad_glMultiTexCoord3i;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD3FPROC glad_glMultiTexCoord3f;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD3DPROC glad_glMultiTexCoord3d;
+GLAD_THREAD_LOCAL PFNGLATTACHSHADERPROC glad_glAttachShader;
+GLAD_THREAD_LOCAL PFNGLFOGCOORDDVPROC glad_glFogCoorddv;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv;
+GLAD_THREAD_LOCAL PFNGLGETTEXGENFVPROC glad_glGetTexGenfv;
+GLAD_THREAD_LOCAL PFNGLQUERYCOUNTERPROC glad_glQueryCounter;
+GLAD_THREAD_LOCAL PFNGLFOGCOORDPOINTERPROC glad_glFogCoordPointer;
+GLAD_THREAD_LOCAL PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex;
+GLAD_THREAD_LOCAL PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D;
+GLAD_THREAD_LOCAL PFNGLTEXGENIVPROC glad_glTexGeniv;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS2DVPROC glad_glRasterPos2dv;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3DVPROC glad_glSecondaryColor3dv;
+GLAD_THREAD_LOCAL PFNGLCLIENTACTIVETEXTUREPROC glad_glClientActiveTexture;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3USPROC glad_glSecondaryColor3us;
+GLAD_THREAD_LOCAL PFNGLNORMALP3UIPROC glad_glNormalP3ui;
+GLAD_THREAD_LOCAL PFNGLTEXENVFVPROC glad_glTexEnvfv;
+GLAD_THREAD_LOCAL PFNGLREADBUFFERPROC glad_glReadBuffer;
+GLAD_THREAD_LOCAL PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv;
+GLAD_THREAD_LOCAL PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced;
+GLAD_THREAD_LOCAL PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS3FVPROC glad_glWindowPos3fv;
+GLAD_THREAD_LOCAL PFNGLLIGHTMODELFVPROC glad_glLightModelfv;
+GLAD_THREAD_LOCAL PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv;
+GLAD_THREAD_LOCAL PFNGLDELETELISTSPROC glad_glDeleteLists;
+GLAD_THREAD_LOCAL PFNGLGETCLIPPLANEPROC glad_glGetClipPlane;
+GLAD_THREAD_LOCAL PFNGLVERTEX4DVPROC glad_glVertex4dv;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD2DPROC glad_glTexCoord2d;
+GLAD_THREAD_LOCAL PFNGLPOPMATRIXPROC glad_glPopMatrix;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD2FPROC glad_glTexCoord2f;
+GLAD_THREAD_LOCAL PFNGLCOLOR4IVPROC glad_glColor4iv;
+GLAD_THREAD_LOCAL PFNGLINDEXUBVPROC glad_glIndexubv;
+GLAD_THREAD_LOCAL PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD2IPROC glad_glTexCoord2i;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS4DPROC glad_glRasterPos4d;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS4FPROC glad_glRasterPos4f;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD2SPROC glad_glTexCoord2s;
+GLAD_THREAD_LOCAL PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer;
+GLAD_THREAD_LOCAL PFNGLVERTEX3FVPROC glad_glVertex3fv;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD4DVPROC glad_glTexCoord4dv;
+GLAD_THREAD_LOCAL PFNGLMATERIALIVPROC glad_glMaterialiv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv;
+GLAD_THREAD_LOCAL PFNGLISPROGRAMPROC glad_glIsProgram;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv;
+GLAD_THREAD_LOCAL PFNGLVERTEX4SPROC glad_glVertex4s;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv;
+GLAD_THREAD_LOCAL PFNGLNORMAL3DVPROC glad_glNormal3dv;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4IPROC glad_glUniform4i;
+GLAD_THREAD_LOCAL PFNGLACTIVETEXTUREPROC glad_glActiveTexture;
+GLAD_THREAD_LOCAL PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray;
+GLAD_THREAD_LOCAL PFNGLROTATEDPROC glad_glRotated;
+GLAD_THREAD_LOCAL PFNGLROTATEFPROC glad_glRotatef;
+GLAD_THREAD_LOCAL PFNGLVERTEX4IPROC glad_glVertex4i;
+GLAD_THREAD_LOCAL PFNGLREADPIXELSPROC glad_glReadPixels;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv;
+GLAD_THREAD_LOCAL PFNGLLOADNAMEPROC glad_glLoadName;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4FPROC glad_glUniform4f;
+GLAD_THREAD_LOCAL PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample;
+GLAD_THREAD_LOCAL PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays;
+GLAD_THREAD_LOCAL PFNGLSHADEMODELPROC glad_glShadeModel;
+GLAD_THREAD_LOCAL PFNGLMAPGRID1DPROC glad_glMapGrid1d;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMFVPROC glad_glGetUniformfv;
+GLAD_THREAD_LOCAL PFNGLMAPGRID1FPROC glad_glMapGrid1f;
+GLAD_THREAD_LOCAL PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv;
+GLAD_THREAD_LOCAL PFNGLDISABLECLIENTSTATEPROC glad_glDisableClientState;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD3SVPROC glad_glMultiTexCoord3sv;
+GLAD_THREAD_LOCAL PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLORPOINTERPROC glad_glSecondaryColorPointer;
+GLAD_THREAD_LOCAL PFNGLALPHAFUNCPROC glad_glAlphaFunc;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1IVPROC glad_glUniform1iv;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD4IVPROC glad_glMultiTexCoord4iv;
+GLAD_THREAD_LOCAL PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv;
+GLAD_THREAD_LOCAL PFNGLSTENCILFUNCPROC glad_glStencilFunc;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD1FVPROC glad_glMultiTexCoord1fv;
+GLAD_THREAD_LOCAL PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding;
+GLAD_THREAD_LOCAL PFNGLCOLOR4UIVPROC glad_glColor4uiv;
+GLAD_THREAD_LOCAL PFNGLRECTIVPROC glad_glRectiv;
+GLAD_THREAD_LOCAL PFNGLCOLORP4UIPROC glad_glColorP4ui;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS3DVPROC glad_glRasterPos3dv;
+GLAD_THREAD_LOCAL PFNGLEVALMESH2PROC glad_glEvalMesh2;
+GLAD_THREAD_LOCAL PFNGLEVALMESH1PROC glad_glEvalMesh1;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDPOINTERPROC glad_glTexCoordPointer;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv;
+GLAD_THREAD_LOCAL PFNGLEVALCOORD2FVPROC glad_glEvalCoord2fv;
+GLAD_THREAD_LOCAL PFNGLCOLOR4UBVPROC glad_glColor4ubv;
+GLAD_THREAD_LOCAL PFNGLLOADTRANSPOSEMATRIXDPROC glad_glLoadTransposeMatrixd;
+GLAD_THREAD_LOCAL PFNGLLOADTRANSPOSEMATRIXFPROC glad_glLoadTransposeMatrixf;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS2IVPROC glad_glRasterPos2iv;
+GLAD_THREAD_LOCAL PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData;
+GLAD_THREAD_LOCAL PFNGLTEXENVIVPROC glad_glTexEnviv;
+GLAD_THREAD_LOCAL PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui;
+GLAD_THREAD_LOCAL PFNGLGENBUFFERSPROC glad_glGenBuffers;
+GLAD_THREAD_LOCAL PFNGLSELECTBUFFERPROC glad_glSelectBuffer;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv;
+GLAD_THREAD_LOCAL PFNGLPUSHATTRIBPROC glad_glPushAttrib;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer;
+GLAD_THREAD_LOCAL PFNGLBLENDFUNCPROC glad_glBlendFunc;
+GLAD_THREAD_LOCAL PFNGLCREATEPROGRAMPROC glad_glCreateProgram;
+GLAD_THREAD_LOCAL PFNGLTEXIMAGE3DPROC glad_glTexImage3D;
+GLAD_THREAD_LOCAL PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer;
+GLAD_THREAD_LOCAL PFNGLLIGHTIVPROC glad_glLightiv;
+GLAD_THREAD_LOCAL PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex;
+GLAD_THREAD_LOCAL PFNGLTEXGENFVPROC glad_glTexGenfv;
+GLAD_THREAD_LOCAL PFNGLENDPROC glad_glEnd;
+GLAD_THREAD_LOCAL PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers;
+GLAD_THREAD_LOCAL PFNGLSCISSORPROC glad_glScissor;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv;
+GLAD_THREAD_LOCAL PFNGLCLIPPLANEPROC glad_glClipPlane;
+GLAD_THREAD_LOCAL PFNGLPUSHNAMEPROC glad_glPushName;
+GLAD_THREAD_LOCAL PFNGLTEXGENDVPROC glad_glTexGendv;
+GLAD_THREAD_LOCAL PFNGLINDEXUBPROC glad_glIndexub;
+GLAD_THREAD_LOCAL PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3IVPROC glad_glSecondaryColor3iv;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS4IPROC glad_glRasterPos4i;
+GLAD_THREAD_LOCAL PFNGLMULTTRANSPOSEMATRIXDPROC glad_glMultTransposeMatrixd;
+GLAD_THREAD_LOCAL PFNGLCLEARCOLORPROC glad_glClearColor;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv;
+GLAD_THREAD_LOCAL PFNGLNORMAL3SPROC glad_glNormal3s;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv;
+GLAD_THREAD_LOCAL PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv;
+GLAD_THREAD_LOCAL PFNGLPOINTPARAMETERIPROC glad_glPointParameteri;
+GLAD_THREAD_LOCAL PFNGLCOLORP4UIVPROC glad_glColorP4uiv;
+GLAD_THREAD_LOCAL PFNGLBLENDCOLORPROC glad_glBlendColor;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS3DPROC glad_glWindowPos3d;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv;
+GLAD_THREAD_LOCAL PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3UIPROC glad_glUniform3ui;
+GLAD_THREAD_LOCAL PFNGLCOLOR4DVPROC glad_glColor4dv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv;
+GLAD_THREAD_LOCAL PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2FVPROC glad_glUniform2fv;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3UBPROC glad_glSecondaryColor3ub;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLOR3UIPROC glad_glSecondaryColor3ui;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD3DVPROC glad_glTexCoord3dv;
+GLAD_THREAD_LOCAL PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv;
+GLAD_THREAD_LOCAL PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange;
+GLAD_THREAD_LOCAL PFNGLNORMAL3IVPROC glad_glNormal3iv;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS3SPROC glad_glWindowPos3s;
+GLAD_THREAD_LOCAL PFNGLPOINTPARAMETERFPROC glad_glPointParameterf;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS3IPROC glad_glWindowPos3i;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD4SPROC glad_glMultiTexCoord4s;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS3FPROC glad_glWindowPos3f;
+GLAD_THREAD_LOCAL PFNGLCOLOR3USPROC glad_glColor3us;
+GLAD_THREAD_LOCAL PFNGLCOLOR3UIVPROC glad_glColor3uiv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv;
+GLAD_THREAD_LOCAL PFNGLGETLIGHTIVPROC glad_glGetLightiv;
+GLAD_THREAD_LOCAL PFNGLDEPTHFUNCPROC glad_glDepthFunc;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D;
+GLAD_THREAD_LOCAL PFNGLLISTBASEPROC glad_glListBase;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD4FPROC glad_glMultiTexCoord4f;
+GLAD_THREAD_LOCAL PFNGLCOLOR3UBPROC glad_glColor3ub;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD4DPROC glad_glMultiTexCoord4d;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv;
+GLAD_THREAD_LOCAL PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv;
+GLAD_THREAD_LOCAL PFNGLCOLOR3UIPROC glad_glColor3ui;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD4IPROC glad_glMultiTexCoord4i;
+GLAD_THREAD_LOCAL PFNGLGETPOLYGONSTIPPLEPROC glad_glGetPolygonStipple;
+GLAD_THREAD_LOCAL PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD4DVPROC glad_glMultiTexCoord4dv;
+GLAD_THREAD_LOCAL PFNGLCOLORMASKPROC glad_glColorMask;
+GLAD_THREAD_LOCAL PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv;
+GLAD_THREAD_LOCAL PFNGLBLENDEQUATIONPROC glad_glBlendEquation;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation;
+GLAD_THREAD_LOCAL PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS4SPROC glad_glRasterPos4s;
+GLAD_THREAD_LOCAL PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD3DVPROC glad_glMultiTexCoord3dv;
+GLAD_THREAD_LOCAL PFNGLCOLOR4SVPROC glad_glColor4sv;
+GLAD_THREAD_LOCAL PFNGLPOPCLIENTATTRIBPROC glad_glPopClientAttrib;
+GLAD_THREAD_LOCAL PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback;
+GLAD_THREAD_LOCAL PFNGLFOGFPROC glad_glFogf;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv;
+GLAD_THREAD_LOCAL PFNGLISSAMPLERPROC glad_glIsSampler;
+GLAD_THREAD_LOCAL PFNGLVERTEXP3UIPROC glad_glVertexP3ui;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor;
+GLAD_THREAD_LOCAL PFNGLCOLOR3IVPROC glad_glColor3iv;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D;
+GLAD_THREAD_LOCAL PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD1IPROC glad_glTexCoord1i;
+GLAD_THREAD_LOCAL PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD1DPROC glad_glTexCoord1d;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD1FPROC glad_glTexCoord1f;
+GLAD_THREAD_LOCAL PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender;
+GLAD_THREAD_LOCAL PFNGLENABLECLIENTSTATEPROC glad_glEnableClientState;
+GLAD_THREAD_LOCAL PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD2SVPROC glad_glMultiTexCoord2sv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv;
+GLAD_THREAD_LOCAL PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD1SPROC glad_glTexCoord1s;
+GLAD_THREAD_LOCAL PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase;
+GLAD_THREAD_LOCAL PFNGLBUFFERSUBDATAPROC glad_glBufferSubData;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv;
+GLAD_THREAD_LOCAL PFNGLGENLISTSPROC glad_glGenLists;
+GLAD_THREAD_LOCAL PFNGLCOLOR3BVPROC glad_glColor3bv;
+GLAD_THREAD_LOCAL PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange;
+GLAD_THREAD_LOCAL PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture;
+GLAD_THREAD_LOCAL PFNGLGETTEXGENDVPROC glad_glGetTexGendv;
+GLAD_THREAD_LOCAL PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays;
+GLAD_THREAD_LOCAL PFNGLENDLISTPROC glad_glEndList;
+GLAD_THREAD_LOCAL PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2UIPROC glad_glUniform2ui;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv;
+GLAD_THREAD_LOCAL PFNGLCOLOR3USVPROC glad_glColor3usv;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS2FVPROC glad_glWindowPos2fv;
+GLAD_THREAD_LOCAL PFNGLDISABLEIPROC glad_glDisablei;
+GLAD_THREAD_LOCAL PFNGLINDEXMASKPROC glad_glIndexMask;
+GLAD_THREAD_LOCAL PFNGLPUSHCLIENTATTRIBPROC glad_glPushClientAttrib;
+GLAD_THREAD_LOCAL PFNGLSHADERSOURCEPROC glad_glShaderSource;
+GLAD_THREAD_LOCAL PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv;
+GLAD_THREAD_LOCAL PFNGLCLEARACCUMPROC glad_glClearAccum;
+GLAD_THREAD_LOCAL PFNGLGETSYNCIVPROC glad_glGetSynciv;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2FPROC glad_glUniform2f;
+GLAD_THREAD_LOCAL PFNGLBEGINQUERYPROC glad_glBeginQuery;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex;
+GLAD_THREAD_LOCAL PFNGLBINDBUFFERPROC glad_glBindBuffer;
+GLAD_THREAD_LOCAL PFNGLMAP2DPROC glad_glMap2d;
+GLAD_THREAD_LOCAL PFNGLMAP2FPROC glad_glMap2f;
+GLAD_THREAD_LOCAL PFNGLVERTEX4DPROC glad_glVertex4d;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD1SVPROC glad_glTexCoord1sv;
+GLAD_THREAD_LOCAL PFNGLBUFFERDATAPROC glad_glBufferData;
+GLAD_THREAD_LOCAL PFNGLEVALPOINT1PROC glad_glEvalPoint1;
+GLAD_THREAD_LOCAL PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD1DVPROC glad_glTexCoord1dv;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui;
+GLAD_THREAD_LOCAL PFNGLGETERRORPROC glad_glGetError;
+GLAD_THREAD_LOCAL PFNGLGETTEXENVIVPROC glad_glGetTexEnviv;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMIVPROC glad_glGetProgramiv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui;
+GLAD_THREAD_LOCAL PFNGLGETFLOATVPROC glad_glGetFloatv;
+GLAD_THREAD_LOCAL PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORD2FVPROC glad_glMultiTexCoord2fv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv;
+GLAD_THREAD_LOCAL PFNGLEVALCOORD1DPROC glad_glEvalCoord1d;
+GLAD_THREAD_LOCAL PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv;
+GLAD_THREAD_LOCAL PFNGLEVALCOORD1FPROC glad_glEvalCoord1f;
+GLAD_THREAD_LOCAL PFNGLPIXELMAPFVPROC glad_glPixelMapfv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv;
+GLAD_THREAD_LOCAL PFNGLGETPIXELMAPUSVPROC glad_glGetPixelMapusv;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv;
+GLAD_THREAD_LOCAL PFNGLGETINTEGERVPROC glad_glGetIntegerv;
+GLAD_THREAD_LOCAL PFNGLACCUMPROC glad_glAccum;
+GLAD_THREAD_LOCAL PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv;
+GLAD_THREAD_LOCAL PFNGLRASTERPOS4DVPROC glad_glRasterPos4dv;
+GLAD_THREAD_LOCAL PFNGLTEXCOORD2IVPROC glad_glTexCoord2iv;
+GLAD_THREAD_LOCAL PFNGLISQUERYPROC glad_glIsQuery;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv;
+GLAD_THREAD_LOCAL PFNGLWINDOWPOS3DVPROC glad_glWindowPos3dv;
+GLAD_THREAD_LOCAL PFNGLTEXIMAGE2DPROC glad_glTexImage2D;
+GLAD_THREAD_LOCAL PFNGLSTENCILMASKPROC glad_glStencilMask;
+GLAD_THREAD_LOCAL PFNGLDRAWPIXELSPROC glad_glDrawPixels;
+GLAD_THREAD_LOCAL PFNGLMULTMATRIXDPROC glad_glMultMatrixd;
+GLAD_THREAD_LOCAL PFNGLMULTMATRIXFPROC glad_glMultMatrixf;
+GLAD_THREAD_LOCAL PFNGLISTEXTUREPROC glad_glIsTexture;
+GLAD_THREAD_LOCAL PFNGLGETMATERIALIVPROC glad_glGetMaterialiv;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1FVPROC glad_glUniform1fv;
+GLAD_THREAD_LOCAL PFNGLLOADMATRIXFPROC glad_glLoadMatrixf;
+GLAD_THREAD_LOCAL PFNGLLOADMATRIXDPROC glad_glLoadMatrixd;
+GLAD_THREAD_LOCAL PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv;
+GLAD_THREAD_LOCAL PFNGLVERTEX4FPROC glad_glVertex4f;
+GLAD_THREAD_LOCAL PFNGLRECTSVPROC glad_glRectsv;
+GLAD_THREAD_LOCAL PFNGLCOLOR4USVPROC glad_glColor4usv;
+GLAD_THREAD_LOCAL PFNGLPOLYGONSTIPPLEPROC glad_glPolygonStipple;
+GLAD_THREAD_LOCAL PFNGLINTERLEAVEDARRAYSPROC glad_glInterleavedArrays;
+GLAD_THREAD_LOCAL PFNGLNORMAL3IPROC glad_glNormal3i;
+GLAD_THREAD_LOCAL PFNGLNORMAL3FPROC glad_glNormal3f;
+GLAD_THREAD_LOCAL PFNGLNORMAL3DPROC glad_glNormal3d;
+GLAD_THREAD_LOCAL PFNGLNORMAL3BPROC glad_glNormal3b;
+GLAD_THREAD_LOCAL PFNGLPIXELMAPUSVPROC glad_glPixelMapusv;
+GLAD_THREAD_LOCAL PFNGLGETTEXGENIVPROC glad_glGetTexGeniv;
+GLAD_THREAD_LOCAL PFNGLARRAYELEMENTPROC glad_glArrayElement;
+GLAD_THREAD_LOCAL PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv;
+GLAD_THREAD_LOCAL PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v;
+GLAD_THREAD_LOCAL PFNGLDEPTHMASKPROC glad_glDepthMask;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s;
+GLAD_THREAD_LOCAL PFNGLCOLOR3FVPROC glad_glColor3fv;
+GLAD_THREAD_LOCAL PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4FVPROC glad_glUniform4fv;
+GLAD_THREAD_LOCAL PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform;
+GLAD_THREAD_LOCAL PFNGLCOLORPOINTERPROC glad_glColorPointer;
+GLAD_THREAD_LOCAL PFNGLFRONTFACEPROC glad_glFrontFace;
+GLAD_THREAD_LOCAL PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v;
+GLAD_THREAD_LOCAL PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv;
+GLAD_THREAD_LOCAL PFNGLMINSAMPLESHADINGPROC glad_glMinSampleShading;
+GLAD_THREAD_LOCAL PFNGLBLENDEQUATIONIPROC glad_glBlendEquationi;
+GLAD_THREAD_LOCAL PFNGLBLENDEQUATIONSEPARATEIPROC glad_glBlendEquationSeparatei;
+GLAD_THREAD_LOCAL PFNGLBLENDFUNCIPROC glad_glBlendFunci;
+GLAD_THREAD_LOCAL PFNGLBLENDFUNCSEPARATEIPROC glad_glBlendFuncSeparatei;
+GLAD_THREAD_LOCAL PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect;
+GLAD_THREAD_LOCAL PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1DPROC glad_glUniform1d;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2DPROC glad_glUniform2d;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3DPROC glad_glUniform3d;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4DPROC glad_glUniform4d;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1DVPROC glad_glUniform1dv;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2DVPROC glad_glUniform2dv;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3DVPROC glad_glUniform3dv;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4DVPROC glad_glUniform4dv;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX2DVPROC glad_glUniformMatrix2dv;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX3DVPROC glad_glUniformMatrix3dv;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX4DVPROC glad_glUniformMatrix4dv;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX2X3DVPROC glad_glUniformMatrix2x3dv;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX2X4DVPROC glad_glUniformMatrix2x4dv;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX3X2DVPROC glad_glUniformMatrix3x2dv;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX3X4DVPROC glad_glUniformMatrix3x4dv;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX4X2DVPROC glad_glUniformMatrix4x2dv;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX4X3DVPROC glad_glUniformMatrix4x3dv;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMDVPROC glad_glGetUniformdv;
+GLAD_THREAD_LOCAL PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_glGetSubroutineUniformLocation;
+GLAD_THREAD_LOCAL PFNGLGETSUBROUTINEINDEXPROC glad_glGetSubroutineIndex;
+GLAD_THREAD_LOCAL PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_glGetActiveSubroutineUniformiv;
+GLAD_THREAD_LOCAL PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_glGetActiveSubroutineUniformName;
+GLAD_THREAD_LOCAL PFNGLGETACTIVESUBROUTINENAMEPROC glad_glGetActiveSubroutineName;
+GLAD_THREAD_LOCAL PFNGLUNIFORMSUBROUTINESUIVPROC glad_glUniformSubroutinesuiv;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_glGetUniformSubroutineuiv;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMSTAGEIVPROC glad_glGetProgramStageiv;
+GLAD_THREAD_LOCAL PFNGLPATCHPARAMETERIPROC glad_glPatchParameteri;
+GLAD_THREAD_LOCAL PFNGLPATCHPARAMETERFVPROC glad_glPatchParameterfv;
+GLAD_THREAD_LOCAL PFNGLBINDTRANSFORMFEEDBACKPROC glad_glBindTransformFeedback;
+GLAD_THREAD_LOCAL PFNGLDELETETRANSFORMFEEDBACKSPROC glad_glDeleteTransformFeedbacks;
+GLAD_THREAD_LOCAL PFNGLGENTRANSFORMFEEDBACKSPROC glad_glGenTransformFeedbacks;
+GLAD_THREAD_LOCAL PFNGLISTRANSFORMFEEDBACKPROC glad_glIsTransformFeedback;
+GLAD_THREAD_LOCAL PFNGLPAUSETRANSFORMFEEDBACKPROC glad_glPauseTransformFeedback;
+GLAD_THREAD_LOCAL PFNGLRESUMETRANSFORMFEEDBACKPROC glad_glResumeTransformFeedback;
+GLAD_THREAD_LOCAL PFNGLDRAWTRANSFORMFEEDBACKPROC glad_glDrawTransformFeedback;
+GLAD_THREAD_LOCAL PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_glDrawTransformFeedbackStream;
+GLAD_THREAD_LOCAL PFNGLBEGINQUERYINDEXEDPROC glad_glBeginQueryIndexed;
+GLAD_THREAD_LOCAL PFNGLENDQUERYINDEXEDPROC glad_glEndQueryIndexed;
+GLAD_THREAD_LOCAL PFNGLGETQUERYINDEXEDIVPROC glad_glGetQueryIndexediv;
+GLAD_THREAD_LOCAL PFNGLRELEASESHADERCOMPILERPROC glad_glReleaseShaderCompiler;
+GLAD_THREAD_LOCAL PFNGLSHADERBINARYPROC glad_glShaderBinary;
+GLAD_THREAD_LOCAL PFNGLGETSHADERPRECISIONFORMATPROC glad_glGetShaderPrecisionFormat;
+GLAD_THREAD_LOCAL PFNGLDEPTHRANGEFPROC glad_glDepthRangef;
+GLAD_THREAD_LOCAL PFNGLCLEARDEPTHFPROC glad_glClearDepthf;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary;
+GLAD_THREAD_LOCAL PFNGLPROGRAMBINARYPROC glad_glProgramBinary;
+GLAD_THREAD_LOCAL PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri;
+GLAD_THREAD_LOCAL PFNGLUSEPROGRAMSTAGESPROC glad_glUseProgramStages;
+GLAD_THREAD_LOCAL PFNGLACTIVESHADERPROGRAMPROC glad_glActiveShaderProgram;
+GLAD_THREAD_LOCAL PFNGLCREATESHADERPROGRAMVPROC glad_glCreateShaderProgramv;
+GLAD_THREAD_LOCAL PFNGLBINDPROGRAMPIPELINEPROC glad_glBindProgramPipeline;
+GLAD_THREAD_LOCAL PFNGLDELETEPROGRAMPIPELINESPROC glad_glDeleteProgramPipelines;
+GLAD_THREAD_LOCAL PFNGLGENPROGRAMPIPELINESPROC glad_glGenProgramPipelines;
+GLAD_THREAD_LOCAL PFNGLISPROGRAMPIPELINEPROC glad_glIsProgramPipeline;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMPIPELINEIVPROC glad_glGetProgramPipelineiv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1IPROC glad_glProgramUniform1i;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1IVPROC glad_glProgramUniform1iv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1FPROC glad_glProgramUniform1f;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1FVPROC glad_glProgramUniform1fv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1DPROC glad_glProgramUniform1d;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1DVPROC glad_glProgramUniform1dv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1UIPROC glad_glProgramUniform1ui;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1UIVPROC glad_glProgramUniform1uiv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2IPROC glad_glProgramUniform2i;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2IVPROC glad_glProgramUniform2iv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2FPROC glad_glProgramUniform2f;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2FVPROC glad_glProgramUniform2fv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2DPROC glad_glProgramUniform2d;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2DVPROC glad_glProgramUniform2dv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2UIPROC glad_glProgramUniform2ui;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2UIVPROC glad_glProgramUniform2uiv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3IPROC glad_glProgramUniform3i;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3IVPROC glad_glProgramUniform3iv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3FPROC glad_glProgramUniform3f;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3FVPROC glad_glProgramUniform3fv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3DPROC glad_glProgramUniform3d;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3DVPROC glad_glProgramUniform3dv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3UIPROC glad_glProgramUniform3ui;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3UIVPROC glad_glProgramUniform3uiv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4IPROC glad_glProgramUniform4i;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4IVPROC glad_glProgramUniform4iv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4FPROC glad_glProgramUniform4f;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4FVPROC glad_glProgramUniform4fv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4DPROC glad_glProgramUniform4d;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4DVPROC glad_glProgramUniform4dv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4UIPROC glad_glProgramUniform4ui;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4UIVPROC glad_glProgramUniform4uiv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_glProgramUniformMatrix2fv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_glProgramUniformMatrix3fv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_glProgramUniformMatrix4fv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_glProgramUniformMatrix2dv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_glProgramUniformMatrix3dv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_glProgramUniformMatrix4dv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_glProgramUniformMatrix2x3fv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_glProgramUniformMatrix3x2fv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_glProgramUniformMatrix2x4fv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_glProgramUniformMatrix4x2fv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_glProgramUniformMatrix3x4fv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_glProgramUniformMatrix4x3fv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_glProgramUniformMatrix2x3dv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_glProgramUniformMatrix3x2dv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_glProgramUniformMatrix2x4dv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_glProgramUniformMatrix4x2dv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_glProgramUniformMatrix3x4dv;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_glProgramUniformMatrix4x3dv;
+GLAD_THREAD_LOCAL PFNGLVALIDATEPROGRAMPIPELINEPROC glad_glValidateProgramPipeline;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_glGetProgramPipelineInfoLog;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL1DPROC glad_glVertexAttribL1d;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL2DPROC glad_glVertexAttribL2d;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL3DPROC glad_glVertexAttribL3d;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL4DPROC glad_glVertexAttribL4d;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL1DVPROC glad_glVertexAttribL1dv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL2DVPROC glad_glVertexAttribL2dv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL3DVPROC glad_glVertexAttribL3dv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL4DVPROC glad_glVertexAttribL4dv;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBLPOINTERPROC glad_glVertexAttribLPointer;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXATTRIBLDVPROC glad_glGetVertexAttribLdv;
+GLAD_THREAD_LOCAL PFNGLVIEWPORTARRAYVPROC glad_glViewportArrayv;
+GLAD_THREAD_LOCAL PFNGLVIEWPORTINDEXEDFPROC glad_glViewportIndexedf;
+GLAD_THREAD_LOCAL PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv;
+GLAD_THREAD_LOCAL PFNGLSCISSORARRAYVPROC glad_glScissorArrayv;
+GLAD_THREAD_LOCAL PFNGLSCISSORINDEXEDPROC glad_glScissorIndexed;
+GLAD_THREAD_LOCAL PFNGLSCISSORINDEXEDVPROC glad_glScissorIndexedv;
+GLAD_THREAD_LOCAL PFNGLDEPTHRANGEARRAYVPROC glad_glDepthRangeArrayv;
+GLAD_THREAD_LOCAL PFNGLDEPTHRANGEINDEXEDPROC glad_glDepthRangeIndexed;
+GLAD_THREAD_LOCAL PFNGLGETFLOATI_VPROC glad_glGetFloati_v;
+GLAD_THREAD_LOCAL PFNGLGETDOUBLEI_VPROC glad_glGetDoublei_v;
+GLAD_THREAD_LOCAL PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_glDrawArraysInstancedBaseInstance;
+GLAD_THREAD_LOCAL PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_glDrawElementsInstancedBaseInstance;
+GLAD_THREAD_LOCAL PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_glDrawElementsInstancedBaseVertexBaseInstance;
+GLAD_THREAD_LOCAL PFNGLGETINTERNALFORMATIVPROC glad_glGetInternalformativ;
+GLAD_THREAD_LOCAL PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_glGetActiveAtomicCounterBufferiv;
+GLAD_THREAD_LOCAL PFNGLBINDIMAGETEXTUREPROC glad_glBindImageTexture;
+GLAD_THREAD_LOCAL PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier;
+GLAD_THREAD_LOCAL PFNGLTEXSTORAGE1DPROC glad_glTexStorage1D;
+GLAD_THREAD_LOCAL PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D;
+GLAD_THREAD_LOCAL PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D;
+GLAD_THREAD_LOCAL PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_glDrawTransformFeedbackInstanced;
+GLAD_THREAD_LOCAL PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_glDrawTransformFeedbackStreamInstanced;
+GLAD_THREAD_LOCAL PFNGLCLEARBUFFERDATAPROC glad_glClearBufferData;
+GLAD_THREAD_LOCAL PFNGLCLEARBUFFERSUBDATAPROC glad_glClearBufferSubData;
+GLAD_THREAD_LOCAL PFNGLDISPATCHCOMPUTEPROC glad_glDispatchCompute;
+GLAD_THREAD_LOCAL PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_glDispatchComputeIndirect;
+GLAD_THREAD_LOCAL PFNGLCOPYIMAGESUBDATAPROC glad_glCopyImageSubData;
+GLAD_THREAD_LOCAL PFNGLFRAMEBUFFERPARAMETERIPROC glad_glFramebufferParameteri;
+GLAD_THREAD_LOCAL PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_glGetFramebufferParameteriv;
+GLAD_THREAD_LOCAL PFNGLGETINTERNALFORMATI64VPROC glad_glGetInternalformati64v;
+GLAD_THREAD_LOCAL PFNGLINVALIDATETEXSUBIMAGEPROC glad_glInvalidateTexSubImage;
+GLAD_THREAD_LOCAL PFNGLINVALIDATETEXIMAGEPROC glad_glInvalidateTexImage;
+GLAD_THREAD_LOCAL PFNGLINVALIDATEBUFFERSUBDATAPROC glad_glInvalidateBufferSubData;
+GLAD_THREAD_LOCAL PFNGLINVALIDATEBUFFERDATAPROC glad_glInvalidateBufferData;
+GLAD_THREAD_LOCAL PFNGLINVALIDATEFRAMEBUFFERPROC glad_glInvalidateFramebuffer;
+GLAD_THREAD_LOCAL PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_glInvalidateSubFramebuffer;
+GLAD_THREAD_LOCAL PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect;
+GLAD_THREAD_LOCAL PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMINTERFACEIVPROC glad_glGetProgramInterfaceiv;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMRESOURCEINDEXPROC glad_glGetProgramResourceIndex;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMRESOURCENAMEPROC glad_glGetProgramResourceName;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMRESOURCEIVPROC glad_glGetProgramResourceiv;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_glGetProgramResourceLocation;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_glGetProgramResourceLocationIndex;
+GLAD_THREAD_LOCAL PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_glShaderStorageBlockBinding;
+GLAD_THREAD_LOCAL PFNGLTEXBUFFERRANGEPROC glad_glTexBufferRange;
+GLAD_THREAD_LOCAL PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_glTexStorage2DMultisample;
+GLAD_THREAD_LOCAL PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_glTexStorage3DMultisample;
+GLAD_THREAD_LOCAL PFNGLTEXTUREVIEWPROC glad_glTextureView;
+GLAD_THREAD_LOCAL PFNGLBINDVERTEXBUFFERPROC glad_glBindVertexBuffer;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBFORMATPROC glad_glVertexAttribFormat;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBIFORMATPROC glad_glVertexAttribIFormat;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBLFORMATPROC glad_glVertexAttribLFormat;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBBINDINGPROC glad_glVertexAttribBinding;
+GLAD_THREAD_LOCAL PFNGLVERTEXBINDINGDIVISORPROC glad_glVertexBindingDivisor;
+GLAD_THREAD_LOCAL PFNGLDEBUGMESSAGECONTROLPROC glad_glDebugMessageControl;
+GLAD_THREAD_LOCAL PFNGLDEBUGMESSAGEINSERTPROC glad_glDebugMessageInsert;
+GLAD_THREAD_LOCAL PFNGLDEBUGMESSAGECALLBACKPROC glad_glDebugMessageCallback;
+GLAD_THREAD_LOCAL PFNGLGETDEBUGMESSAGELOGPROC glad_glGetDebugMessageLog;
+GLAD_THREAD_LOCAL PFNGLPUSHDEBUGGROUPPROC glad_glPushDebugGroup;
+GLAD_THREAD_LOCAL PFNGLPOPDEBUGGROUPPROC glad_glPopDebugGroup;
+GLAD_THREAD_LOCAL PFNGLOBJECTLABELPROC glad_glObjectLabel;
+GLAD_THREAD_LOCAL PFNGLGETOBJECTLABELPROC glad_glGetObjectLabel;
+GLAD_THREAD_LOCAL PFNGLOBJECTPTRLABELPROC glad_glObjectPtrLabel;
+GLAD_THREAD_LOCAL PFNGLGETOBJECTPTRLABELPROC glad_glGetObjectPtrLabel;
+GLAD_THREAD_LOCAL PFNGLBUFFERSTORAGEPROC glad_glBufferStorage;
+GLAD_THREAD_LOCAL PFNGLCLEARTEXIMAGEPROC glad_glClearTexImage;
+GLAD_THREAD_LOCAL PFNGLCLEARTEXSUBIMAGEPROC glad_glClearTexSubImage;
+GLAD_THREAD_LOCAL PFNGLBINDBUFFERSBASEPROC glad_glBindBuffersBase;
+GLAD_THREAD_LOCAL PFNGLBINDBUFFERSRANGEPROC glad_glBindBuffersRange;
+GLAD_THREAD_LOCAL PFNGLBINDTEXTURESPROC glad_glBindTextures;
+GLAD_THREAD_LOCAL PFNGLBINDSAMPLERSPROC glad_glBindSamplers;
+GLAD_THREAD_LOCAL PFNGLBINDIMAGETEXTURESPROC glad_glBindImageTextures;
+GLAD_THREAD_LOCAL PFNGLBINDVERTEXBUFFERSPROC glad_glBindVertexBuffers;
+GLAD_THREAD_LOCAL PFNGLCLIPCONTROLPROC glad_glClipControl;
+GLAD_THREAD_LOCAL PFNGLCREATETRANSFORMFEEDBACKSPROC glad_glCreateTransformFeedbacks;
+GLAD_THREAD_LOCAL PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_glTransformFeedbackBufferBase;
+GLAD_THREAD_LOCAL PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_glTransformFeedbackBufferRange;
+GLAD_THREAD_LOCAL PFNGLGETTRANSFORMFEEDBACKIVPROC glad_glGetTransformFeedbackiv;
+GLAD_THREAD_LOCAL PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_glGetTransformFeedbacki_v;
+GLAD_THREAD_LOCAL PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_glGetTransformFeedbacki64_v;
+GLAD_THREAD_LOCAL PFNGLCREATEBUFFERSPROC glad_glCreateBuffers;
+GLAD_THREAD_LOCAL PFNGLNAMEDBUFFERSTORAGEPROC glad_glNamedBufferStorage;
+GLAD_THREAD_LOCAL PFNGLNAMEDBUFFERDATAPROC glad_glNamedBufferData;
+GLAD_THREAD_LOCAL PFNGLNAMEDBUFFERSUBDATAPROC glad_glNamedBufferSubData;
+GLAD_THREAD_LOCAL PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_glCopyNamedBufferSubData;
+GLAD_THREAD_LOCAL PFNGLCLEARNAMEDBUFFERDATAPROC glad_glClearNamedBufferData;
+GLAD_THREAD_LOCAL PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_glClearNamedBufferSubData;
+GLAD_THREAD_LOCAL PFNGLMAPNAMEDBUFFERPROC glad_glMapNamedBuffer;
+GLAD_THREAD_LOCAL PFNGLMAPNAMEDBUFFERRANGEPROC glad_glMapNamedBufferRange;
+GLAD_THREAD_LOCAL PFNGLUNMAPNAMEDBUFFERPROC glad_glUnmapNamedBuffer;
+GLAD_THREAD_LOCAL PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_glFlushMappedNamedBufferRange;
+GLAD_THREAD_LOCAL PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_glGetNamedBufferParameteriv;
+GLAD_THREAD_LOCAL PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_glGetNamedBufferParameteri64v;
+GLAD_THREAD_LOCAL PFNGLGETNAMEDBUFFERPOINTERVPROC glad_glGetNamedBufferPointerv;
+GLAD_THREAD_LOCAL PFNGLGETNAMEDBUFFERSUBDATAPROC glad_glGetNamedBufferSubData;
+GLAD_THREAD_LOCAL PFNGLCREATEFRAMEBUFFERSPROC glad_glCreateFramebuffers;
+GLAD_THREAD_LOCAL PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_glNamedFramebufferRenderbuffer;
+GLAD_THREAD_LOCAL PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_glNamedFramebufferParameteri;
+GLAD_THREAD_LOCAL PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_glNamedFramebufferTexture;
+GLAD_THREAD_LOCAL PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_glNamedFramebufferTextureLayer;
+GLAD_THREAD_LOCAL PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_glNamedFramebufferDrawBuffer;
+GLAD_THREAD_LOCAL PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_glNamedFramebufferDrawBuffers;
+GLAD_THREAD_LOCAL PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_glNamedFramebufferReadBuffer;
+GLAD_THREAD_LOCAL PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_glInvalidateNamedFramebufferData;
+GLAD_THREAD_LOCAL PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_glInvalidateNamedFramebufferSubData;
+GLAD_THREAD_LOCAL PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_glClearNamedFramebufferiv;
+GLAD_THREAD_LOCAL PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_glClearNamedFramebufferuiv;
+GLAD_THREAD_LOCAL PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_glClearNamedFramebufferfv;
+GLAD_THREAD_LOCAL PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_glClearNamedFramebufferfi;
+GLAD_THREAD_LOCAL PFNGLBLITNAMEDFRAMEBUFFERPROC glad_glBlitNamedFramebuffer;
+GLAD_THREAD_LOCAL PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_glCheckNamedFramebufferStatus;
+GLAD_THREAD_LOCAL PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_glGetNamedFramebufferParameteriv;
+GLAD_THREAD_LOCAL PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetNamedFramebufferAttachmentParameteriv;
+GLAD_THREAD_LOCAL PFNGLCREATERENDERBUFFERSPROC glad_glCreateRenderbuffers;
+GLAD_THREAD_LOCAL PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_glNamedRenderbufferStorage;
+GLAD_THREAD_LOCAL PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glNamedRenderbufferStorageMultisample;
+GLAD_THREAD_LOCAL PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_glGetNamedRenderbufferParameteriv;
+GLAD_THREAD_LOCAL PFNGLCREATETEXTURESPROC glad_glCreateTextures;
+GLAD_THREAD_LOCAL PFNGLTEXTUREBUFFERPROC glad_glTextureBuffer;
+GLAD_THREAD_LOCAL PFNGLTEXTUREBUFFERRANGEPROC glad_glTextureBufferRange;
+GLAD_THREAD_LOCAL PFNGLTEXTURESTORAGE1DPROC glad_glTextureStorage1D;
+GLAD_THREAD_LOCAL PFNGLTEXTURESTORAGE2DPROC glad_glTextureStorage2D;
+GLAD_THREAD_LOCAL PFNGLTEXTURESTORAGE3DPROC glad_glTextureStorage3D;
+GLAD_THREAD_LOCAL PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_glTextureStorage2DMultisample;
+GLAD_THREAD_LOCAL PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_glTextureStorage3DMultisample;
+GLAD_THREAD_LOCAL PFNGLTEXTURESUBIMAGE1DPROC glad_glTextureSubImage1D;
+GLAD_THREAD_LOCAL PFNGLTEXTURESUBIMAGE2DPROC glad_glTextureSubImage2D;
+GLAD_THREAD_LOCAL PFNGLTEXTURESUBIMAGE3DPROC glad_glTextureSubImage3D;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_glCompressedTextureSubImage1D;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_glCompressedTextureSubImage2D;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_glCompressedTextureSubImage3D;
+GLAD_THREAD_LOCAL PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_glCopyTextureSubImage1D;
+GLAD_THREAD_LOCAL PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_glCopyTextureSubImage2D;
+GLAD_THREAD_LOCAL PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_glCopyTextureSubImage3D;
+GLAD_THREAD_LOCAL PFNGLTEXTUREPARAMETERFPROC glad_glTextureParameterf;
+GLAD_THREAD_LOCAL PFNGLTEXTUREPARAMETERFVPROC glad_glTextureParameterfv;
+GLAD_THREAD_LOCAL PFNGLTEXTUREPARAMETERIPROC glad_glTextureParameteri;
+GLAD_THREAD_LOCAL PFNGLTEXTUREPARAMETERIIVPROC glad_glTextureParameterIiv;
+GLAD_THREAD_LOCAL PFNGLTEXTUREPARAMETERIUIVPROC glad_glTextureParameterIuiv;
+GLAD_THREAD_LOCAL PFNGLTEXTUREPARAMETERIVPROC glad_glTextureParameteriv;
+GLAD_THREAD_LOCAL PFNGLGENERATETEXTUREMIPMAPPROC glad_glGenerateTextureMipmap;
+GLAD_THREAD_LOCAL PFNGLBINDTEXTUREUNITPROC glad_glBindTextureUnit;
+GLAD_THREAD_LOCAL PFNGLGETTEXTUREIMAGEPROC glad_glGetTextureImage;
+GLAD_THREAD_LOCAL PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_glGetCompressedTextureImage;
+GLAD_THREAD_LOCAL PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_glGetTextureLevelParameterfv;
+GLAD_THREAD_LOCAL PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_glGetTextureLevelParameteriv;
+GLAD_THREAD_LOCAL PFNGLGETTEXTUREPARAMETERFVPROC glad_glGetTextureParameterfv;
+GLAD_THREAD_LOCAL PFNGLGETTEXTUREPARAMETERIIVPROC glad_glGetTextureParameterIiv;
+GLAD_THREAD_LOCAL PFNGLGETTEXTUREPARAMETERIUIVPROC glad_glGetTextureParameterIuiv;
+GLAD_THREAD_LOCAL PFNGLGETTEXTUREPARAMETERIVPROC glad_glGetTextureParameteriv;
+GLAD_THREAD_LOCAL PFNGLCREATEVERTEXARRAYSPROC glad_glCreateVertexArrays;
+GLAD_THREAD_LOCAL PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_glDisableVertexArrayAttrib;
+GLAD_THREAD_LOCAL PFNGLENABLEVERTEXARRAYATTRIBPROC glad_glEnableVertexArrayAttrib;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_glVertexArrayElementBuffer;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_glVertexArrayVertexBuffer;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_glVertexArrayVertexBuffers;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_glVertexArrayAttribBinding;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYATTRIBFORMATPROC glad_glVertexArrayAttribFormat;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_glVertexArrayAttribIFormat;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_glVertexArrayAttribLFormat;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_glVertexArrayBindingDivisor;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXARRAYIVPROC glad_glGetVertexArrayiv;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_glGetVertexArrayIndexediv;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_glGetVertexArrayIndexed64iv;
+GLAD_THREAD_LOCAL PFNGLCREATESAMPLERSPROC glad_glCreateSamplers;
+GLAD_THREAD_LOCAL PFNGLCREATEPROGRAMPIPELINESPROC glad_glCreateProgramPipelines;
+GLAD_THREAD_LOCAL PFNGLCREATEQUERIESPROC glad_glCreateQueries;
+GLAD_THREAD_LOCAL PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_glGetQueryBufferObjecti64v;
+GLAD_THREAD_LOCAL PFNGLGETQUERYBUFFEROBJECTIVPROC glad_glGetQueryBufferObjectiv;
+GLAD_THREAD_LOCAL PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_glGetQueryBufferObjectui64v;
+GLAD_THREAD_LOCAL PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_glGetQueryBufferObjectuiv;
+GLAD_THREAD_LOCAL PFNGLMEMORYBARRIERBYREGIONPROC glad_glMemoryBarrierByRegion;
+GLAD_THREAD_LOCAL PFNGLGETTEXTURESUBIMAGEPROC glad_glGetTextureSubImage;
+GLAD_THREAD_LOCAL PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_glGetCompressedTextureSubImage;
+GLAD_THREAD_LOCAL PFNGLGETGRAPHICSRESETSTATUSPROC glad_glGetGraphicsResetStatus;
+GLAD_THREAD_LOCAL PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_glGetnCompressedTexImage;
+GLAD_THREAD_LOCAL PFNGLGETNTEXIMAGEPROC glad_glGetnTexImage;
+GLAD_THREAD_LOCAL PFNGLGETNUNIFORMDVPROC glad_glGetnUniformdv;
+GLAD_THREAD_LOCAL PFNGLGETNUNIFORMFVPROC glad_glGetnUniformfv;
+GLAD_THREAD_LOCAL PFNGLGETNUNIFORMIVPROC glad_glGetnUniformiv;
+GLAD_THREAD_LOCAL PFNGLGETNUNIFORMUIVPROC glad_glGetnUniformuiv;
+GLAD_THREAD_LOCAL PFNGLREADNPIXELSPROC glad_glReadnPixels;
+GLAD_THREAD_LOCAL PFNGLTEXTUREBARRIERPROC glad_glTextureBarrier;
+GLAD_THREAD_LOCAL PFNGLSPECIALIZESHADERPROC glad_glSpecializeShader;
+GLAD_THREAD_LOCAL PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC glad_glMultiDrawArraysIndirectCount;
+GLAD_THREAD_LOCAL PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC glad_glMultiDrawElementsIndirectCount;
+GLAD_THREAD_LOCAL PFNGLPOLYGONOFFSETCLAMPPROC glad_glPolygonOffsetClamp;
+GLAD_THREAD_LOCAL PFNGLSPECIALIZESHADERARBPROC glad_glSpecializeShaderARB;
+GLAD_THREAD_LOCAL PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_glMaxShaderCompilerThreadsKHR;
+#else
+#define GLAD_PROC(ret, name, pfn, params, args, feature) GLAD_THREAD_LOCAL pfn glad_gl##name;
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) GLAD_THREAD_LOCAL pfn glad_gl##name;
+#include GLAD_PROCS
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+#endif
+#ifndef GLAD_TRIMMED
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -1734,10 +2285,551 @@ static void load_GL_VERSION_3_3(GLADloadproc load) {
 	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
 	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
 }
+static void load_GL_VERSION_4_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_0) return;
+	glad_glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC)load("glMinSampleShading");
+	glad_glBlendEquationi = (PFNGLBLENDEQUATIONIPROC)load("glBlendEquationi");
+	glad_glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)load("glBlendEquationSeparatei");
+	glad_glBlendFunci = (PFNGLBLENDFUNCIPROC)load("glBlendFunci");
+	glad_glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)load("glBlendFuncSeparatei");
+	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)load("glDrawArraysIndirect");
+	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)load("glDrawElementsIndirect");
+	glad_glUniform1d = (PFNGLUNIFORM1DPROC)load("glUniform1d");
+	glad_glUniform2d = (PFNGLUNIFORM2DPROC)load("glUniform2d");
+	glad_glUniform3d = (PFNGLUNIFORM3DPROC)load("glUniform3d");
+	glad_glUniform4d = (PFNGLUNIFORM4DPROC)load("glUniform4d");
+	glad_glUniform1dv = (PFNGLUNIFORM1DVPROC)load("glUniform1dv");
+	glad_glUniform2dv = (PFNGLUNIFORM2DVPROC)load("glUniform2dv");
+	glad_glUniform3dv = (PFNGLUNIFORM3DVPROC)load("glUniform3dv");
+	glad_glUniform4dv = (PFNGLUNIFORM4DVPROC)load("glUniform4dv");
+	glad_glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)load("glUniformMatrix2dv");
+	glad_glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)load("glUniformMatrix3dv");
+	glad_glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)load("glUniformMatrix4dv");
+	glad_glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)load("glUniformMatrix2x3dv");
+	glad_glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)load("glUniformMatrix2x4dv");
+	glad_glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)load("glUniformMatrix3x2dv");
+	glad_glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)load("glUniformMatrix3x4dv");
+	glad_glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)load("glUniformMatrix4x2dv");
+	glad_glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)load("glUniformMatrix4x3dv");
+	glad_glGetUniformdv = (PFNGLGETUNIFORMDVPROC)load("glGetUniformdv");
+	glad_glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)load("glGetSubroutineUniformLocation");
+	glad_glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)load("glGetSubroutineIndex");
+	glad_glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)load("glGetActiveSubroutineUniformiv");
+	glad_glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)load("glGetActiveSubroutineUniformName");
+	glad_glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)load("glGetActiveSubroutineName");
+	glad_glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)load("glUniformSubroutinesuiv");
+	glad_glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)load("glGetUniformSubroutineuiv");
+	glad_glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)load("glGetProgramStageiv");
+	glad_glPatchParameteri = (PFNGLPATCHPARAMETERIPROC)load("glPatchParameteri");
+	glad_glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)load("glPatchParameterfv");
+	glad_glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)load("glBindTransformFeedback");
+	glad_glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)load("glDeleteTransformFeedbacks");
+	glad_glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)load("glGenTransformFeedbacks");
+	glad_glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)load("glIsTransformFeedback");
+	glad_glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)load("glPauseTransformFeedback");
+	glad_glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)load("glResumeTransformFeedback");
+	glad_glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)load("glDrawTransformFeedback");
+	glad_glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)load("glDrawTransformFeedbackStream");
+	glad_glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)load("glBeginQueryIndexed");
+	glad_glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)load("glEndQueryIndexed");
+	glad_glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)load("glGetQueryIndexediv");
+}
+static void load_GL_VERSION_4_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_1) return;
+	glad_glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)load("glReleaseShaderCompiler");
+	glad_glShaderBinary = (PFNGLSHADERBINARYPROC)load("glShaderBinary");
+	glad_glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)load("glGetShaderPrecisionFormat");
+	glad_glDepthRangef = (PFNGLDEPTHRANGEFPROC)load("glDepthRangef");
+	glad_glClearDepthf = (PFNGLCLEARDEPTHFPROC)load("glClearDepthf");
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+	glad_glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)load("glUseProgramStages");
+	glad_glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)load("glActiveShaderProgram");
+	glad_glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)load("glCreateShaderProgramv");
+	glad_glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)load("glBindProgramPipeline");
+	glad_glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)load("glDeleteProgramPipelines");
+	glad_glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)load("glGenProgramPipelines");
+	glad_glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)load("glIsProgramPipeline");
+	glad_glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)load("glGetProgramPipelineiv");
+	glad_glProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC)load("glProgramUniform1i");
+	glad_glProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC)load("glProgramUniform1iv");
+	glad_glProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC)load("glProgramUniform1f");
+	glad_glProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC)load("glProgramUniform1fv");
+	glad_glProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC)load("glProgramUniform1d");
+	glad_glProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC)load("glProgramUniform1dv");
+	glad_glProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)load("glProgramUniform1ui");
+	glad_glProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC)load("glProgramUniform1uiv");
+	glad_glProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC)load("glProgramUniform2i");
+	glad_glProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC)load("glProgramUniform2iv");
+	glad_glProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC)load("glProgramUniform2f");
+	glad_glProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC)load("glProgramUniform2fv");
+	glad_glProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC)load("glProgramUniform2d");
+	glad_glProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC)load("glProgramUniform2dv");
+	glad_glProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC)load("glProgramUniform2ui");
+	glad_glProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC)load("glProgramUniform2uiv");
+	glad_glProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC)load("glProgramUniform3i");
+	glad_glProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC)load("glProgramUniform3iv");
+	glad_glProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC)load("glProgramUniform3f");
+	glad_glProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC)load("glProgramUniform3fv");
+	glad_glProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC)load("glProgramUniform3d");
+	glad_glProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC)load("glProgramUniform3dv");
+	glad_glProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC)load("glProgramUniform3ui");
+	glad_glProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC)load("glProgramUniform3uiv");
+	glad_glProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC)load("glProgramUniform4i");
+	glad_glProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC)load("glProgramUniform4iv");
+	glad_glProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC)load("glProgramUniform4f");
+	glad_glProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)load("glProgramUniform4fv");
+	glad_glProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC)load("glProgramUniform4d");
+	glad_glProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC)load("glProgramUniform4dv");
+	glad_glProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC)load("glProgramUniform4ui");
+	glad_glProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC)load("glProgramUniform4uiv");
+	glad_glProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)load("glProgramUniformMatrix2fv");
+	glad_glProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)load("glProgramUniformMatrix3fv");
+	glad_glProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)load("glProgramUniformMatrix4fv");
+	glad_glProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)load("glProgramUniformMatrix2dv");
+	glad_glProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)load("glProgramUniformMatrix3dv");
+	glad_glProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)load("glProgramUniformMatrix4dv");
+	glad_glProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)load("glProgramUniformMatrix2x3fv");
+	glad_glProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)load("glProgramUniformMatrix3x2fv");
+	glad_glProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)load("glProgramUniformMatrix2x4fv");
+	glad_glProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)load("glProgramUniformMatrix4x2fv");
+	glad_glProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)load("glProgramUniformMatrix3x4fv");
+	glad_glProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)load("glProgramUniformMatrix4x3fv");
+	glad_glProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)load("glProgramUniformMatrix2x3dv");
+	glad_glProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)load("glProgramUniformMatrix3x2dv");
+	glad_glProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)load("glProgramUniformMatrix2x4dv");
+	glad_glProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)load("glProgramUniformMatrix4x2dv");
+	glad_glProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)load("glProgramUniformMatrix3x4dv");
+	glad_glProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)load("glProgramUniformMatrix4x3dv");
+	glad_glValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC)load("glValidateProgramPipeline");
+	glad_glGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)load("glGetProgramPipelineInfoLog");
+	glad_glVertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC)load("glVertexAttribL1d");
+	glad_glVertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC)load("glVertexAttribL2d");
+	glad_glVertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC)load("glVertexAttribL3d");
+	glad_glVertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC)load("glVertexAttribL4d");
+	glad_glVertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC)load("glVertexAttribL1dv");
+	glad_glVertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC)load("glVertexAttribL2dv");
+	glad_glVertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC)load("glVertexAttribL3dv");
+	glad_glVertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC)load("glVertexAttribL4dv");
+	glad_glVertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC)load("glVertexAttribLPointer");
+	glad_glGetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC)load("glGetVertexAttribLdv");
+	glad_glViewportArrayv = (PFNGLVIEWPORTARRAYVPROC)load("glViewportArrayv");
+	glad_glViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC)load("glViewportIndexedf");
+	glad_glViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC)load("glViewportIndexedfv");
+	glad_glScissorArrayv = (PFNGLSCISSORARRAYVPROC)load("glScissorArrayv");
+	glad_glScissorIndexed = (PFNGLSCISSORINDEXEDPROC)load("glScissorIndexed");
+	glad_glScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC)load("glScissorIndexedv");
+	glad_glDepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC)load("glDepthRangeArrayv");
+	glad_glDepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC)load("glDepthRangeIndexed");
+	glad_glGetFloati_v = (PFNGLGETFLOATI_VPROC)load("glGetFloati_v");
+	glad_glGetDoublei_v = (PFNGLGETDOUBLEI_VPROC)load("glGetDoublei_v");
+}
+static void load_GL_VERSION_4_2(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_2) return;
+	glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)load("glDrawArraysInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)load("glDrawElementsInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)load("glDrawElementsInstancedBaseVertexBaseInstance");
+	glad_glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)load("glGetInternalformativ");
+	glad_glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)load("glGetActiveAtomicCounterBufferiv");
+	glad_glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)load("glBindImageTexture");
+	glad_glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)load("glMemoryBarrier");
+	glad_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)load("glTexStorage1D");
+	glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)load("glTexStorage2D");
+	glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)load("glTexStorage3D");
+	glad_glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)load("glDrawTransformFeedbackInstanced");
+	glad_glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)load("glDrawTransformFeedbackStreamInstanced");
+}
+static void load_GL_VERSION_4_3(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_3) return;
+	glad_glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)load("glClearBufferData");
+	glad_glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)load("glClearBufferSubData");
+	glad_glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)load("glDispatchCompute");
+	glad_glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)load("glDispatchComputeIndirect");
+	glad_glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)load("glCopyImageSubData");
+	glad_glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)load("glFramebufferParameteri");
+	glad_glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)load("glGetFramebufferParameteriv");
+	glad_glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)load("glGetInternalformati64v");
+	glad_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)load("glInvalidateTexSubImage");
+	glad_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)load("glInvalidateTexImage");
+	glad_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)load("glInvalidateBufferSubData");
+	glad_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)load("glInvalidateBufferData");
+	glad_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)load("glInvalidateFramebuffer");
+	glad_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)load("glInvalidateSubFramebuffer");
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)load("glMultiDrawArraysIndirect");
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
+	glad_glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)load("glGetProgramInterfaceiv");
+	glad_glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)load("glGetProgramResourceIndex");
+	glad_glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)load("glGetProgramResourceName");
+	glad_glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)load("glGetProgramResourceiv");
+	glad_glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)load("glGetProgramResourceLocation");
+	glad_glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)load("glGetProgramResourceLocationIndex");
+	glad_glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)load("glShaderStorageBlockBinding");
+	glad_glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC)load("glTexBufferRange");
+	glad_glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)load("glTexStorage2DMultisample");
+	glad_glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)load("glTexStorage3DMultisample");
+	glad_glTextureView = (PFNGLTEXTUREVIEWPROC)load("glTextureView");
+	glad_glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)load("glBindVertexBuffer");
+	glad_glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)load("glVertexAttribFormat");
+	glad_glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)load("glVertexAttribIFormat");
+	glad_glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)load("glVertexAttribLFormat");
+	glad_glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)load("glVertexAttribBinding");
+	glad_glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)load("glVertexBindingDivisor");
+	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)load("glDebugMessageControl");
+	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)load("glDebugMessageInsert");
+	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
+	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)load("glGetDebugMessageLog");
+	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)load("glPushDebugGroup");
+	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)load("glPopDebugGroup");
+	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)load("glObjectLabel");
+	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)load("glGetObjectLabel");
+	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)load("glObjectPtrLabel");
+	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)load("glGetObjectPtrLabel");
+}
+static void load_GL_VERSION_4_4(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_4) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+	glad_glClearTexImage = (PFNGLCLEARTEXIMAGEPROC)load("glClearTexImage");
+	glad_glClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC)load("glClearTexSubImage");
+	glad_glBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC)load("glBindBuffersBase");
+	glad_glBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC)load("glBindBuffersRange");
+	glad_glBindTextures = (PFNGLBINDTEXTURESPROC)load("glBindTextures");
+	glad_glBindSamplers = (PFNGLBINDSAMPLERSPROC)load("glBindSamplers");
+	glad_glBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC)load("glBindImageTextures");
+	glad_glBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC)load("glBindVertexBuffers");
+}
+static void load_GL_VERSION_4_5(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_5) return;
+	glad_glClipControl = (PFNGLCLIPCONTROLPROC)load("glClipControl");
+	glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)load("glCreateTransformFeedbacks");
+	glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)load("glTransformFeedbackBufferBase");
+	glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)load("glTransformFeedbackBufferRange");
+	glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)load("glGetTransformFeedbackiv");
+	glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)load("glGetTransformFeedbacki_v");
+	glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)load("glGetTransformFeedbacki64_v");
+	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)load("glCreateBuffers");
+	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)load("glNamedBufferStorage");
+	glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)load("glNamedBufferData");
+	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)load("glNamedBufferSubData");
+	glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)load("glCopyNamedBufferSubData");
+	glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)load("glClearNamedBufferData");
+	glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)load("glClearNamedBufferSubData");
+	glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)load("glMapNamedBuffer");
+	glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)load("glMapNamedBufferRange");
+	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)load("glUnmapNamedBuffer");
+	glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)load("glFlushMappedNamedBufferRange");
+	glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)load("glGetNamedBufferParameteriv");
+	glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)load("glGetNamedBufferParameteri64v");
+	glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)load("glGetNamedBufferPointerv");
+	glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)load("glGetNamedBufferSubData");
+	glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)load("glCreateFramebuffers");
+	glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)load("glNamedFramebufferRenderbuffer");
+	glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)load("glNamedFramebufferParameteri");
+	glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)load("glNamedFramebufferTexture");
+	glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)load("glNamedFramebufferTextureLayer");
+	glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)load("glNamedFramebufferDrawBuffer");
+	glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)load("glNamedFramebufferDrawBuffers");
+	glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)load("glNamedFramebufferReadBuffer");
+	glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)load("glInvalidateNamedFramebufferData");
+	glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)load("glInvalidateNamedFramebufferSubData");
+	glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)load("glClearNamedFramebufferiv");
+	glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)load("glClearNamedFramebufferuiv");
+	glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)load("glClearNamedFramebufferfv");
+	glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)load("glClearNamedFramebufferfi");
+	glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)load("glBlitNamedFramebuffer");
+	glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)load("glCheckNamedFramebufferStatus");
+	glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)load("glGetNamedFramebufferParameteriv");
+	glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetNamedFramebufferAttachmentParameteriv");
+	glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)load("glCreateRenderbuffers");
+	glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)load("glNamedRenderbufferStorage");
+	glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glNamedRenderbufferStorageMultisample");
+	glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)load("glGetNamedRenderbufferParameteriv");
+	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)load("glCreateTextures");
+	glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)load("glTextureBuffer");
+	glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)load("glTextureBufferRange");
+	glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)load("glTextureStorage1D");
+	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)load("glTextureStorage2D");
+	glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)load("glTextureStorage3D");
+	glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)load("glTextureStorage2DMultisample");
+	glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)load("glTextureStorage3DMultisample");
+	glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)load("glTextureSubImage1D");
+	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)load("glTextureSubImage2D");
+	glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)load("glTextureSubImage3D");
+	glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)load("glCompressedTextureSubImage1D");
+	glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)load("glCompressedTextureSubImage2D");
+	glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)load("glCompressedTextureSubImage3D");
+	glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)load("glCopyTextureSubImage1D");
+	glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)load("glCopyTextureSubImage2D");
+	glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)load("glCopyTextureSubImage3D");
+	glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)load("glTextureParameterf");
+	glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)load("glTextureParameterfv");
+	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)load("glTextureParameteri");
+	glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)load("glTextureParameterIiv");
+	glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)load("glTextureParameterIuiv");
+	glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)load("glTextureParameteriv");
+	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)load("glGenerateTextureMipmap");
+	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)load("glBindTextureUnit");
+	glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)load("glGetTextureImage");
+	glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)load("glGetCompressedTextureImage");
+	glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)load("glGetTextureLevelParameterfv");
+	glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)load("glGetTextureLevelParameteriv");
+	glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)load("glGetTextureParameterfv");
+	glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)load("glGetTextureParameterIiv");
+	glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)load("glGetTextureParameterIuiv");
+	glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)load("glGetTextureParameteriv");
+	glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)load("glCreateVertexArrays");
+	glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)load("glDisableVertexArrayAttrib");
+	glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)load("glEnableVertexArrayAttrib");
+	glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)load("glVertexArrayElementBuffer");
+	glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)load("glVertexArrayVertexBuffer");
+	glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)load("glVertexArrayVertexBuffers");
+	glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)load("glVertexArrayAttribBinding");
+	glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)load("glVertexArrayAttribFormat");
+	glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)load("glVertexArrayAttribIFormat");
+	glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)load("glVertexArrayAttribLFormat");
+	glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)load("glVertexArrayBindingDivisor");
+	glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)load("glGetVertexArrayiv");
+	glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)load("glGetVertexArrayIndexediv");
+	glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)load("glGetVertexArrayIndexed64iv");
+	glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)load("glCreateSamplers");
+	glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)load("glCreateProgramPipelines");
+	glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)load("glCreateQueries");
+	glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)load("glGetQueryBufferObjecti64v");
+	glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)load("glGetQueryBufferObjectiv");
+	glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)load("glGetQueryBufferObjectui64v");
+	glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)load("glGetQueryBufferObjectuiv");
+	glad_glMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC)load("glMemoryBarrierByRegion");
+	glad_glGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC)load("glGetTextureSubImage");
+	glad_glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)load("glGetCompressedTextureSubImage");
+	glad_glGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC)load("glGetGraphicsResetStatus");
+	glad_glGetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC)load("glGetnCompressedTexImage");
+	glad_glGetnTexImage = (PFNGLGETNTEXIMAGEPROC)load("glGetnTexImage");
+	glad_glGetnUniformdv = (PFNGLGETNUNIFORMDVPROC)load("glGetnUniformdv");
+	glad_glGetnUniformfv = (PFNGLGETNUNIFORMFVPROC)load("glGetnUniformfv");
+	glad_glGetnUniformiv = (PFNGLGETNUNIFORMIVPROC)load("glGetnUniformiv");
+	glad_glGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC)load("glGetnUniformuiv");
+	glad_glReadnPixels = (PFNGLREADNPIXELSPROC)load("glReadnPixels");
+	glad_glTextureBarrier = (PFNGLTEXTUREBARRIERPROC)load("glTextureBarrier");
+}
+static void load_GL_VERSION_4_6(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_4_6) return;
+	glad_glSpecializeShader = (PFNGLSPECIALIZESHADERPROC)load("glSpecializeShader");
+	glad_glMultiDrawArraysIndirectCount = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)load("glMultiDrawArraysIndirectCount");
+	glad_glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)load("glMultiDrawElementsIndirectCount");
+	glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)load("glPolygonOffsetClamp");
+}
+static void load_GL_ARB_buffer_storage(GLADloadproc load) {
+	if(!GLAD_GL_ARB_buffer_storage) return;
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)load("glBufferStorage");
+}
+static void load_GL_ARB_direct_state_access(GLADloadproc load) {
+	if(!GLAD_GL_ARB_direct_state_access) return;
+	glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)load("glCreateTransformFeedbacks");
+	glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)load("glTransformFeedbackBufferBase");
+	glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)load("glTransformFeedbackBufferRange");
+	glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)load("glGetTransformFeedbackiv");
+	glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)load("glGetTransformFeedbacki_v");
+	glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)load("glGetTransformFeedbacki64_v");
+	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)load("glCreateBuffers");
+	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)load("glNamedBufferStorage");
+	glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)load("glNamedBufferData");
+	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)load("glNamedBufferSubData");
+	glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)load("glCopyNamedBufferSubData");
+	glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)load("glClearNamedBufferData");
+	glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)load("glClearNamedBufferSubData");
+	glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)load("glMapNamedBuffer");
+	glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)load("glMapNamedBufferRange");
+	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)load("glUnmapNamedBuffer");
+	glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)load("glFlushMappedNamedBufferRange");
+	glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)load("glGetNamedBufferParameteriv");
+	glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)load("glGetNamedBufferParameteri64v");
+	glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)load("glGetNamedBufferPointerv");
+	glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)load("glGetNamedBufferSubData");
+	glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)load("glCreateFramebuffers");
+	glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)load("glNamedFramebufferRenderbuffer");
+	glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)load("glNamedFramebufferParameteri");
+	glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)load("glNamedFramebufferTexture");
+	glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)load("glNamedFramebufferTextureLayer");
+	glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)load("glNamedFramebufferDrawBuffer");
+	glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)load("glNamedFramebufferDrawBuffers");
+	glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)load("glNamedFramebufferReadBuffer");
+	glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)load("glInvalidateNamedFramebufferData");
+	glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)load("glInvalidateNamedFramebufferSubData");
+	glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)load("glClearNamedFramebufferiv");
+	glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)load("glClearNamedFramebufferuiv");
+	glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)load("glClearNamedFramebufferfv");
+	glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)load("glClearNamedFramebufferfi");
+	glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)load("glBlitNamedFramebuffer");
+	glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)load("glCheckNamedFramebufferStatus");
+	glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)load("glGetNamedFramebufferParameteriv");
+	glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetNamedFramebufferAttachmentParameteriv");
+	glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)load("glCreateRenderbuffers");
+	glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)load("glNamedRenderbufferStorage");
+	glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glNamedRenderbufferStorageMultisample");
+	glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)load("glGetNamedRenderbufferParameteriv");
+	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)load("glCreateTextures");
+	glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)load("glTextureBuffer");
+	glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)load("glTextureBufferRange");
+	glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)load("glTextureStorage1D");
+	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)load("glTextureStorage2D");
+	glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)load("glTextureStorage3D");
+	glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)load("glTextureStorage2DMultisample");
+	glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)load("glTextureStorage3DMultisample");
+	glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)load("glTextureSubImage1D");
+	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)load("glTextureSubImage2D");
+	glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)load("glTextureSubImage3D");
+	glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)load("glCompressedTextureSubImage1D");
+	glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)load("glCompressedTextureSubImage2D");
+	glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)load("glCompressedTextureSubImage3D");
+	glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)load("glCopyTextureSubImage1D");
+	glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)load("glCopyTextureSubImage2D");
+	glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)load("glCopyTextureSubImage3D");
+	glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)load("glTextureParameterf");
+	glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)load("glTextureParameterfv");
+	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)load("glTextureParameteri");
+	glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)load("glTextureParameterIiv");
+	glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)load("glTextureParameterIuiv");
+	glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)load("glTextureParameteriv");
+	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)load("glGenerateTextureMipmap");
+	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)load("glBindTextureUnit");
+	glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)load("glGetTextureImage");
+	glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)load("glGetCompressedTextureImage");
+	glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)load("glGetTextureLevelParameterfv");
+	glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)load("glGetTextureLevelParameteriv");
+	glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)load("glGetTextureParameterfv");
+	glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)load("glGetTextureParameterIiv");
+	glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)load("glGetTextureParameterIuiv");
+	glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)load("glGetTextureParameteriv");
+	glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)load("glCreateVertexArrays");
+	glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)load("glDisableVertexArrayAttrib");
+	glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)load("glEnableVertexArrayAttrib");
+	glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)load("glVertexArrayElementBuffer");
+	glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)load("glVertexArrayVertexBuffer");
+	glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)load("glVertexArrayVertexBuffers");
+	glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)load("glVertexArrayAttribBinding");
+	glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)load("glVertexArrayAttribFormat");
+	glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)load("glVertexArrayAttribIFormat");
+	glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)load("glVertexArrayAttribLFormat");
+	glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)load("glVertexArrayBindingDivisor");
+	glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)load("glGetVertexArrayiv");
+	glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)load("glGetVertexArrayIndexediv");
+	glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)load("glGetVertexArrayIndexed64iv");
+	glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)load("glCreateSamplers");
+	glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)load("glCreateProgramPipelines");
+	glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)load("glCreateQueries");
+	glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)load("glGetQueryBufferObjecti64v");
+	glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)load("glGetQueryBufferObjectiv");
+	glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)load("glGetQueryBufferObjectui64v");
+	glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)load("glGetQueryBufferObjectuiv");
+}
+static void load_GL_ARB_get_program_binary(GLADloadproc load) {
+	if(!GLAD_GL_ARB_get_program_binary) return;
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)load("glGetProgramBinary");
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)load("glProgramBinary");
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+}
+static void load_GL_ARB_gl_spirv(GLADloadproc load) {
+	if(!GLAD_GL_ARB_gl_spirv) return;
+	glad_glSpecializeShaderARB = (PFNGLSPECIALIZESHADERARBPROC)load("glSpecializeShaderARB");
+}
+static void load_GL_ARB_multi_draw_indirect(GLADloadproc load) {
+	if(!GLAD_GL_ARB_multi_draw_indirect) return;
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)load("glMultiDrawArraysIndirect");
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)load("glMultiDrawElementsIndirect");
+}
+static void load_GL_ARB_separate_shader_objects(GLADloadproc load) {
+	if(!GLAD_GL_ARB_separate_shader_objects) return;
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)load("glProgramParameteri");
+	glad_glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)load("glUseProgramStages");
+	glad_glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)load("glActiveShaderProgram");
+	glad_glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)load("glCreateShaderProgramv");
+	glad_glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)load("glBindProgramPipeline");
+	glad_glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)load("glDeleteProgramPipelines");
+	glad_glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)load("glGenProgramPipelines");
+	glad_glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)load("glIsProgramPipeline");
+	glad_glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)load("glGetProgramPipelineiv");
+	glad_glProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC)load("glProgramUniform1i");
+	glad_glProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC)load("glProgramUniform1iv");
+	glad_glProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC)load("glProgramUniform1f");
+	glad_glProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC)load("glProgramUniform1fv");
+	glad_glProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC)load("glProgramUniform1d");
+	glad_glProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC)load("glProgramUniform1dv");
+	glad_glProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)load("glProgramUniform1ui");
+	glad_glProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC)load("glProgramUniform1uiv");
+	glad_glProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC)load("glProgramUniform2i");
+	glad_glProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC)load("glProgramUniform2iv");
+	glad_glProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC)load("glProgramUniform2f");
+	glad_glProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC)load("glProgramUniform2fv");
+	glad_glProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC)load("glProgramUniform2d");
+	glad_glProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC)load("glProgramUniform2dv");
+	glad_glProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC)load("glProgramUniform2ui");
+	glad_glProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC)load("glProgramUniform2uiv");
+	glad_glProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC)load("glProgramUniform3i");
+	glad_glProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC)load("glProgramUniform3iv");
+	glad_glProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC)load("glProgramUniform3f");
+	glad_glProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC)load("glProgramUniform3fv");
+	glad_glProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC)load("glProgramUniform3d");
+	glad_glProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC)load("glProgramUniform3dv");
+	glad_glProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC)load("glProgramUniform3ui");
+	glad_glProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC)load("glProgramUniform3uiv");
+	glad_glProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC)load("glProgramUniform4i");
+	glad_glProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC)load("glProgramUniform4iv");
+	glad_glProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC)load("glProgramUniform4f");
+	glad_glProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)load("glProgramUniform4fv");
+	glad_glProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC)load("glProgramUniform4d");
+	glad_glProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC)load("glProgramUniform4dv");
+	glad_glProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC)load("glProgramUniform4ui");
+	glad_glProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC)load("glProgramUniform4uiv");
+	glad_glProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)load("glProgramUniformMatrix2fv");
+	glad_glProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)load("glProgramUniformMatrix3fv");
+	glad_glProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)load("glProgramUniformMatrix4fv");
+	glad_glProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)load("glProgramUniformMatrix2dv");
+	glad_glProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)load("glProgramUniformMatrix3dv");
+	glad_glProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)load("glProgramUniformMatrix4dv");
+	glad_glProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)load("glProgramUniformMatrix2x3fv");
+	glad_glProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)load("glProgramUniformMatrix3x2fv");
+	glad_glProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)load("glProgramUniformMatrix2x4fv");
+	glad_glProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)load("glProgramUniformMatrix4x2fv");
+	glad_glProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)load("glProgramUniformMatrix3x4fv");
+	glad_glProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)load("glProgramUniformMatrix4x3fv");
+	glad_glProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)load("glProgramUniformMatrix2x3dv");
+	glad_glProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)load("glProgramUniformMatrix3x2dv");
+	glad_glProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)load("glProgramUniformMatrix2x4dv");
+	glad_glProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)load("glProgramUniformMatrix4x2dv");
+	glad_glProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)load("glProgramUniformMatrix3x4dv");
+	glad_glProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)load("glProgramUniformMatrix4x3dv");
+	glad_glValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC)load("glValidateProgramPipeline");
+	glad_glGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)load("glGetProgramPipelineInfoLog");
+}
+static void load_GL_KHR_debug(GLADloadproc load) {
+	if(!GLAD_GL_KHR_debug) return;
+	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)load("glDebugMessageControl");
+	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)load("glDebugMessageInsert");
+	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)load("glDebugMessageCallback");
+	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)load("glGetDebugMessageLog");
+	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)load("glPushDebugGroup");
+	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)load("glPopDebugGroup");
+	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)load("glObjectLabel");
+	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)load("glGetObjectLabel");
+	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)load("glObjectPtrLabel");
+	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)load("glGetObjectPtrLabel");
+	glad_glGetPointerv = (PFNGLGETPOINTERVPROC)load("glGetPointerv");
+}
+static void load_GL_KHR_parallel_shader_compile(GLADloadproc load) {
+	if(!GLAD_GL_KHR_parallel_shader_compile) return;
+	glad_glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)load("glMaxShaderCompilerThreadsKHR");
+}
+#endif
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
-	(void)&has_ext;
-	free_exts();
+	GLAD_GL_ARB_buffer_storage = has_ext("GL_ARB_buffer_storage");
+	GLAD_GL_ARB_direct_state_access = has_ext("GL_ARB_direct_state_access");
+	GLAD_GL_ARB_get_program_binary = has_ext("GL_ARB_get_program_binary");
+	GLAD_GL_ARB_gl_spirv = has_ext("GL_ARB_gl_spirv");
+	GLAD_GL_ARB_multi_draw_indirect = has_ext("GL_ARB_multi_draw_indirect");
+	GLAD_GL_ARB_separate_shader_objects = has_ext("GL_ARB_separate_shader_objects");
+	GLAD_GL_KHR_debug = has_ext("GL_KHR_debug");
+	GLAD_GL_KHR_parallel_shader_compile = has_ext("GL_KHR_parallel_shader_compile");
 	return 1;
 }
 
@@ -1789,12 +2881,20 @@ static void find_coreGL(void) {
 	GLAD_GL_VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
 	GLAD_GL_VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
 	GLAD_GL_VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
-	if (GLVersion.major > 3 || (GLVersion.major >= 3 && GLVersion.minor >= 3)) {
-		max_loaded_major = 3;
-		max_loaded_minor = 3;
+	GLAD_GL_VERSION_4_0 = (major == 4 && minor >= 0) || major > 4;
+	GLAD_GL_VERSION_4_1 = (major == 4 && minor >= 1) || major > 4;
+	GLAD_GL_VERSION_4_2 = (major == 4 && minor >= 2) || major > 4;
+	GLAD_GL_VERSION_4_3 = (major == 4 && minor >= 3) || major > 4;
+	GLAD_GL_VERSION_4_4 = (major == 4 && minor >= 4) || major > 4;
+	GLAD_GL_VERSION_4_5 = (major == 4 && minor >= 5) || major > 4;
+	GLAD_GL_VERSION_4_6 = (major == 4 && minor >= 6) || major > 4;
+	if (GLVersion.major > 4 || (GLVersion.major >= 4 && GLVersion.minor >= 6)) {
+		max_loaded_major = 4;
+		max_loaded_minor = 6;
 	}
 }
 
+#ifndef GLAD_TRIMMED
 int gladLoadGLLoader(GLADloadproc load) {
 	GLVersion.major = 0; GLVersion.minor = 0;
 	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
@@ -1813,8 +2913,452 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_VERSION_3_1(load);
 	load_GL_VERSION_3_2(load);
 	load_GL_VERSION_3_3(load);
+	load_GL_VERSION_4_0(load);
+	load_GL_VERSION_4_1(load);
+	load_GL_VERSION_4_2(load);
+	load_GL_VERSION_4_3(load);
+	load_GL_VERSION_4_4(load);
+	load_GL_VERSION_4_5(load);
+	load_GL_VERSION_4_6(load);
 
 	if (!find_extensionsGL()) return 0;
+	load_GL_ARB_buffer_storage(load);
+	load_GL_ARB_direct_state_access(load);
+	load_GL_ARB_get_program_binary(load);
+	load_GL_ARB_gl_spirv(load);
+	load_GL_ARB_multi_draw_indirect(load);
+	load_GL_ARB_separate_shader_objects(load);
+	load_GL_KHR_debug(load);
+	load_GL_KHR_parallel_shader_compile(load);
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+#else
+/* Trimmed build: only the listed entry points exist. The extension flags
+   are needed to know which of them to load, so they are read first */
+int gladLoadGLLoader(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)load("glGetIntegerv");
+	if (GLAD_GL_VERSION_3_0) glad_glGetStringi = (PFNGLGETSTRINGIPROC)load("glGetStringi");
+	if (!find_extensionsGL()) return 0;
+
+#define GLAD_PROC(ret, name, pfn, params, args, feature) \
+	glad_gl##name = feature ? (pfn)load("gl" #name) : NULL;
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) \
+	glad_gl##name = feature ? (pfn)load("gl" #name) : NULL;
+#include GLAD_PROCS
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
+#endif
+
+
+#ifndef GLAD_NO_LAZY
+/*
+ * Lazy loading.
+ *
+ * Every entry point starts out pointing at a trampoline with the same
+ * signature. The first call resolves the real symbol through the loader,
+ * patches glad_gl* and forwards the call, so only the functions a program
+ * actually uses are ever looked up. Two threads racing on the first call
+ * both store the same pointer, which is harmless. A symbol the loader
+ * can't find aborts with its name instead of calling NULL.
+ */
+static GLADloadproc lazy_load = NULL;
+
+/* The context promised the function (it has a trampoline) but the loader
+   doesn't have it. Jumping through NULL would crash somewhere less obvious,
+   so say which one and stop here */
+static void* lazy_resolve(const char *name) {
+	void *proc = lazy_load(name);
+	if(proc == NULL) {
+		fprintf(stderr, "glad: %s is not available from the GL library!\n", name);
+		abort();
+	}
+	return proc;
+}
+
+#define GLAD_PROC(ret, name, pfn, params, args, feature) \
+	static ret APIENTRY glad_lazy_gl##name params { \
+		glad_gl##name = (pfn)lazy_resolve("gl" #name); \
+		return glad_gl##name args; \
+	}
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) \
+	static void APIENTRY glad_lazy_gl##name params { \
+		glad_gl##name = (pfn)lazy_resolve("gl" #name); \
+		glad_gl##name args; \
+	}
+#include GLAD_PROCS
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+
+/* Entry points outside the reported version stay NULL, as they would
+   with gladLoadGLLoader(), so existing NULL checks keep working */
+static void load_lazy(void) {
+#define GLAD_PROC(ret, name, pfn, params, args, feature) \
+	glad_gl##name = feature ? glad_lazy_gl##name : NULL;
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) \
+	glad_gl##name = feature ? glad_lazy_gl##name : NULL;
+#include GLAD_PROCS
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+}
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	lazy_load = load;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+
+	/* Extension flags decide which entry points get trampolines, so look
+	   them up first. The two functions that needs are reset to their
+	   trampolines afterwards */
+	glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)load("glGetIntegerv");
+	if (GLAD_GL_VERSION_3_0) glad_glGetStringi = (PFNGLGETSTRINGIPROC)load("glGetStringi");
+	if (!find_extensionsGL()) return 0;
+
+	load_lazy();
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+#endif
+
+static GLAD_THREAD_LOCAL struct gladGLContext *current_context = NULL;
+
+int gladLoadGLContext(struct gladGLContext *ctx, GLADloadproc load) {
+	struct ext_registry *reg;
+
+	memset(ctx, 0, sizeof(*ctx));
+	if (!gladLoadGLLoader(load)) return 0;
+
+	/* Take the freshly built extension registry over from this thread */
+	reg = (struct ext_registry *)malloc(sizeof(*reg));
+	if (reg == NULL) return 0;
+	*reg = exts_loaded;
+	memset(&exts_loaded, 0, sizeof(exts_loaded));
+	exts = reg;
+
+	ctx->version = GLVersion;
+#define GLAD_FEATURE(feature) ctx->feature = feature;
+#define GLAD_PROC(ret, name, pfn, params, args, feature) ctx->name = glad_gl##name;
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) ctx->name = glad_gl##name;
+#include GLAD_PROCS
+#undef GLAD_FEATURE
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+	ctx->extensions = reg;
+
+	current_context = ctx;
+	return 1;
+}
+
+void gladMakeGLContextCurrent(struct gladGLContext *ctx) {
+	current_context = ctx;
+	if (ctx == NULL) return;
+
+	GLVersion = ctx->version;
+	max_loaded_major = ctx->version.major;
+	max_loaded_minor = ctx->version.minor;
+#define GLAD_FEATURE(feature) feature = ctx->feature;
+#define GLAD_PROC(ret, name, pfn, params, args, feature) glad_gl##name = ctx->name;
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) glad_gl##name = ctx->name;
+#include GLAD_PROCS
+#undef GLAD_FEATURE
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+	exts = (struct ext_registry *)ctx->extensions;
+}
+
+struct gladGLContext *gladGetCurrentGLContext(void) {
+	return current_context;
+}
+
+void gladFreeGLContext(struct gladGLContext *ctx) {
+	struct ext_registry *reg = (struct ext_registry *)ctx->extensions;
+
+	if (reg != NULL) {
+		if (exts == reg) exts = NULL;
+		free_exts(reg);
+		free(reg);
+		ctx->extensions = NULL;
+	}
+	if (current_context == ctx) current_context = NULL;
+}
+
+/* Position of every entry point in the full glad_procs.h list, which is
+   what callers of gladGetProcSlot() index by even in trimmed builds */
+enum glad_proc_index {
+#define GLAD_PROC(ret, name, pfn, params, args, feature) GLAD_INDEX_##name,
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) GLAD_INDEX_##name,
+#include <glad/glad_procs.h>
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+	GLAD_INDEX_COUNT
+};
+
+void **gladGetProcSlot(int index) {
+	switch(index) {
+#define GLAD_PROC(ret, name, pfn, params, args, feature) \
+	case GLAD_INDEX_##name: return (void **)&glad_gl##name;
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) \
+	case GLAD_INDEX_##name: return (void **)&glad_gl##name;
+#include GLAD_PROCS
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+	}
+	return NULL;
+}
+
+void **gladResolveProcSlot(int index) {
+#ifndef GLAD_NO_LAZY
+	void *proc;
 
+	/* A trampoline copied elsewhere would patch the slot on its first
+	   call, behind the back of whoever copied it */
+	switch(index) {
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) \
+	case GLAD_INDEX_##name: \
+		if (glad_gl##name == glad_lazy_gl##name && (proc = lazy_load("gl" #name)) != NULL) \
+			glad_gl##name = (pfn)proc; \
+		break;
+#define GLAD_PROC(ret, name, pfn, params, args, feature) GLAD_PROC_VOID(name, pfn, params, args, feature)
+#include GLAD_PROCS
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+	}
+#endif
+	return gladGetProcSlot(index);
+}
+
+int gladVerifyGL(void (*report)(const char *name)) {
+	int missing = 0;
+
+#define GLAD_PROC(ret, name, pfn, params, args, feature) \
+	if ((feature) && glad_gl##name == NULL) { \
+		missing++; \
+		if (report != NULL) report("gl" #name); \
+	}
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) GLAD_PROC(void, name, pfn, params, args, feature)
+#include GLAD_PROCS
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+
+	return missing;
+}
+
+#ifndef GLAD_NO_NULL_DRIVER
+/*
+ * Null driver.
+ *
+ * A loader that hands out do-nothing implementations of every entry point,
+ * for measuring the CPU cost of a render loop without any driver work and
+ * without needing a GPU or a context. Most functions return 0, the ones a
+ * program checks during startup return something plausible: the version
+ * strings report 3.3, object names count up from 1, compile and link
+ * status are GL_TRUE and framebuffers are always complete.
+ */
+static GLuint null_next_name = 1;
+static void *null_mapping = NULL;
+static GLsizeiptr null_mapping_size = 0;
+
+#define GLAD_PROC(ret, name, pfn, params, args, feature) \
+	static ret APIENTRY glad_null_gl##name params { return (ret)0; }
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) \
+	static void APIENTRY glad_null_gl##name params { }
+#include GLAD_PROCS
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+
+static const GLubyte * APIENTRY null_GetString(GLenum name) {
+	switch(name) {
+	case GL_VENDOR: return (const GLubyte *)"glad";
+	case GL_RENDERER: return (const GLubyte *)"null driver";
+	case GL_VERSION: return (const GLubyte *)"3.3.0 glad null driver";
+	case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte *)"3.30";
+	case GL_EXTENSIONS: return (const GLubyte *)"";
+	}
+	return NULL;
+}
+
+static void APIENTRY null_GetIntegerv(GLenum pname, GLint *data) {
+	switch(pname) {
+	case GL_MAJOR_VERSION: data[0] = 3; break;
+	case GL_MINOR_VERSION: data[0] = 3; break;
+	case GL_VIEWPORT:
+	case GL_SCISSOR_BOX:
+		data[0] = data[1] = data[2] = data[3] = 0;
+		break;
+	default: data[0] = 0; break;
+	}
+}
+
+static void APIENTRY null_GenNames(GLsizei n, GLuint *names) {
+	GLsizei i;
+	for(i = 0; i < n; i++) names[i] = null_next_name++;
+}
+
+static GLuint APIENTRY null_CreateObject(void) {
+	return null_next_name++;
+}
+
+static GLuint APIENTRY null_CreateShader(GLenum type) {
+	(void)type;
+	return null_next_name++;
+}
+
+static void APIENTRY null_GetObjectiv(GLuint object, GLenum pname, GLint *params) {
+	(void)object;
+	switch(pname) {
+	case GL_COMPILE_STATUS:
+	case GL_LINK_STATUS:
+	case GL_VALIDATE_STATUS:
+	case GL_DELETE_STATUS:
+		params[0] = GL_TRUE;
+		break;
+	default: params[0] = 0; break;
+	}
+}
+
+static void APIENTRY null_GetInfoLog(GLuint object, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	(void)object;
+	if(length != NULL) *length = 0;
+	if(infoLog != NULL && bufSize > 0) infoLog[0] = '\0';
+}
+
+static GLenum APIENTRY null_CheckFramebufferStatus(GLenum target) {
+	(void)target;
+	return GL_FRAMEBUFFER_COMPLETE;
+}
+
+/* Mappings share one scratch block, large enough for the biggest buffer */
+static void *null_scratch(GLsizeiptr size) {
+	if(size > null_mapping_size) {
+		void *grown = realloc(null_mapping, (size_t)size);
+		if(grown == NULL) return NULL;
+		null_mapping = grown;
+		null_mapping_size = size;
+	}
+	return null_mapping;
+}
+
+static void APIENTRY null_BufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	(void)target; (void)data; (void)usage;
+	null_scratch(size);
+}
+
+static void * APIENTRY null_MapBuffer(GLenum target, GLenum access) {
+	(void)target; (void)access;
+	return null_scratch(1);
+}
+
+static void * APIENTRY null_MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	(void)target; (void)offset; (void)access;
+	return null_scratch(length);
+}
+
+static GLsync APIENTRY null_FenceSync(GLenum condition, GLbitfield flags) {
+	(void)condition; (void)flags;
+	return (GLsync)(size_t)null_next_name++;
+}
+
+static GLenum APIENTRY null_ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	(void)sync; (void)flags; (void)timeout;
+	return GL_ALREADY_SIGNALED;
+}
+
+struct null_proc {
+	const char *name;
+	void *proc;
+};
+
+static const struct null_proc NULL_OVERRIDES[] = {
+	{"glGetString", (void*)null_GetString},
+	{"glGetIntegerv", (void*)null_GetIntegerv},
+	{"glGenBuffers", (void*)null_GenNames},
+	{"glGenVertexArrays", (void*)null_GenNames},
+	{"glGenTextures", (void*)null_GenNames},
+	{"glGenFramebuffers", (void*)null_GenNames},
+	{"glGenRenderbuffers", (void*)null_GenNames},
+	{"glGenQueries", (void*)null_GenNames},
+	{"glGenSamplers", (void*)null_GenNames},
+	{"glCreateProgram", (void*)null_CreateObject},
+	{"glCreateShader", (void*)null_CreateShader},
+	{"glGetShaderiv", (void*)null_GetObjectiv},
+	{"glGetProgramiv", (void*)null_GetObjectiv},
+	{"glGetShaderInfoLog", (void*)null_GetInfoLog},
+	{"glGetProgramInfoLog", (void*)null_GetInfoLog},
+	{"glCheckFramebufferStatus", (void*)null_CheckFramebufferStatus},
+	{"glBufferData", (void*)null_BufferData},
+	{"glMapBuffer", (void*)null_MapBuffer},
+	{"glMapBufferRange", (void*)null_MapBufferRange},
+	{"glFenceSync", (void*)null_FenceSync},
+	{"glClientWaitSync", (void*)null_ClientWaitSync}
+};
+
+static const struct null_proc NULL_PROCS[] = {
+#define GLAD_PROC(ret, name, pfn, params, args, feature) {"gl" #name, (void*)glad_null_gl##name},
+#define GLAD_PROC_VOID(name, pfn, params, args, feature) {"gl" #name, (void*)glad_null_gl##name},
+#include GLAD_PROCS
+#undef GLAD_PROC
+#undef GLAD_PROC_VOID
+	{NULL, NULL}
+};
+
+/* Open addressing by the FNV-1a hash of the name, like the extension
+   registry, so an eager load does one probe per entry point instead of a
+   scan of the whole list. Slots hold 1 + the index into NULL_OVERRIDES
+   followed by NULL_PROCS, 0 when empty. Filled on the first lookup */
+#define NULL_SLOTS 4096
+#define NULL_OVERRIDE_COUNT (sizeof(NULL_OVERRIDES) / sizeof(NULL_OVERRIDES[0]))
+#define NULL_PROC_COUNT (sizeof(NULL_PROCS) / sizeof(NULL_PROCS[0]) - 1)
+
+static GLAD_THREAD_LOCAL unsigned short null_slots[NULL_SLOTS];
+static GLAD_THREAD_LOCAL int null_slots_filled = 0;
+
+/* At most half full, or the probes get long */
+typedef char null_slots_fit[(NULL_OVERRIDE_COUNT + NULL_PROC_COUNT) * 2 <= NULL_SLOTS ? 1 : -1];
+
+static const struct null_proc *null_entry(unsigned int index) {
+	return index < NULL_OVERRIDE_COUNT ? &NULL_OVERRIDES[index] : &NULL_PROCS[index - NULL_OVERRIDE_COUNT];
+}
+
+/* The slot holding name, or the empty one it would go in */
+static unsigned int null_slot(const char *name) {
+	unsigned int slot = fnv1a32(FNV1A32_OFFSET, name, strlen(name)) & (NULL_SLOTS - 1);
+
+	while(null_slots[slot] != 0 && strcmp(null_entry(null_slots[slot] - 1u)->name, name) != 0) {
+		slot = (slot + 1) & (NULL_SLOTS - 1);
+	}
+
+	return slot;
+}
+
+static void fill_null_slots(void) {
+	unsigned int index, slot;
+
+	/* Overrides go in first, the stub of the same name finds them taken */
+	for(index = 0; index < NULL_OVERRIDE_COUNT + NULL_PROC_COUNT; index++) {
+		slot = null_slot(null_entry(index)->name);
+		if(null_slots[slot] == 0) null_slots[slot] = (unsigned short)(index + 1);
+	}
+
+	null_slots_filled = 1;
+}
+
+void* gladNullProc(const char *name) {
+	unsigned int slot;
+
+	if(!null_slots_filled) fill_null_slots();
+
+	slot = null_slot(name);
+	return null_slots[slot] != 0 ? null_entry(null_slots[slot] - 1u)->proc : NULL;
+}
+#endif
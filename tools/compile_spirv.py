@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""
+Compiles the shaders that have a SPIR-V version to SPIR-V for OpenGL
+(ARB_gl_spirv), next to their GLSL: shaders/Basic.vert becomes
+shaders/Basic.vert.spv and so on. Rerun it after editing one of them, the
+demos only ever load the .spv files.
+
+These sources are written for SPIR-V: every input and output has a
+location, GL can't match them by name. Their includes are pasted in the
+way tools/shader_pack.py does it first, so #include "Name.block" is the
+block DECLARE_BLOCK(Name, ...) in src/ declares, the same as for the
+packed GLSL.
+
+Usage:
+    python tools/compile_spirv.py [shader ...]
+
+Without arguments it compiles every shader in SPIRV_SHADERS. Set
+GLSLANG_VALIDATOR to use a different glslangValidator.
+"""
+
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+# Nothing of the tools should end up in the tree
+sys.dont_write_bytecode = True
+
+from shader_pack import find_blocks, resolve
+
+# Relative to the repository root
+SPIRV_SHADERS = ['shaders/Basic.vert', 'shaders/Basic.frag']
+
+
+def compile_spirv(compiler, source, blocks, scratch):
+    # Same file name, glslangValidator picks the stage from the extension
+    resolved = os.path.join(scratch, os.path.basename(source))
+
+    with open(resolved, 'w') as f:
+        f.write(resolve(source, blocks, set()))
+
+    # -G targets OpenGL rather than Vulkan
+    try:
+        return subprocess.call([compiler, '-G', '-o', source + '.spv', resolved])
+    except OSError:
+        raise ValueError('%s not found, set GLSLANG_VALIDATOR' % compiler)
+
+
+def main(argv):
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+    compiler = os.environ.get('GLSLANG_VALIDATOR', 'glslangValidator')
+    sources = argv[1:] or [os.path.join(root, path) for path in SPIRV_SHADERS]
+    scratch = tempfile.mkdtemp()
+
+    try:
+        blocks = find_blocks(os.path.join(root, 'src'))
+
+        for source in sources:
+            if compile_spirv(compiler, source, blocks, scratch) != 0:
+                sys.stderr.write('Unable to compile %s\n' % source)
+                return 1
+    except (IOError, OSError, ValueError) as error:
+        sys.stderr.write('%s\n' % error)
+        return 1
+    finally:
+        shutil.rmtree(scratch)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
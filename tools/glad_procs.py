@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+"""
+Generates include/glad/glad_procs.h, the X-macro list of every entry point
+declared in include/glad/glad.h.
+
+Each entry point becomes one line of the form
+
+    GLAD_PROC(ret, Name, PFNTYPE, (params), (args), feature)
+    GLAD_PROC_VOID(Name, PFNTYPE, (params), (args), feature)
+
+preceded by one GLAD_FEATURE(feature) line per version or extension block,
+where Name has the "gl" prefix removed and feature is the GLAD_GL_* flag
+of the version or extension block that declares it. Entry points that
+src/glad.c also loads for other blocks (core functions promoted from ARB
+or KHR extensions) get all of those flags OR'ed together instead, so
+feature is true whenever the loader would resolve the function.
+
+Usage: python tools/glad_procs.py [include/glad/glad.h [src/glad.c]] > include/glad/glad_procs.h
+"""
+
+import os
+import re
+import sys
+
+HEADER = """/*
+
+    Entry point list for the glad loader, generated from glad.h by
+    tools/glad_procs.py. Do not edit by hand, rerun the script instead.
+
+    Define GLAD_PROC(ret, name, pfn, params, args, feature) and
+    GLAD_PROC_VOID(name, pfn, params, args, feature) before including
+    this file, and optionally GLAD_FEATURE(feature). It has no include
+    guard on purpose, so it can be expanded several times with different
+    definitions.
+
+*/
+
+#ifndef GLAD_FEATURE
+#define GLAD_FEATURE(feature)
+#define GLAD_FEATURE_DEFAULTED
+#endif
+"""
+
+FOOTER = """
+#ifdef GLAD_FEATURE_DEFAULTED
+#undef GLAD_FEATURE
+#undef GLAD_FEATURE_DEFAULTED
+#endif
+"""
+
+TYPEDEF = re.compile(r'^typedef (.+?) ?\(APIENTRYP (PFN\w+)\)\((.*)\);$')
+FEATURE = re.compile(r'^GLAPI (?:GLAD_THREAD_LOCAL )?int (GLAD_GL_\w+);$')
+POINTER = re.compile(r'^GLAPI (?:GLAD_THREAD_LOCAL )?(PFN\w+) glad_gl(\w+);$')
+LOADER = re.compile(r'^static void load_(GL_\w+)\(GLADloadproc load\) \{$')
+LOAD = re.compile(r'^\tglad_gl(\w+) = \(PFN\w+\)load\(')
+
+# windows.h defines these as empty macros, which breaks the argument lists
+RENAME = {'near': 'nearVal', 'far': 'farVal'}
+
+
+def parse(path):
+    """Returns the feature names and a list of
+    (ret, name, pfn, params, args, feature) tuples."""
+    features = []
+    procs = []
+    typedefs = {}
+    feature = None
+
+    with open(path) as f:
+        for line in f:
+            line = line.rstrip()
+
+            m = FEATURE.match(line)
+            if m:
+                feature = m.group(1)
+                features.append(feature)
+                continue
+
+            m = TYPEDEF.match(line)
+            if m:
+                typedefs[m.group(2)] = (m.group(1).strip(), m.group(3).strip())
+                continue
+
+            m = POINTER.match(line)
+            if m:
+                pfn, name = m.group(1), m.group(2)
+                ret, params = typedefs[pfn]
+                params = rename_params(params)
+                procs.append((ret, name, pfn, params, arg_names(params), feature))
+
+    return features, procs
+
+
+def loaded_by(path):
+    """Returns {Name: [GLAD_GL_* flags of every load_* function loading it]}
+    from glad.c."""
+    features = {}
+    feature = None
+
+    with open(path) as f:
+        for line in f:
+            line = line.rstrip()
+
+            m = LOADER.match(line)
+            if m:
+                feature = 'GLAD_' + m.group(1)
+                continue
+
+            if line == '}':
+                feature = None
+                continue
+
+            m = LOAD.match(line)
+            if m and feature is not None:
+                features.setdefault(m.group(1), [])
+                if feature not in features[m.group(1)]:
+                    features[m.group(1)].append(feature)
+
+    return features
+
+
+def rename_params(params):
+    return re.sub(r'\b(%s)\b' % '|'.join(RENAME), lambda m: RENAME[m.group(1)], params)
+
+
+def arg_names(params):
+    if params in ('', 'void'):
+        return []
+    return [re.findall(r'\w+', p)[-1] for p in params.split(',')]
+
+
+def emit(features, procs, loaders, out):
+    out.write(HEADER)
+    current = None
+    for ret, name, pfn, params, args, feature in procs:
+        if feature != current:
+            out.write('\nGLAD_FEATURE(%s)\n' % feature)
+            current = feature
+        params = '(%s)' % (params or 'void')
+        args = '(%s)' % ', '.join(args)
+        flags = [feature] + [f for f in loaders.get(name, []) if f != feature]
+        flags = flags[0] if len(flags) == 1 else '(%s)' % ' || '.join(flags)
+        if ret == 'void':
+            out.write('GLAD_PROC_VOID(%s, %s, %s, %s, %s)\n' % (name, pfn, params, args, flags))
+        else:
+            out.write('GLAD_PROC(%s, %s, %s, %s, %s, %s)\n' % (ret, name, pfn, params, args, flags))
+    for feature in features:
+        if feature not in (p[5] for p in procs):
+            out.write('\nGLAD_FEATURE(%s)\n' % feature)
+    out.write(FOOTER)
+
+
+def main(argv):
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+    path = argv[1] if len(argv) > 1 else os.path.join(root, 'include', 'glad', 'glad.h')
+    source = argv[2] if len(argv) > 2 else os.path.join(root, 'src', 'glad.c')
+    features, procs = parse(path)
+    emit(features, procs, loaded_by(source), sys.stdout)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
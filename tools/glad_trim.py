@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""
+Writes a trimmed entry point list for one program, for building glad.c with
+only the entry points that program uses.
+
+The program's object files (everything except glad.o itself) are scanned
+with nm for references to glad_gl* pointers, and the matching lines of
+include/glad/glad_procs.h are kept. glGetString, glGetStringi and
+glGetIntegerv are always kept, glad needs them to read the version and
+extensions. All GLAD_FEATURE lines are kept, so the version and extension
+flags work as before.
+
+Usage:
+    python tools/glad_trim.py -o build/Main_procs.h build/Main.o build/AppContext.o ...
+    gcc -Iinclude -Ibuild -DGLAD_TRIMMED='"Main_procs.h"' -c src/glad.c -o build/glad_Main.o
+
+then link the program against glad_Main.o instead of the full glad.o. Set
+NM to use a different nm (e.g. one for a cross toolchain).
+"""
+
+import os
+import re
+import subprocess
+import sys
+
+# glad reads the version and extensions through these
+ALWAYS = ['GetString', 'GetStringi', 'GetIntegerv']
+
+SYMBOL = re.compile(r'\b_?glad_gl(\w+)\b')
+PROC = re.compile(r'^GLAD_PROC\([^,]+, (\w+), |^GLAD_PROC_VOID\((\w+), ')
+
+
+def referenced(objects, nm):
+    """Returns the names (without "gl") of every glad_gl* pointer the given
+    objects refer to but don't define."""
+    names = set()
+    for path in objects:
+        output = subprocess.run([nm, '-u', path], stdout=subprocess.PIPE,
+                                universal_newlines=True, check=True).stdout
+        for line in output.splitlines():
+            m = SYMBOL.search(line)
+            if m:
+                names.add(m.group(1))
+    return names
+
+
+def trim(procs_path, used, out):
+    """Copies procs_path to out, leaving out the GLAD_PROC lines for entry
+    points not in used. Returns (kept, total)."""
+    kept = total = 0
+    with open(procs_path) as f:
+        for line in f:
+            m = PROC.match(line)
+            if m:
+                total += 1
+                if (m.group(1) or m.group(2)) not in used:
+                    continue
+                kept += 1
+            out.write(line)
+    return kept, total
+
+
+def main(argv):
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir)
+    procs_path = os.path.join(root, 'include', 'glad', 'glad_procs.h')
+    output = None
+    objects = []
+
+    args = argv[1:]
+    while args:
+        arg = args.pop(0)
+        if arg == '-o' and args:
+            output = args.pop(0)
+        elif arg == '--procs' and args:
+            procs_path = args.pop(0)
+        else:
+            objects.append(arg)
+
+    if not objects:
+        sys.stderr.write(__doc__)
+        return 1
+
+    used = referenced(objects, os.environ.get('NM', 'nm'))
+    used.update(ALWAYS)
+
+    out = open(output, 'w') if output else sys.stdout
+    try:
+        out.write('/* Trimmed by tools/glad_trim.py from %s */\n' % ' '.join(os.path.basename(o) for o in objects))
+        kept, total = trim(procs_path, used, out)
+    finally:
+        if output:
+            out.close()
+
+    sys.stderr.write('glad_trim: kept %d of %d entry points\n' % (kept, total))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
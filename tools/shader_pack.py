@@ -0,0 +1,428 @@
+#!/usr/bin/env python3
+"""
+Preprocesses the GLSL the demos build from source and packs it into one
+file, shaders/shaders.pack, which the demos map into memory and hand to
+the driver as it is (see src/ShaderPack.h). Rerun it after editing one of
+the shaders or a block they include, the demos only ever load the pack.
+
+Each shader goes through these steps:
+  - #include "file" is replaced by the file (relative to the one including
+    it), once per shader. "Name.block" is the GLSL declaration of the
+    block declared with DECLARE_BLOCK(Name, ...) in src/, written from
+    the same field list as the C++ struct, so the two can't drift apart.
+  - Comments, indentation and every space GLSL doesn't need go. Lines stay
+    lines: a blank or comment line is left empty, and so are the lines of
+    a function that is left out. A #line after each include puts the
+    numbering back, so a compile log points at the line in shaders/.
+  - Functions main doesn't end up calling are left out.
+  - Arithmetic on two number literals of the same type (1.0 / 255.0, ...)
+    is folded into one, when the operators around it don't bind tighter.
+#ifdef and friends are kept, the permutations (see ShaderPermutations.h)
+are still picked at runtime.
+
+Pack layout, little endian:
+  header    'GLSP', version, shader count, 0            4 x uint32
+  entries   name hash, name offset, source offset,      4 x uint32 each,
+            source length                               sorted by hash
+  strings   names and sources, each NUL terminated
+Offsets are from the start of the file, the hash is the 32 bit FNV-1a of
+the name, like nameHash in src/Hash.h.
+
+Usage:
+    python tools/shader_pack.py [output]
+"""
+
+import os
+import re
+import struct
+import sys
+
+# Relative to shaders/, also their names in the pack. DifferentShaders'
+# files are read from disk too by its hot reload mode
+PACK_SHADERS = [
+    'BasicShader.vert', 'BasicShader.frag',
+    'DifferentShaders.vert', 'DifferentShaders1.frag', 'DifferentShaders2.frag',
+    'Fallback.vert', 'Fallback.frag'
+]
+
+PACK_MAGIC = 0x50534C47    # 'GLSP'
+PACK_VERSION = 1
+
+# GLSL names of the types BlockLayout.h knows
+BLOCK_TYPES = {
+    'float': 'float', 'int': 'int', 'unsigned int': 'uint',
+    'Vec2': 'vec2', 'Vec3': 'vec3', 'Vec4': 'vec4', 'IVec4': 'ivec4', 'Mat4': 'mat4'
+}
+
+TOKEN = re.compile(r'0[xX][0-9a-fA-F]+[uU]?|(?:\d+\.\d*|\.\d+|\d+)(?:[eE][+-]?\d+)?[fFuU]?|[A-Za-z_]\w*'
+                   r'|\+\+|--|<<=?|>>=?|&&|\|\||\^\^|[-+*/%<>=!&|^]=|\S')
+FLOAT_LITERAL = re.compile(r'^(?:(?:\d+\.\d*|\.\d+)(?:[eE][+-]?\d+)?|\d+[eE][+-]?\d+)[fF]?$')
+INT_LITERAL = re.compile(r'^\d+$')
+OPERATOR_CHARS = set('+-*/%<>=!&|^')
+
+# What a folded + or - can follow, so nothing before it binds tighter
+FOLD_AFTER = ('', '(', ',', '{', '[', '?', ':', 'return', '=', '+=', '-=', '*=', '/=')
+
+
+def name_hash(name):
+    value = 2166136261
+    for byte in name.encode('utf-8'):
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def find_blocks(source_dir):
+    """GLSL declaration of every DECLARE_BLOCK in the headers, by name."""
+    fields, blocks = {}, {}
+    headers = sorted(f for f in os.listdir(source_dir) if f.endswith('.h'))
+
+    for header in headers:
+        with open(os.path.join(source_dir, header)) as f:
+            text = strip_comments(f.read().replace('\\\n', ' '))
+
+        # #define LIGHT_FIELDS(FIELD) FIELD(Vec3, direction) FIELD(float, power) ...
+        for match in re.finditer(r'#define\s+(\w+)\s*\(\s*(\w+)\s*\)([^\n]*)', text):
+            members = re.findall(r'\b' + match.group(2) + r'\s*\(\s*([^,()]+?)\s*,\s*(\w+)\s*\)', match.group(3))
+            if members:
+                fields[match.group(1)] = members
+
+        for match in re.finditer(r'\bDECLARE_BLOCK\s*\(\s*(\w+)\s*,\s*(STD140|STD430)\s*,\s*(\w+)\s*\)', text):
+            blocks[match.group(1)] = (match.group(2), match.group(3))
+
+    declarations = {}
+
+    for name, (packing, list_name) in blocks.items():
+        if list_name not in fields:
+            raise ValueError('%s: no field list %s' % (name, list_name))
+
+        # The same text Block::declaration(name) makes
+        text = ('layout(std140) uniform ' if packing == 'STD140' else 'layout(std430) buffer ') + name + ' {\n'
+
+        for type_name, member in fields[list_name]:
+            array = re.match(r'^(.+?)\s*\[\s*(\d+)\s*\]$', type_name)
+            element = array.group(1) if array else type_name
+
+            if element not in BLOCK_TYPES:
+                raise ValueError('%s.%s: %s has no GLSL type' % (name, member, element))
+
+            text += '\t' + BLOCK_TYPES[element] + ' ' + member + ('[%s]' % array.group(2) if array else '') + ';\n'
+
+        declarations[name + '.block'] = text + '};\n'
+
+    return declarations
+
+
+def strip_comments(text):
+    def replace(match):
+        return '\n' * match.group(0).count('\n') if match.group(0).startswith('/*') else ''
+
+    return re.sub(r'/\*.*?\*/|//[^\n]*', replace, text, flags=re.S)
+
+
+def resolve(path, blocks, included):
+    """The file with its comments gone and its includes pasted in."""
+    with open(path) as f:
+        text = strip_comments(f.read().replace('\\\n', ' '))
+
+    lines = []
+
+    for number, line in enumerate(text.split('\n'), 1):
+        match = re.match(r'^\s*#\s*include\s+"([^"]+)"\s*$', line)
+
+        if not match:
+            lines.append(line)
+            continue
+
+        name = match.group(1)
+        target = os.path.normpath(os.path.join(os.path.dirname(path), name))
+
+        # Like #pragma once, a second include is nothing
+        if name in blocks:
+            pasted = blocks[name] if name not in included else None
+            included.add(name)
+        elif os.path.isfile(target):
+            pasted = '#line 1\n' + resolve(target, blocks, included) if target not in included else None
+            included.add(target)
+        else:
+            raise ValueError('%s: can\'t find %s' % (path, name))
+
+        if pasted is None:
+            lines.append('')
+        else:
+            # The line after the include is the next one of this file again
+            lines.append(pasted.rstrip('\n'))
+            lines.append('#line %d' % (number + 1))
+
+    return '\n'.join(lines)
+
+
+def strip_unused_functions(text):
+    """Leaves out the definitions of functions main can't reach."""
+    # Preprocessor lines blanked to a character no declaration ends with,
+    # same offsets, so they neither count braces nor get cut into
+    code = ''.join('\x01' * len(line) if line.lstrip().startswith('#') else line
+                   for line in text.splitlines(True))
+
+    definitions = []    # (name, start, end, body start)
+    depth = 0
+    i = 0
+    header = re.compile(r'([A-Za-z_]\w*)\s*\(([^(){};\x01]*)\)\s*\{')
+
+    while i < len(code):
+        c = code[i]
+
+        if c == '{':
+            depth += 1
+        elif c == '}':
+            depth -= 1
+        elif depth == 0 and (c.isalpha() or c == '_') and (i == 0 or not (code[i - 1].isalnum() or code[i - 1] == '_')):
+            match = header.match(code, i)
+
+            if match and match.group(1) not in ('if', 'for', 'while', 'switch', 'layout'):
+                # Back over the return type and qualifiers
+                start = i
+                while start > 0 and (code[start - 1].isalnum() or code[start - 1] in ' \t\n_[]'):
+                    start -= 1
+                while code[start] in ' \t\n':
+                    start += 1
+
+                # Only a definition when something typed comes before the name
+                if start < i:
+                    open_brace = match.end() - 1
+                    level, end = 0, open_brace
+
+                    while end < len(code):
+                        if code[end] == '{':
+                            level += 1
+                        elif code[end] == '}':
+                            level -= 1
+                            if level == 0:
+                                break
+                        end += 1
+
+                    definitions.append((match.group(1), start, end + 1, open_brace))
+                    i = end + 1
+                    continue
+
+        i += 1
+
+    if not definitions:
+        return text
+
+    identifiers = lambda part: set(re.findall(r'[A-Za-z_]\w*', part))
+
+    # Anything named outside a definition (globals, macros, prototypes) is
+    # used; a function body uses what it names
+    outside, last = [], 0
+    calls = {}
+
+    for name, start, end, body in definitions:
+        outside.append(text[last:start])
+        calls.setdefault(name, set()).update(identifiers(text[body:end]))
+        last = end
+
+    outside.append(text[last:])
+
+    used = identifiers(''.join(outside)) | {'main'}
+    pending = [name for name in calls if name in used]
+
+    while pending:
+        for called in calls[pending.pop()]:
+            if called in calls and called not in used:
+                used.add(called)
+                pending.append(called)
+
+    for name, start, end, body in reversed(definitions):
+        if name in used:
+            continue
+
+        # Not when it takes part of an #if with it. Its lines stay, empty
+        if balanced_conditionals(text[start:end]):
+            text = text[:start] + '\n' * text[start:end].count('\n') + text[end:]
+
+    return text
+
+
+def balanced_conditionals(part):
+    depth = 0
+
+    for directive in re.findall(r'^\s*#\s*(\w+)', part, re.M):
+        if directive.startswith('if'):
+            depth += 1
+        elif directive == 'endif':
+            depth -= 1
+        elif directive in ('else', 'elif') and depth == 0:
+            return False
+
+        if depth < 0:
+            return False
+
+    return depth == 0
+
+
+def float32(value):
+    return struct.unpack('<f', struct.pack('<f', value))[0]
+
+
+def format_float(value, suffix):
+    # The shortest text that reads back as the same float
+    for digits in range(1, 10):
+        text = '%.*g' % (digits, value)
+        if float32(float(text)) == value:
+            break
+
+    if '.' not in text and 'e' not in text:
+        text += '.0'
+
+    return text + suffix
+
+
+def fold_pair(left, operator, right):
+    """The literal for left operator right, None if it can't be folded."""
+    if INT_LITERAL.match(left) and INT_LITERAL.match(right):
+        a, b = int(left), int(right)
+
+        if operator == '/' and b == 0:
+            return None
+
+        # Neither is negative, so // divides toward zero like GLSL. Results
+        # that don't fit a 32 bit int are left to the compiler
+        value = {'+': a + b, '-': a - b, '*': a * b, '/': a // b if b else 0}[operator]
+        return str(value) if 0 <= value < 2 ** 31 else None
+
+    if FLOAT_LITERAL.match(left) and FLOAT_LITERAL.match(right):
+        suffix = 'f' if left[-1] in 'fF' or right[-1] in 'fF' else ''
+        a, b = float32(float(left.rstrip('fF'))), float32(float(right.rstrip('fF')))
+
+        if operator == '/' and b == 0.0:
+            return None
+
+        value = float32({'+': a + b, '-': a - b, '*': a * b, '/': a / b if b else 0.0}[operator])
+
+        if value != value or value in (float('inf'), float('-inf')) or value < 0.0:
+            return None
+
+        return format_float(value, suffix)
+
+    return None
+
+
+def fold_constants(tokens):
+    folded = True
+
+    while folded:
+        folded = False
+
+        for i in range(len(tokens) - 2):
+            left, operator, right = tokens[i:i + 3]
+
+            if operator not in ('+', '-', '*', '/'):
+                continue
+
+            before = tokens[i - 1] if i > 0 else ''
+            after = tokens[i + 3] if i + 3 < len(tokens) else ''
+
+            # Nothing around may take one of the literals first: a / 2.0 * 3.0
+            # isn't a / 6.0, a * 2.0 + 1.0 isn't a * 3.0
+            if operator in ('*', '/'):
+                if before in ('*', '/', '%') or after in ('.', '['):
+                    continue
+            elif before not in FOLD_AFTER or after not in ('', ')', ',', ';', ']', ':', '+', '-'):
+                continue
+
+            value = fold_pair(left, operator, right)
+
+            if value is not None:
+                tokens[i:i + 3] = [value]
+                folded = True
+                break
+
+    return tokens
+
+
+def compact(text):
+    lines = []
+
+    for line in text.split('\n'):
+        line = line.strip()
+
+        # Kept, so the lines after it keep their numbers
+        if not line:
+            lines.append('')
+            continue
+
+        # Directives keep one space wherever they had any, #define F (x)
+        # and #define F(x) are different macros
+        if line.startswith('#'):
+            lines.append('#' + ' '.join(line[1:].split()))
+            continue
+
+        tokens = fold_constants(TOKEN.findall(line))
+        compacted = tokens[0]
+
+        for previous, token in zip(tokens, tokens[1:]):
+
+            # Only where the two would run together otherwise: vec4 x, a - -b,
+            # return .5
+            word = (previous[-1].isalnum() or previous[-1] == '_') and (token[0].isalnum() or token[0] == '_' or token[:2] != token[:1] and token[0] == '.' and token[1].isdigit())
+            if word or (previous[-1] in OPERATOR_CHARS and token[0] in OPERATOR_CHARS):
+                compacted += ' '
+
+            compacted += token
+
+        lines.append(compacted)
+
+    return '\n'.join(lines).rstrip('\n') + '\n'
+
+
+def preprocess(path, blocks):
+    return compact(strip_unused_functions(resolve(path, blocks, set())))
+
+
+def write_pack(output, shaders):
+    entries, strings = [], b''
+    data_start = 16 + 16 * len(shaders)
+
+    for name, source in shaders:
+        name_offset = data_start + len(strings)
+        strings += name.encode('utf-8') + b'\0'
+        source_offset = data_start + len(strings)
+        encoded = source.encode('utf-8')
+        strings += encoded + b'\0'
+        entries.append((name_hash(name), name_offset, source_offset, len(encoded)))
+
+    entries.sort()
+
+    for first, second in zip(entries, entries[1:]):
+        if first[0] == second[0]:
+            raise ValueError('two shaders with the hash %08x, rename one' % first[0])
+
+    with open(output, 'wb') as f:
+        f.write(struct.pack('<4I', PACK_MAGIC, PACK_VERSION, len(entries), 0))
+        for entry in entries:
+            f.write(struct.pack('<4I', *entry))
+        f.write(strings)
+
+
+def main(argv):
+    root = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), os.pardir))
+    shader_dir = os.path.join(root, 'shaders')
+    output = argv[1] if len(argv) > 1 else os.path.join(shader_dir, 'shaders.pack')
+
+    try:
+        blocks = find_blocks(os.path.join(root, 'src'))
+        shaders = [(name, preprocess(os.path.join(shader_dir, name), blocks)) for name in PACK_SHADERS]
+        write_pack(output, shaders)
+    except (IOError, OSError, ValueError) as error:
+        sys.stderr.write('%s\n' % error)
+        return 1
+
+    before = sum(os.path.getsize(os.path.join(shader_dir, name)) for name in PACK_SHADERS)
+    after = sum(len(source) for name, source in shaders)
+    print('Packed %d shaders into %s, %d bytes of source from %d' % (len(shaders), output, after, before))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))